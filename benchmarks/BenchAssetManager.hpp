@@ -0,0 +1,35 @@
+#pragma once
+
+#include <Utils/Assets/IAssetManager.hpp>
+
+#include <filesystem>
+#include <utility>
+
+namespace dotnamebot::bench {
+
+  /**
+   * @brief Asset manager over a plain directory; RssManager only needs one for its data files
+   *
+   */
+  class BenchAssetManager : public assets::IAssetManager {
+  public:
+    explicit BenchAssetManager(std::filesystem::path path) : path_(std::move(path)) {}
+
+    [[nodiscard]] const std::filesystem::path &getAssetsPath() const override { return path_; }
+
+    [[nodiscard]] std::filesystem::path
+    resolveAsset(const std::filesystem::path &relativePath) const override {
+      return path_ / relativePath;
+    }
+
+    [[nodiscard]] bool assetExists(const std::filesystem::path &relativePath) const override {
+      return std::filesystem::exists(path_ / relativePath);
+    }
+
+    [[nodiscard]] bool validate() const override { return std::filesystem::is_directory(path_); }
+
+  private:
+    std::filesystem::path path_;
+  };
+
+} // namespace dotnamebot::bench
@@ -0,0 +1,364 @@
+#include "FakeFeedServer.hpp"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <ctime>
+#include <iconv.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace dotnamebot::bench {
+
+  namespace {
+
+    // Requests larger than this are not something curl sends; the connection is dropped
+    constexpr size_t MAX_REQUEST_BYTES = 64 * 1024;
+    constexpr time_t BASE_TIME = 1767225600; // 2026-01-01T00:00:00Z
+    constexpr time_t ITEM_SPACING_SECONDS = 600;
+
+    // Czech words so that transcoding from windows-1250 actually has work to do
+    constexpr const char *FILLER =
+        "Příliš žluťoučký kůň úpěl ďábelské ódy &amp; lorem ipsum dolor sit amet, "
+        "consectetur adipiscing elit &lt;b&gt;sed do&lt;/b&gt; eiusmod tempor. ";
+
+    std::string formatTime(time_t t, const char *format) {
+      std::tm tm{};
+      gmtime_r(&t, &tm);
+      char buffer[64];
+      const size_t length = std::strftime(buffer, sizeof(buffer), format, &tm);
+      return {buffer, length};
+    }
+
+    std::string filler(size_t bytes) {
+      std::string text;
+      text.reserve(bytes + std::strlen(FILLER));
+      while (text.size() < bytes) {
+        text += FILLER;
+      }
+      return text;
+    }
+
+    std::string toWindows1250(const std::string &utf8) {
+      iconv_t cd = iconv_open("WINDOWS-1250", "UTF-8");
+      if (cd == reinterpret_cast<iconv_t>(-1)) {
+        return utf8;
+      }
+      std::string out(utf8.size(), '\0');
+      char *in = const_cast<char *>(utf8.data());
+      size_t inLeft = utf8.size();
+      char *outPtr = out.data();
+      size_t outLeft = out.size();
+      // Every character of the filler fits into one byte, so the output never grows
+      iconv(cd, &in, &inLeft, &outPtr, &outLeft);
+      iconv_close(cd);
+      out.resize(out.size() - outLeft);
+      return out;
+    }
+
+    bool sendAll(int fd, std::string_view data) {
+      while (!data.empty()) {
+        const ssize_t sent = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (sent <= 0) {
+          if (sent < 0 && errno == EINTR) {
+            continue;
+          }
+          return false;
+        }
+        data.remove_prefix(static_cast<size_t>(sent));
+      }
+      return true;
+    }
+
+    bool headerPresent(std::string_view request, std::string_view header) {
+      auto it = std::search(request.begin(), request.end(), header.begin(), header.end(),
+                            [](char a, char b) {
+                              return std::tolower(static_cast<unsigned char>(a)) ==
+                                     std::tolower(static_cast<unsigned char>(b));
+                            });
+      return it != request.end();
+    }
+
+  } // namespace
+
+  FakeFeedServer::FakeFeedServer(FakeFeedConfig config)
+      : config_(std::move(config)), rng_(config_.seed) {
+    if (config_.formats.empty()) {
+      config_.formats.push_back(FeedFormat::Rss2);
+    }
+  }
+
+  FakeFeedServer::~FakeFeedServer() { stop(); }
+
+  bool FakeFeedServer::start() {
+    listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd_ < 0) {
+      return false;
+    }
+    int reuse = 1;
+    ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t length = sizeof(address);
+    if (::bind(listenFd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+        ::listen(listenFd_, SOMAXCONN) != 0 ||
+        ::getsockname(listenFd_, reinterpret_cast<sockaddr *>(&address), &length) != 0) {
+      ::close(listenFd_);
+      listenFd_ = -1;
+      return false;
+    }
+    port_ = ntohs(address.sin_port);
+
+    running_ = true;
+    acceptThread_ = std::thread(&FakeFeedServer::acceptLoop, this);
+    return true;
+  }
+
+  void FakeFeedServer::stop() {
+    if (!running_.exchange(false)) {
+      return;
+    }
+    // Unblocks accept() and every recv() so the threads can be joined
+    ::shutdown(listenFd_, SHUT_RDWR);
+    if (acceptThread_.joinable()) {
+      acceptThread_.join();
+    }
+    ::close(listenFd_);
+    listenFd_ = -1;
+
+    std::vector<std::thread> workers;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (int fd : clientFds_) {
+        ::shutdown(fd, SHUT_RDWR);
+      }
+      workers.swap(workers_);
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  std::string FakeFeedServer::feedUrl(size_t index) const {
+    return "http://127.0.0.1:" + std::to_string(port_) + "/feed/" + std::to_string(index);
+  }
+
+  void FakeFeedServer::acceptLoop() {
+    while (running_) {
+      const int fd = ::accept(listenFd_, nullptr, nullptr);
+      if (fd < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        break;
+      }
+      int noDelay = 1;
+      ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!running_) {
+        ::close(fd);
+        break;
+      }
+      clientFds_.push_back(fd);
+      workers_.emplace_back(&FakeFeedServer::serveConnection, this, fd);
+    }
+  }
+
+  void FakeFeedServer::serveConnection(int fd) {
+    std::string buffer;
+    char chunk[4096];
+    bool keepAlive = true;
+    while (keepAlive && running_) {
+      size_t headerEnd = std::string::npos;
+      while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+        const ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (received <= 0 || buffer.size() > MAX_REQUEST_BYTES) {
+          keepAlive = false;
+          break;
+        }
+        buffer.append(chunk, static_cast<size_t>(received));
+      }
+      if (!keepAlive) {
+        break;
+      }
+
+      // Only GET without a body is expected: "GET /feed/12 HTTP/1.1"
+      const std::string_view request(buffer.data(), headerEnd);
+      const size_t pathStart = request.find(' ');
+      const size_t pathEnd = request.find(' ', pathStart + 1);
+      std::string path;
+      if (pathStart != std::string_view::npos && pathEnd != std::string_view::npos) {
+        path = std::string(request.substr(pathStart + 1, pathEnd - pathStart - 1));
+      }
+      keepAlive = !headerPresent(request, "connection: close");
+      buffer.erase(0, headerEnd + 4);
+
+      if (!sendAll(fd, respond(path))) {
+        break;
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::erase(clientFds_, fd);
+    ::close(fd);
+  }
+
+  std::string FakeFeedServer::respond(const std::string &path) {
+    const uint64_t generation = requests_.fetch_add(1);
+
+    std::chrono::milliseconds delay = config_.latency;
+    bool fail = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (config_.latencyJitter.count() > 0) {
+        std::uniform_int_distribution<long long> jitter(0, config_.latencyJitter.count());
+        delay += std::chrono::milliseconds(jitter(rng_));
+      }
+      if (config_.errorRate > 0.0) {
+        fail = std::uniform_real_distribution<double>(0.0, 1.0)(rng_) < config_.errorRate;
+      }
+    }
+    if (delay.count() > 0) {
+      std::this_thread::sleep_for(delay);
+    }
+
+    constexpr std::string_view prefix = "/feed/";
+    size_t index = 0;
+    const bool known =
+        path.starts_with(prefix) &&
+        std::from_chars(path.data() + prefix.size(), path.data() + path.size(), index).ec ==
+            std::errc{};
+    if (!known || fail) {
+      const std::string body = known ? "injected failure" : "not found";
+      return std::string(known ? "HTTP/1.1 500 Internal Server Error" : "HTTP/1.1 404 Not Found") +
+             "\r\nContent-Type: text/plain\r\nContent-Length: " + std::to_string(body.size()) +
+             "\r\n\r\n" + body;
+    }
+
+    uint64_t feedGeneration = config_.changeEveryRequest ? generation : 0;
+    if (config_.newItemsPerRequest > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      feedGeneration = feedRequests_[index]++;
+    }
+    std::string body = renderFeed(config_, index, feedGeneration);
+    const FeedFormat format = config_.formats[index % config_.formats.size()];
+    std::string contentType = format == FeedFormat::JsonFeed ? "application/feed+json"
+                                                             : "application/xml; charset=utf-8";
+    if (format != FeedFormat::JsonFeed && usesLegacyEncoding(index)) {
+      const std::string declaration = R"(encoding="UTF-8")";
+      body.replace(body.find(declaration), declaration.size(), R"(encoding="windows-1250")");
+      body = toWindows1250(body);
+      contentType = "application/xml";
+    }
+    return "HTTP/1.1 200 OK\r\nContent-Type: " + contentType +
+           "\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+  }
+
+  bool FakeFeedServer::usesLegacyEncoding(size_t index) const {
+    // Spread evenly over the feed indices instead of taking the first N feeds
+    return static_cast<double>((index * 37) % 100) < config_.legacyEncodingShare * 100.0;
+  }
+
+  std::string FakeFeedServer::renderFeed(const FakeFeedConfig &config, size_t index,
+                                         uint64_t generation) {
+    const FeedFormat format = config.formats[index % config.formats.size()];
+    const std::string feedId = std::to_string(index);
+    const std::string feedLink = "http://feeds.invalid/" + feedId;
+    const std::string description = filler(config.descriptionBytes);
+
+    std::string xml;
+    xml.reserve(config.itemsPerFeed * (config.descriptionBytes + 400) + 1024);
+    if (format != FeedFormat::JsonFeed) {
+      xml += R"(<?xml version="1.0" encoding="UTF-8"?>)";
+      xml += '\n';
+    }
+    switch (format) {
+      case FeedFormat::Rss2:
+        xml += R"(<rss version="2.0"><channel><title>Synthetic feed )" + feedId +
+               "</title><link>" + feedLink + "</link><description>Benchmark feed</description>"
+               "<ttl>30</ttl>\n";
+        break;
+      case FeedFormat::Rdf:
+        xml += R"(<rdf:RDF xmlns:rdf="http://www.w3.org/1999/02/22-rdf-syntax-ns#" )"
+               R"(xmlns="http://purl.org/rss/1.0/" xmlns:dc="http://purl.org/dc/elements/1.1/">)"
+               R"(<channel rdf:about=")" +
+               feedLink + R"("><title>Synthetic feed )" + feedId + "</title><link>" + feedLink +
+               "</link><description>Benchmark feed</description></channel>\n";
+        break;
+      case FeedFormat::Atom:
+        xml += R"(<feed xmlns="http://www.w3.org/2005/Atom"><title>Synthetic feed )" + feedId +
+               R"(</title><link href=")" + feedLink + R"("/><subtitle>Benchmark feed</subtitle>)"
+               "\n";
+        break;
+      case FeedFormat::JsonFeed:
+        xml += R"({"version": "https://jsonfeed.org/version/1.1", "title": "Synthetic feed )" +
+               feedId + R"(", "home_page_url": ")" + feedLink +
+               R"(", "description": "Benchmark feed", "items": [)" + "\n";
+        break;
+    }
+
+    for (size_t i = 0; i < config.itemsPerFeed; ++i) {
+      std::string itemId = std::to_string(generation) + "-" + std::to_string(i);
+      time_t published = BASE_TIME + static_cast<time_t>(generation * 60) -
+                         static_cast<time_t>(i) * ITEM_SPACING_SECONDS;
+      if (config.newItemsPerRequest > 0) {
+        // Sequence numbers count up over the feed's life; the window shows the newest ones
+        const uint64_t sequence = generation * config.newItemsPerRequest + config.itemsPerFeed - i;
+        itemId = std::to_string(sequence);
+        published = BASE_TIME + static_cast<time_t>(sequence) * ITEM_SPACING_SECONDS;
+      }
+      const std::string link = feedLink + "/" + itemId;
+      const std::string title = "Položka " + itemId + " kanálu " + feedId;
+      switch (format) {
+        case FeedFormat::Rss2:
+          xml += "<item><title>" + title + "</title><link>" + link + "</link><guid>" + link +
+                 "</guid><pubDate>" + formatTime(published, "%a, %d %b %Y %H:%M:%S +0000") +
+                 "</pubDate><description>" + description + "</description></item>\n";
+          break;
+        case FeedFormat::Rdf:
+          xml += R"(<item rdf:about=")" + link + R"("><title>)" + title + "</title><link>" + link +
+                 "</link><dc:date>" + formatTime(published, "%Y-%m-%dT%H:%M:%SZ") +
+                 "</dc:date><description>" + description + "</description></item>\n";
+          break;
+        case FeedFormat::Atom:
+          xml += "<entry><title>" + title + R"(</title><link href=")" + link + R"("/><id>)" +
+                 link + "</id><updated>" + formatTime(published, "%Y-%m-%dT%H:%M:%SZ") +
+                 "</updated><summary>" + description + "</summary></entry>\n";
+          break;
+        case FeedFormat::JsonFeed:
+          // The filler holds no quotes or backslashes, so it needs no JSON escaping
+          xml += std::string(i > 0 ? "," : "") + R"({"id": ")" + link + R"(", "url": ")" + link +
+                 R"(", "title": ")" + title + R"(", "date_published": ")" +
+                 formatTime(published, "%Y-%m-%dT%H:%M:%SZ") + R"(", "content_html": ")" +
+                 description + "\"}\n";
+          break;
+      }
+    }
+
+    switch (format) {
+      case FeedFormat::Rss2:
+        xml += "</channel></rss>\n";
+        break;
+      case FeedFormat::Rdf:
+        xml += "</rdf:RDF>\n";
+        break;
+      case FeedFormat::Atom:
+        xml += "</feed>\n";
+        break;
+      case FeedFormat::JsonFeed:
+        xml += "]}\n";
+        break;
+    }
+    return xml;
+  }
+
+} // namespace dotnamebot::bench
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace dotnamebot::bench {
+
+  enum class FeedFormat : std::uint8_t { Rss2, Rdf, Atom, JsonFeed };
+
+  /**
+   * @brief What the fake server serves and how it misbehaves.
+   *
+   */
+  struct FakeFeedConfig {
+    size_t itemsPerFeed{50};
+    // Approximate size of every item description
+    size_t descriptionBytes{400};
+    // Cycled by feed index: feed 0 gets formats[0], feed 1 formats[1], ...
+    std::vector<FeedFormat> formats{FeedFormat::Rss2, FeedFormat::Rdf, FeedFormat::Atom};
+    // Share of XML feeds (0..1) served in windows-1250 instead of UTF-8, to exercise
+    // transcoding; JSON Feeds are always UTF-8
+    double legacyEncodingShare{0.0};
+    // Delay before every response, plus a uniformly distributed extra of up to latencyJitter
+    std::chrono::milliseconds latency{0};
+    std::chrono::milliseconds latencyJitter{0};
+    // Probability (0..1) that a request is answered with 500
+    double errorRate{0.0};
+    // Serve a new set of items on every request, so nothing is skipped as unchanged
+    bool changeEveryRequest{true};
+    // When set, every feed is instead a newest-first window that gains this many items per
+    // request of that feed and drops as many old ones, like a real feed between polls
+    size_t newItemsPerRequest{0};
+    unsigned seed{42};
+  };
+
+  /**
+   * @brief Minimal in-process HTTP/1.1 server for synthetic RSS 2.0, RDF and Atom feeds.
+   *
+   * Listens on 127.0.0.1 on an ephemeral port and serves /feed/<index>. Every connection
+   * gets its own thread and keep-alive is supported, so curl's connection reuse behaves
+   * as it would against a real server. Only meant for benchmarks.
+   */
+  class FakeFeedServer {
+  public:
+    explicit FakeFeedServer(FakeFeedConfig config);
+    ~FakeFeedServer();
+
+    FakeFeedServer(const FakeFeedServer &) = delete;
+    FakeFeedServer &operator=(const FakeFeedServer &) = delete;
+
+    /**
+     * @brief Bind the listening socket and start accepting connections
+     *
+     * @return true on success, false on failure
+     */
+    bool start();
+    void stop();
+
+    [[nodiscard]] uint16_t port() const { return port_; }
+    [[nodiscard]] std::string feedUrl(size_t index) const;
+    [[nodiscard]] uint64_t requestCount() const { return requests_.load(); }
+
+    /**
+     * @brief Render one feed document as UTF-8
+     *
+     * @param config Feed shape
+     * @param index Feed index, selects the format
+     * @param generation Changes item titles, links and dates; with newItemsPerRequest, the
+     * number of earlier requests for this feed
+     * @return std::string The XML document
+     */
+    static std::string renderFeed(const FakeFeedConfig &config, size_t index,
+                                  uint64_t generation);
+
+  private:
+    void acceptLoop();
+    void serveConnection(int fd);
+    std::string respond(const std::string &path);
+    bool usesLegacyEncoding(size_t index) const;
+
+    FakeFeedConfig config_;
+    int listenFd_{-1};
+    uint16_t port_{0};
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> requests_{0};
+    std::thread acceptThread_;
+    std::mutex mutex_;
+    std::vector<std::thread> workers_;
+    std::vector<int> clientFds_;
+    // Requests served per feed index, for newItemsPerRequest
+    std::unordered_map<size_t, uint64_t> feedRequests_;
+    std::mt19937 rng_;
+  };
+
+} // namespace dotnamebot::bench
@@ -0,0 +1,303 @@
+// Parsing hot path, stage by stage, on the checked-in corpus in benchmarks/corpus: parseRSS,
+// convertToUtf8, decodeHtmlEntities and the hash/dedup step, plus lookups in a seen-hash index
+// with and without its Bloom filter. Every case reports bytes/s, items/s where it deals in
+// items, and heap allocations per iteration.
+//
+//   ParseBenchmark [--corpus=<dir>] [google-benchmark flags, e.g. --benchmark_filter=parseRSS]
+
+#include "BenchAssetManager.hpp"
+
+#include <Rss/HtmlEntities.hpp>
+#include <Rss/ItemFingerprint.hpp>
+#include <Rss/SeenHashIndex.hpp>
+#include <Utils/Logger/NullLogger.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
+#include <unistd.h>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// The stages are private members of RssManager; everything it includes comes first, so
+// the define only reaches RssManager itself
+#define private public
+#include <Rss/RssManager.hpp>
+#undef private
+
+#ifndef DOTNAMEBOT_BENCH_CORPUS
+#define DOTNAMEBOT_BENCH_CORPUS "benchmarks/corpus"
+#endif
+
+namespace {
+
+  std::atomic<size_t> allocations{0};
+
+  void *countedAlloc(std::size_t size, std::size_t alignment) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    size = std::max<std::size_t>(size, 1);
+    void *ptr = alignment <= alignof(std::max_align_t)
+                    ? std::malloc(size)
+                    : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    if (ptr == nullptr) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+} // namespace
+
+// Counting replacements of the global allocation functions; the array and nothrow forms
+// forward to these
+void *operator new(std::size_t size) { return countedAlloc(size, alignof(std::max_align_t)); }
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return countedAlloc(size, static_cast<std::size_t>(alignment));
+}
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::align_val_t /*alignment*/) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+  using namespace dotnamebot;
+
+  // Heap allocations made between construction and report(), averaged over the iterations
+  class AllocationCount {
+  public:
+    AllocationCount() : start_(allocations.load(std::memory_order_relaxed)) {}
+
+    void report(benchmark::State &state) const {
+      const size_t count = allocations.load(std::memory_order_relaxed) - start_;
+      state.counters["allocs"] =
+          benchmark::Counter(static_cast<double>(count), benchmark::Counter::kAvgIterations);
+    }
+
+  private:
+    size_t start_;
+  };
+
+  struct CorpusFeed {
+    std::string name;
+    std::string raw;
+    // raw as convertToUtf8 returns it
+    std::string utf8;
+    // Parsed once, for the hash/dedup case
+    rss::RSSFeed parsed;
+  };
+
+  bool loadCorpus(const std::filesystem::path &dir, rss::RssManager &manager,
+                  std::vector<CorpusFeed> &corpus) {
+    std::vector<std::filesystem::path> files;
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::directory_iterator(dir, ec)) {
+      if (entry.is_regular_file() && entry.path().extension() == ".xml") {
+        files.push_back(entry.path());
+      }
+    }
+    std::sort(files.begin(), files.end());
+
+    for (const auto &file : files) {
+      std::ifstream in(file, std::ios::binary);
+      CorpusFeed feed;
+      feed.name = file.stem().string();
+      feed.raw.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+      feed.utf8 = std::string(manager.convertToUtf8(feed.raw, feed.utf8));
+      int duplicates = 0;
+      feed.parsed = manager.parseRSS(feed.utf8, 0, 0, duplicates);
+      if (feed.parsed.items.empty()) {
+        std::cerr << "No items in corpus file " << file << '\n';
+        return false;
+      }
+      corpus.push_back(std::move(feed));
+    }
+    return !corpus.empty();
+  }
+
+  void parseRss(benchmark::State &state, rss::RssManager &manager, const CorpusFeed &feed) {
+    size_t items = 0;
+    const AllocationCount allocs;
+    for (auto _ : state) {
+      int duplicates = 0;
+      rss::RSSFeed parsed = manager.parseRSS(feed.utf8, 0, 0, duplicates);
+      items += parsed.items.size();
+      benchmark::DoNotOptimize(parsed);
+    }
+    allocs.report(state);
+    state.SetItemsProcessed(static_cast<int64_t>(items));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(feed.utf8.size()));
+  }
+
+  // UTF-8 documents take the no-copy path, legacy ones are transcoded
+  void convertToUtf8(benchmark::State &state, rss::RssManager &manager, const CorpusFeed &feed) {
+    const AllocationCount allocs;
+    for (auto _ : state) {
+      std::string buffer;
+      benchmark::DoNotOptimize(manager.convertToUtf8(feed.raw, buffer));
+    }
+    allocs.report(state);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(feed.raw.size()));
+  }
+
+  // The whole document: item text as well as the escaped markup around it
+  void decodeEntities(benchmark::State &state, const CorpusFeed &feed) {
+    const AllocationCount allocs;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(rss::decodeHtmlEntities(feed.utf8));
+    }
+    allocs.report(state);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(feed.utf8.size()));
+  }
+
+  // What parseRSS does per item after reading it: generateHash, then the seenHashes lookup.
+  // Every other item counts as seen.
+  void hashDedup(benchmark::State &state, const CorpusFeed &feed) {
+    std::vector<rss::RSSItem> items = feed.parsed.items;
+    std::unordered_set<uint64_t> seen;
+    int64_t textBytes = 0;
+    for (size_t i = 0; i < items.size(); ++i) {
+      if (i % 2 == 0) {
+        seen.emplace(items[i].hash);
+      }
+      textBytes += static_cast<int64_t>(items[i].title.size() + items[i].url.size() +
+                                        items[i].description.size());
+    }
+
+    size_t duplicates = 0;
+    const AllocationCount allocs;
+    for (auto _ : state) {
+      for (rss::RSSItem &item : items) {
+        item.generateHash();
+        duplicates += seen.contains(item.hash) ? 1 : 0;
+      }
+    }
+    benchmark::DoNotOptimize(duplicates);
+    allocs.report(state);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(items.size()));
+    state.SetBytesProcessed(state.iterations() * textBytes);
+  }
+
+  // Seen-hash index over a long history, looked up with fingerprints spread over all of it
+  constexpr size_t SEEN_HISTORY = size_t{1} << 20;
+  constexpr size_t SEEN_LOOKUPS = size_t{1} << 16;
+
+  bool writeSeenIndex(const std::filesystem::path &path, double falsePositiveRate) {
+    std::vector<rss::SeenEntry> entries;
+    entries.reserve(SEEN_HISTORY);
+    for (size_t i = 0; i < SEEN_HISTORY; ++i) {
+      entries.push_back({rss::xxh64(std::to_string(i), 0), 1});
+    }
+    return rss::SeenHashIndex::write(path, entries, falsePositiveRate);
+  }
+
+  void seenLookup(benchmark::State &state, const std::filesystem::path &path, bool hits) {
+    rss::SeenHashIndex index;
+    if (!index.open(path)) {
+      state.SkipWithError("Failed to open the seen-hash index");
+      return;
+    }
+    std::vector<uint64_t> lookups;
+    lookups.reserve(SEEN_LOOKUPS);
+    for (size_t i = 0; i < SEEN_LOOKUPS; ++i) {
+      const size_t spread = i * (SEEN_HISTORY / SEEN_LOOKUPS) + i % 7;
+      lookups.push_back(rss::xxh64(std::to_string(spread), hits ? 0 : 1));
+    }
+
+    size_t found = 0;
+    const AllocationCount allocs;
+    for (auto _ : state) {
+      for (const uint64_t fingerprint : lookups) {
+        found += index.contains(fingerprint) ? 1 : 0;
+      }
+    }
+    benchmark::DoNotOptimize(found);
+    allocs.report(state);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lookups.size()));
+  }
+
+} // namespace
+
+int main(int argc, char **argv) {
+  // Own flag first, the rest belongs to google-benchmark
+  std::filesystem::path corpusDir = DOTNAMEBOT_BENCH_CORPUS;
+  constexpr std::string_view CORPUS_FLAG = "--corpus=";
+  int kept = 1;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (arg.starts_with(CORPUS_FLAG)) {
+      corpusDir = arg.substr(CORPUS_FLAG.size());
+    } else {
+      argv[kept++] = argv[i];
+    }
+  }
+  argc = kept;
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return EXIT_FAILURE;
+  }
+
+  const auto dataDir = std::filesystem::temp_directory_path() /
+                       ("DotNameBotParseBenchmark-" + std::to_string(::getpid()));
+  std::filesystem::create_directories(dataDir);
+  std::ofstream(dataDir / "rssUrls.json") << "[]";
+  std::ofstream(dataDir / "seenHashes.json") << "[]";
+
+  int exitCode = EXIT_SUCCESS;
+  {
+    rss::RssManager manager(std::make_shared<logging::NullLogger>(),
+                            std::make_shared<bench::BenchAssetManager>(dataDir));
+    std::vector<CorpusFeed> corpus;
+    if (!loadCorpus(corpusDir, manager, corpus)) {
+      std::cerr << "Failed to load the corpus from " << corpusDir << '\n';
+      exitCode = EXIT_FAILURE;
+    } else {
+      for (const CorpusFeed &feed : corpus) {
+        benchmark::RegisterBenchmark(("parseRSS/" + feed.name).c_str(), parseRss,
+                                     std::ref(manager), std::cref(feed));
+      }
+      for (const CorpusFeed &feed : corpus) {
+        benchmark::RegisterBenchmark(("convertToUtf8/" + feed.name).c_str(), convertToUtf8,
+                                     std::ref(manager), std::cref(feed));
+      }
+      for (const CorpusFeed &feed : corpus) {
+        benchmark::RegisterBenchmark(("decodeHtmlEntities/" + feed.name).c_str(), decodeEntities,
+                                     std::cref(feed));
+      }
+      for (const CorpusFeed &feed : corpus) {
+        benchmark::RegisterBenchmark(("hashDedup/" + feed.name).c_str(), hashDedup,
+                                     std::cref(feed));
+      }
+      for (const auto &[name, rate] :
+           {std::pair{"table", 0.0},
+            std::pair{"filter", rss::SeenHashIndex::DEFAULT_FALSE_POSITIVE_RATE}}) {
+        const auto path = dataDir / (std::string(name) + ".index");
+        if (!writeSeenIndex(path, rate)) {
+          std::cerr << "Failed to write " << path << '\n';
+          continue;
+        }
+        for (const bool hits : {true, false}) {
+          benchmark::RegisterBenchmark(
+              ("seenLookup/" + std::string(name) + (hits ? "/hits" : "/misses")).c_str(),
+              seenLookup, path, hits);
+        }
+      }
+      benchmark::RunSpecifiedBenchmarks();
+    }
+  }
+  benchmark::Shutdown();
+  std::filesystem::remove_all(dataDir);
+  return exitCode;
+}
@@ -0,0 +1,189 @@
+// End-to-end fetch and parse benchmark: RssManager::refetchRssFeeds against a local fake
+// feed server, so changes to the fetch pipeline can be measured without the internet.
+
+#include "BenchAssetManager.hpp"
+#include "FakeFeedServer.hpp"
+
+#include <Http/HttpClient.hpp>
+#include <Rss/RssManager.hpp>
+#include <Utils/Logger/NullLogger.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cxxopts.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace {
+
+  using namespace dotnamebot;
+
+  std::vector<bench::FeedFormat> parseFormats(const std::string &value) {
+    if (value == "rss") {
+      return {bench::FeedFormat::Rss2};
+    }
+    if (value == "rdf") {
+      return {bench::FeedFormat::Rdf};
+    }
+    if (value == "atom") {
+      return {bench::FeedFormat::Atom};
+    }
+    if (value == "json") {
+      return {bench::FeedFormat::JsonFeed};
+    }
+    return {bench::FeedFormat::Rss2, bench::FeedFormat::Rdf, bench::FeedFormat::Atom};
+  }
+
+  double percentile(std::vector<double> values, double p) {
+    if (values.empty()) {
+      return 0.0;
+    }
+    const auto rank = static_cast<size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(rank),
+                     values.end());
+    return values[rank];
+  }
+
+  long peakRssKiB() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss; // KiB on Linux
+  }
+
+} // namespace
+
+int main(int argc, char **argv) {
+  cxxopts::Options options("RssFetchBenchmark",
+                           "Fetch and parse throughput against a local fake feed server");
+  // clang-format off
+  options.add_options()
+    ("h,help", "Print usage")
+    ("feeds", "Number of feeds", cxxopts::value<size_t>()->default_value("200"))
+    ("items", "Items per feed", cxxopts::value<size_t>()->default_value("50"))
+    ("description-bytes", "Size of each item description",
+     cxxopts::value<size_t>()->default_value("400"))
+    ("format", "rss, rdf, atom, json or mix", cxxopts::value<std::string>()->default_value("mix"))
+    ("legacy-encoding", "Share of feeds served in windows-1250 (0..1)",
+     cxxopts::value<double>()->default_value("0.1"))
+    ("latency-ms", "Server delay per response", cxxopts::value<long>()->default_value("0"))
+    ("jitter-ms", "Extra random server delay", cxxopts::value<long>()->default_value("0"))
+    ("error-rate", "Share of requests answered with 500 (0..1)",
+     cxxopts::value<double>()->default_value("0"))
+    ("unchanged", "Serve identical bodies on every round")
+    ("new-items", "Serve rolling newest-first feeds that gain this many items per round",
+     cxxopts::value<size_t>()->default_value("0"))
+    ("stop-after", "stopAfterSeenItems: stop parsing after this many known items in a row",
+     cxxopts::value<size_t>()->default_value("0"))
+    ("rounds", "Refreshes to run", cxxopts::value<int>()->default_value("5"))
+    ("parallel", "maxParallelFetches", cxxopts::value<size_t>()->default_value("16"))
+    ("buffered", "Parse whole bodies instead of streaming");
+  // clang-format on
+  auto result = options.parse(argc, argv);
+  if (result.count("help") > 0) {
+    std::cout << options.help() << '\n';
+    return EXIT_SUCCESS;
+  }
+
+  const auto feeds = result["feeds"].as<size_t>();
+  const int rounds = std::max(1, result["rounds"].as<int>());
+
+  bench::FakeFeedConfig config;
+  config.itemsPerFeed = result["items"].as<size_t>();
+  config.descriptionBytes = result["description-bytes"].as<size_t>();
+  config.formats = parseFormats(result["format"].as<std::string>());
+  config.legacyEncodingShare = result["legacy-encoding"].as<double>();
+  config.latency = std::chrono::milliseconds(result["latency-ms"].as<long>());
+  config.latencyJitter = std::chrono::milliseconds(result["jitter-ms"].as<long>());
+  config.errorRate = result["error-rate"].as<double>();
+  config.changeEveryRequest = result.count("unchanged") == 0;
+  config.newItemsPerRequest = result["new-items"].as<size_t>();
+
+  bench::FakeFeedServer server(config);
+  if (!server.start()) {
+    std::cerr << "Failed to start the fake feed server\n";
+    return EXIT_FAILURE;
+  }
+
+  // Fresh data directory: feed list pointing at the server, limits that do not throttle a
+  // single local host, and no circuit breaker so injected errors cannot suspend feeds
+  const auto dataDir = std::filesystem::temp_directory_path() /
+                       ("DotNameBotRssBenchmark-" + std::to_string(::getpid()));
+  std::filesystem::remove_all(dataDir);
+  std::filesystem::create_directories(dataDir);
+  nlohmann::json urls = nlohmann::json::array();
+  for (size_t i = 0; i < feeds; ++i) {
+    urls.push_back({{"url", server.feedUrl(i)}, {"embeddedType", 0}});
+  }
+  const auto parallel = result["parallel"].as<size_t>();
+  nlohmann::json rssOptions = {{"maxParallelFetches", parallel},
+                               {"maxFetchesPerHost", parallel},
+                               {"hostRequestsPerSecond", 1e9},
+                               {"hostBurst", 1e9},
+                               {"circuitFailureThreshold", 1000000},
+                               {"streamingParse", result.count("buffered") == 0},
+                               {"stopAfterSeenItems", result["stop-after"].as<size_t>()}};
+  std::ofstream(dataDir / "rssUrls.json") << urls.dump(2);
+  std::ofstream(dataDir / "seenHashes.json") << "[]";
+  std::ofstream(dataDir / "rssOptions.json") << rssOptions.dump(2);
+
+  int exitCode = EXIT_SUCCESS;
+  {
+    rss::RssManager manager(std::make_shared<logging::NullLogger>(),
+                            std::make_shared<bench::BenchAssetManager>(dataDir),
+                            std::make_shared<http::HttpClient>());
+
+    std::vector<double> feedSeconds;
+    double totalSeconds = 0.0;
+    long long items = 0;
+    uint64_t bytes = 0;
+    size_t fetched = 0;
+    size_t failed = 0;
+    size_t unchanged = 0;
+    size_t stopped = 0;
+
+    std::cout << std::fixed << std::setprecision(1);
+    for (int round = 1; round <= rounds; ++round) {
+      manager.refetchRssFeeds();
+      const rss::RefreshStats stats = manager.getLastRefreshStats();
+      std::cout << "round " << round << ": " << stats.feeds << " feeds, " << stats.newItems
+                << " items, " << stats.failedFeeds << " failed, " << stats.unchangedFeeds
+                << " unchanged, " << stats.stoppedFeeds << " stopped early in "
+                << stats.totalSeconds * 1000.0 << " ms\n";
+
+      totalSeconds += stats.totalSeconds;
+      items += stats.newItems;
+      bytes += stats.bodyBytes;
+      fetched += stats.feeds;
+      failed += stats.failedFeeds;
+      unchanged += stats.unchangedFeeds;
+      stopped += stats.stoppedFeeds;
+      feedSeconds.insert(feedSeconds.end(), stats.feedSeconds.begin(), stats.feedSeconds.end());
+    }
+
+    if (fetched == 0 || totalSeconds <= 0.0) {
+      std::cerr << "Nothing was fetched\n";
+      exitCode = EXIT_FAILURE;
+    } else {
+      std::cout << "\nfeeds/s:     " << static_cast<double>(fetched) / totalSeconds << '\n'
+                << "items/s:     " << static_cast<double>(items) / totalSeconds << '\n'
+                << "MiB/s:       "
+                << static_cast<double>(bytes) / (1024.0 * 1024.0) / totalSeconds << '\n'
+                << "feed p50:    " << percentile(feedSeconds, 0.50) * 1000.0 << " ms\n"
+                << "feed p99:    " << percentile(feedSeconds, 0.99) * 1000.0 << " ms\n"
+                << "failed:      " << failed << " of " << fetched << '\n'
+                << "unchanged:   " << unchanged << " of " << fetched << '\n'
+                << "stopped:     " << stopped << " of " << fetched << '\n'
+                << "peak RSS:    " << static_cast<double>(peakRssKiB()) / 1024.0 << " MiB\n"
+                << "requests:    " << server.requestCount() << '\n';
+    }
+  }
+
+  server.stop();
+  std::filesystem::remove_all(dataDir);
+  return exitCode;
+}
@@ -0,0 +1,135 @@
+// Microbenchmarks for the text scan kernels, alone and inside the functions that use them,
+// at every ScanLevel the CPU supports.
+
+#include <Rss/HtmlEntities.hpp>
+#include <Rss/HtmlFeedWriter.hpp>
+#include <Rss/HtmlText.hpp>
+#include <Utils/String/TextKernels.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cxxopts.hpp>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+  using namespace dotnamebot;
+
+  // Czech description text: mostly letters, a tag or entity every few dozen bytes
+  std::string makeDescription(size_t bytes, unsigned seed) {
+    const std::vector<std::string> words = {"Praha", "vláda", "školy", "příliš", "občané",
+                                            "na",    "se",    "v",     "rozpočet", "změna"};
+    const std::vector<std::string> markup = {"&nbsp;", "&amp;", "&#353;", "&quot;",
+                                             "<b>",    "</b>",  "\n",     "  "};
+    std::mt19937 rng(seed);
+    std::string text;
+    text.reserve(bytes + 32);
+    while (text.size() < bytes) {
+      text += words[rng() % words.size()];
+      text += rng() % 6 == 0 ? markup[rng() % markup.size()] : " ";
+    }
+    return text;
+  }
+
+  // Makes the compiler treat value as used, so the work that produced it is not dropped
+  void doNotOptimize(size_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(value) : "memory");
+#else
+    static volatile size_t sink;
+    sink = value;
+#endif
+  }
+
+  // Best of repeats, in MiB/s of input
+  double measure(size_t bytes, int repeats, const std::function<size_t()> &run) {
+    double best = 0.0;
+    for (int i = 0; i < repeats; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      doNotOptimize(run());
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      best = std::max(best, static_cast<double>(bytes) / (1024.0 * 1024.0) / elapsed.count());
+    }
+    return best;
+  }
+
+} // namespace
+
+int main(int argc, char **argv) {
+  cxxopts::Options options("TextKernelBenchmark", "Throughput of the text scan kernels");
+  // clang-format off
+  options.add_options()
+    ("h,help", "Print usage")
+    ("bytes", "Size of each input", cxxopts::value<size_t>()->default_value("4194304"))
+    ("repeats", "Runs per case, the best one counts", cxxopts::value<int>()->default_value("20"));
+  // clang-format on
+  auto result = options.parse(argc, argv);
+  if (result.count("help") > 0) {
+    std::cout << options.help() << '\n';
+    return EXIT_SUCCESS;
+  }
+  const auto bytes = result["bytes"].as<size_t>();
+  const int repeats = std::max(1, result["repeats"].as<int>());
+
+  const std::string plain(bytes, 'a');
+  const std::string description = makeDescription(bytes, 1);
+  constexpr utils::ByteSet ENTITY_DELIMITERS{"&;"};
+
+  struct Case {
+    const char *name;
+    std::function<size_t()> run;
+  };
+  const std::vector<Case> cases = {
+      {"findFirstOf (no hit)",
+       [&] { return utils::findFirstOf(plain, utils::WHITESPACE_BYTES); }},
+      {"findFirstOf (walk)",
+       [&] {
+         size_t hits = 0;
+         for (size_t pos = utils::findFirstOf(description, ENTITY_DELIMITERS);
+              pos != std::string::npos;
+              pos = utils::findFirstOf(description, ENTITY_DELIMITERS, pos + 1)) {
+           ++hits;
+         }
+         return hits;
+       }},
+      {"decodeHtmlEntities", [&] { return rss::decodeHtmlEntities(description).size(); }},
+      {"escapeHtml", [&] { return rss::HtmlFeedWriter::escapeHtml(description).size(); }},
+      {"collapseWhitespace",
+       [&] {
+         std::string text = description;
+         rss::collapseWhitespace(text);
+         return text.size();
+       }},
+  };
+
+  const utils::ScanLevel best = utils::bestScanLevel();
+  std::vector<utils::ScanLevel> levels = {utils::ScanLevel::Scalar};
+  if (best >= utils::ScanLevel::Sse2) {
+    levels.push_back(utils::ScanLevel::Sse2);
+  }
+  if (best >= utils::ScanLevel::Avx2) {
+    levels.push_back(utils::ScanLevel::Avx2);
+  }
+
+  std::cout << std::fixed << std::setprecision(0) << std::left << std::setw(24) << "MiB/s";
+  for (utils::ScanLevel level : levels) {
+    std::cout << std::right << std::setw(10) << utils::scanLevelName(level);
+  }
+  std::cout << '\n';
+  for (const Case &c : cases) {
+    std::cout << std::left << std::setw(24) << c.name;
+    for (utils::ScanLevel level : levels) {
+      utils::setScanLevel(level);
+      std::cout << std::right << std::setw(10) << measure(bytes, repeats, c.run);
+    }
+    std::cout << '\n';
+  }
+  utils::setScanLevel(best);
+  return EXIT_SUCCESS;
+}
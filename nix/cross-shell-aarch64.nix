@@ -15,7 +15,6 @@ let
 
     # Discord bot dependencies
     dpp
-    tinyxml-2
     curl
     openssl
     zlib
@@ -56,7 +55,7 @@ pkgs.mkShell {
     export PKG_CONFIG_FOR_TARGET="${pkgsCross.pkg-config}/bin/pkg-config"
     export PKG_CONFIG_PATH_FOR_TARGET=""
     for pkg in ${pkgsCross.fmt.dev} ${pkgsCross.nlohmann_json} ${pkgsCross.cxxopts} \
-                ${pkgsCross.dpp} ${pkgsCross.tinyxml-2} ${pkgsCross.curl.dev} \
+                ${pkgsCross.dpp} ${pkgsCross.curl.dev} \
                 ${pkgsCross.openssl.dev} ${pkgsCross.zlib.dev} \
                 ${pkgsCross.libsodium.dev} ${pkgsCross.libopus.dev} \
                 ${pkgsCross.libxml2.dev} \
@@ -70,10 +69,10 @@ pkgs.mkShell {
     # resolves cross packages correctly.
     export PKG_CONFIG_PATH="$PKG_CONFIG_PATH_FOR_TARGET"
 
-    # Export lib dirs for ALL targetDeps (even those without .pc files, e.g. tinyxml2)
+    # Export lib dirs for ALL targetDeps (even those without .pc files)
     # so that bundle-deps.sh can locate their .so files.
     export AARCH64_LIB_DIRS=""
-    for pkg in ${pkgsCross.fmt} ${pkgsCross.dpp} ${pkgsCross.tinyxml-2} \
+    for pkg in ${pkgsCross.fmt} ${pkgsCross.dpp} \
                 ${pkgsCross.curl} ${pkgsCross.openssl} ${pkgsCross.zlib} \
                 ${pkgsCross.libsodium} ${pkgsCross.libopus} ${pkgsCross.libxml2}; do
       [ -d "$pkg/lib" ] && AARCH64_LIB_DIRS="$AARCH64_LIB_DIRS:$pkg/lib"
@@ -44,7 +44,6 @@
             cxxopts
             # Discord bot dependencies
             dpp
-            tinyxml-2
             curl
             openssl
             zlib
@@ -92,7 +91,6 @@
 
             # Discord bot dependencies
             dpp
-            tinyxml-2
             curl
             openssl
             zlib
@@ -100,6 +98,7 @@
             libopus
 
             gtest
+            gbenchmark
             ccache
           ];
 
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""Generate src/lib/Rss/HtmlEntityTable.hpp from the HTML5 named character references.
+
+The table is laid out as a minimal perfect hash (hash and displace): every name is first
+hashed into a bucket, and each bucket stores the seed that sends all of its names to free
+slots of the entry array. A lookup is therefore two hashes and one string comparison.
+The C++ side repeats the hash function and checks the layout with a static_assert, so the
+script and the decoder cannot silently disagree.
+
+Usage: scripts/gen-html-entities.py [output]
+"""
+
+import html.entities
+import sys
+from pathlib import Path
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+SEED_MULTIPLIER = 0x9E3779B9
+MASK32 = 0xFFFFFFFF
+# Names per bucket on average; larger buckets mean a smaller seed array but a harder search
+BUCKET_LOAD = 4
+MAX_SEED = 0xFFFF
+
+
+def entity_hash(name: str, seed: int) -> int:
+    h = (FNV_OFFSET + seed * SEED_MULTIPLIER) & MASK32
+    for byte in name.encode("ascii"):
+        h ^= byte
+        h = (h * FNV_PRIME) & MASK32
+    h ^= h >> 15
+    return h
+
+
+def build(names):
+    slots = len(names)
+    bucket_count = max(1, slots // BUCKET_LOAD)
+    buckets = [[] for _ in range(bucket_count)]
+    for name in names:
+        buckets[entity_hash(name, 0) % bucket_count].append(name)
+
+    table = [None] * slots
+    seeds = [0] * bucket_count
+    # Place the largest buckets first, while most slots are still free
+    for index in sorted(range(bucket_count), key=lambda i: -len(buckets[i])):
+        bucket = buckets[index]
+        if not bucket:
+            continue
+        for seed in range(MAX_SEED + 1):
+            positions = [entity_hash(name, seed) % slots for name in bucket]
+            if len(set(positions)) == len(positions) and all(table[p] is None for p in positions):
+                for name, position in zip(bucket, positions):
+                    table[position] = name
+                seeds[index] = seed
+                break
+        else:
+            sys.exit(f"no seed places bucket {index} ({len(bucket)} names)")
+    return seeds, table
+
+
+def c_string(data: bytes) -> str:
+    out = []
+    for byte in data:
+        char = chr(byte)
+        if 0x20 <= byte < 0x7F and char not in '"\\?':
+            out.append(char)
+        else:
+            out.append(f"\\{byte:03o}")
+    return '"' + "".join(out) + '"'
+
+
+def main():
+    output = Path(sys.argv[1]) if len(sys.argv) > 1 else (
+        Path(__file__).resolve().parent.parent / "src/lib/Rss/HtmlEntityTable.hpp")
+
+    # Only the names terminated by ';'; the legacy forms without it are not decoded
+    entities = {name[:-1]: value for name, value in html.entities.html5.items()
+                if name.endswith(";")}
+    names = sorted(entities)
+    seeds, table = build(names)
+
+    lines = [
+        "// Generated by scripts/gen-html-entities.py from the HTML5 named character",
+        "// references. Do not edit by hand; rerun the script instead.",
+        "",
+        "#pragma once",
+        "",
+        "#include <array>",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "#include <string_view>",
+        "",
+        "namespace dotnamebot::rss::entities {",
+        "",
+        "  struct NamedEntity {",
+        "    // Name without the leading '&' and the trailing ';'",
+        "    std::string_view name;",
+        "    // Replacement text in UTF-8",
+        "    std::string_view utf8;",
+        "  };",
+        "",
+        f"  inline constexpr uint32_t FNV_OFFSET = {FNV_OFFSET}U;",
+        f"  inline constexpr uint32_t FNV_PRIME = {FNV_PRIME}U;",
+        f"  inline constexpr uint32_t SEED_MULTIPLIER = 0x{SEED_MULTIPLIER:X}U;",
+        f"  inline constexpr size_t MAX_NAME_LENGTH = {max(len(n) for n in names)};",
+        "",
+        "  // Bucket seeds: a name lands in bucket hash(name, 0) % size and then in",
+        "  // slot hash(name, seed) % ENTITIES.size()",
+        f"  inline constexpr std::array<uint16_t, {len(seeds)}> SEEDS = {{",
+    ]
+    for start in range(0, len(seeds), 12):
+        chunk = ", ".join(str(s) for s in seeds[start:start + 12])
+        lines.append(f"    {chunk},")
+    lines += [
+        "  };",
+        "",
+        f"  inline constexpr std::array<NamedEntity, {len(table)}> ENTITIES = {{{{",
+    ]
+    for name in table:
+        lines.append(f"    {{{c_string(name.encode('ascii'))}, "
+                     f"{c_string(entities[name].encode('utf-8'))}}},")
+    lines += [
+        "  }};",
+        "",
+        "} // namespace dotnamebot::rss::entities",
+        "",
+    ]
+    output.write_text("\n".join(lines))
+    print(f"{output}: {len(table)} entities, {len(seeds)} buckets")
+
+
+if __name__ == "__main__":
+    main()
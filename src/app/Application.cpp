@@ -1,6 +1,8 @@
+#include <Crypto/CryptoUtils.hpp>
 #include <DiscordBot/DiscordBot.hpp>
 // #include <DotNameBotLib/DotNameBotLib.hpp>
 #include <EmojiModuleLib/EmojiModuleLib.hpp>
+#include <Http/HttpClient.hpp>
 #include <ILifeCycle/ILifeCycle.hpp>
 #include <NameGen/NameGen.hpp>
 #include <Orchestrator/Orchestrator.hpp>
@@ -70,10 +72,20 @@ int main(int argc, char **argv) {
     }
     services.registerService<dotnamebot::v1::EmojiModuleLib>(emojiLib);
 
+    // HttpClient – one DNS/connection/TLS-session cache shared by every HTTP caller
+    auto httpClient = std::make_shared<dotnamebot::http::HttpClient>();
+    services.registerService<dotnamebot::http::IHttpClient>(httpClient);
+
     // RssManager (registered as IRssService interface)
-    auto rssManager = std::make_shared<dotnamebot::rss::RssManager>(ctx.logger, ctx.assetManager);
+    auto rssManager = std::make_shared<dotnamebot::rss::RssManager>(
+        ctx.logger, ctx.assetManager, services.getService<dotnamebot::http::IHttpClient>());
     services.registerService<dotnamebot::rss::IRssService>(rssManager);
 
+    // CryptoUtils
+    auto cryptoUtils = std::make_shared<dotnamebot::crypto::CryptoUtils>(
+        services.getService<dotnamebot::http::IHttpClient>());
+    services.registerService<dotnamebot::crypto::CryptoUtils>(cryptoUtils);
+
     // NameGen
     auto nameGen = std::make_shared<dotnamebot::namegen::NameGen>(ctx.logger, ctx.assetManager);
     services.registerService<dotnamebot::namegen::NameGen>(nameGen);
@@ -1,41 +1,22 @@
 #include "CryptoUtils.hpp"
 
-#include <curl/curl.h>
 #include <nlohmann/json.hpp>
 #include <string>
 
 namespace dotnamebot::crypto {
 
-  size_t CryptoUtils::writeCallback(void *contents, size_t size, size_t nmemb,
-                                    std::string *output) {
-    output->append(static_cast<char *>(contents), size * nmemb);
-    return size * nmemb;
-  }
+  CryptoUtils::CryptoUtils(std::shared_ptr<dotnamebot::http::IHttpClient> httpClient)
+      : httpClient_(std::move(httpClient)) {}
 
   std::string CryptoUtils::httpGet(const char *url) {
-    std::string buffer;
-    CURL *curl = curl_easy_init();
-    if (curl == nullptr) {
+    if (!httpClient_) {
       return {};
     }
-
-    curl_easy_setopt(curl, CURLOPT_URL, url);
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CryptoUtils::writeCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &buffer);
-    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
-    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 5L);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, "DotNameBot/1.0");
-
-    const CURLcode res = curl_easy_perform(curl);
-    curl_easy_cleanup(curl);
-
-    if (res != CURLE_OK) {
+    const dotnamebot::http::HttpResponse response = httpClient_->get(url);
+    if (!response.error.empty()) {
       return {};
     }
-    return buffer;
+    return response.body;
   }
 
   std::string CryptoUtils::fetchUsdPrice(const char *url) {
@@ -1,25 +1,33 @@
 #pragma once
 
+#include <Http/IHttpClient.hpp>
+
+#include <memory>
 #include <string>
 
 namespace dotnamebot::crypto {
 
   class CryptoUtils {
   public:
-    CryptoUtils() = default;
+    /**
+     * @brief Construct a new Crypto Utils object
+     *
+     * @param httpClient Shared HTTP client, keeps the Binance connection alive between calls
+     */
+    explicit CryptoUtils(std::shared_ptr<dotnamebot::http::IHttpClient> httpClient);
     ~CryptoUtils() = default;
 
     /**
      * @brief Fetches the current BTC/USD price from the Binance public API.
      * @return Price as a string (e.g. "67000.50"), or empty string on failure.
      */
-    static std::string getCurrentBtcUsdPrice();
+    std::string getCurrentBtcUsdPrice();
 
     /**
      * @brief Fetches the current ETH/USD price from the Binance public API.
      * @return Price as a string (e.g. "3000.50"), or empty string on failure.
      */
-    static std::string getCurrentEthUsdPrice();
+    std::string getCurrentEthUsdPrice();
 
     /**
      * @brief Returns trend direction from the last two completed hourly Klines candles.
@@ -27,12 +35,13 @@ namespace dotnamebot::crypto {
      * @param interval Kline interval, e.g. "1h"
      * @return  1 if price is rising, -1 if falling, 0 on flat or error.
      */
-    static int getKlinesTrend(const char *symbol, const char *interval = "1h");
+    int getKlinesTrend(const char *symbol, const char *interval = "1h");
 
   private:
-    static std::string httpGet(const char *url);
-    static std::string fetchUsdPrice(const char *url);
-    static size_t writeCallback(void *contents, size_t size, size_t nmemb, std::string *output);
+    std::string httpGet(const char *url);
+    std::string fetchUsdPrice(const char *url);
+
+    std::shared_ptr<dotnamebot::http::IHttpClient> httpClient_;
   };
 
 } // namespace dotnamebot::crypto
@@ -12,7 +12,8 @@ namespace dotnamebot::discordbot {
         customStrings_(services.getService<dotnamebot::utils::ICustomStringsLoader>()),
         emojiModuleLib_(services.getService<dotnamebot::v1::EmojiModuleLib>()),
         rssService_(services.getService<dotnamebot::rss::IRssService>()),
-        nameGen_(services.getService<dotnamebot::namegen::NameGen>()) {
+        nameGen_(services.getService<dotnamebot::namegen::NameGen>()),
+        cryptoUtils_(services.getService<dotnamebot::crypto::CryptoUtils>()) {
 
     if (!logger_) {
       throw std::runtime_error("DiscordBot requires a logger");
@@ -22,6 +23,10 @@ namespace dotnamebot::discordbot {
       throw std::runtime_error("DiscordBot requires an asset manager");
     }
 
+    if (!cryptoUtils_) {
+      throw std::runtime_error("DiscordBot requires CryptoUtils");
+    }
+
     if (emojiModuleLib_) {
       logger_->infoStream() << "DiscordBot initialized with EmojiModuleLib, random emoji: "
                             << emojiModuleLib_->getRandomEmoji();
@@ -222,7 +227,7 @@ namespace dotnamebot::discordbot {
         }
         if (cmd_name == "btcusd") {
           event.thinking();
-          std::string price = dotnamebot::crypto::CryptoUtils::getCurrentBtcUsdPrice();
+          std::string price = cryptoUtils_->getCurrentBtcUsdPrice();
           if (!price.empty()) {
             event.edit_response("Current BTC/USD price: " + price);
           } else {
@@ -231,7 +236,7 @@ namespace dotnamebot::discordbot {
         }
         if (cmd_name == "ethusd") {
           event.thinking();
-          std::string price = dotnamebot::crypto::CryptoUtils::getCurrentEthUsdPrice();
+          std::string price = cryptoUtils_->getCurrentEthUsdPrice();
           if (!price.empty()) {
             event.edit_response("Current ETH/USD price: " + price);
           } else {
@@ -319,17 +324,18 @@ namespace dotnamebot::discordbot {
 
           this->postCrossPostedMessage(msg, [this, item](bool success) {
             if (success) {
-              logger_->info("CrossPosted random RSS item to Discord: " + item.title);
+              logger_->info("CrossPosted random RSS item to Discord: " + std::string(item.title));
             } else {
-              logger_->error("Failed to crosspost random RSS item to Discord: " + item.title);
+              logger_->error("Failed to crosspost random RSS item to Discord: " +
+                             std::string(item.title));
             }
           });
 
           logTheServed(item, [this, item](bool success) {
             if (success) {
-              logger_->info("Served RSS item logged successfully: " + item.title);
+              logger_->info("Served RSS item logged successfully: " + std::string(item.title));
             } else {
-              logger_->error("Failed to log served RSS item: " + item.title);
+              logger_->error("Failed to log served RSS item: " + std::string(item.title));
             }
           });
         }
@@ -618,17 +624,18 @@ namespace dotnamebot::discordbot {
 
         this->postCrossPostedMessage(msg, [this, item](bool success) {
           if (success) {
-            logger_->info("CrossPosted random RSS item to Discord: " + item.title);
+            logger_->info("CrossPosted random RSS item to Discord: " + std::string(item.title));
           } else {
-            logger_->error("Failed to crosspost random RSS item to Discord: " + item.title);
+            logger_->error("Failed to crosspost random RSS item to Discord: " +
+                           std::string(item.title));
           }
         });
 
         logTheServed(item, [this, item](bool success) {
           if (success) {
-            logger_->info("Served RSS item logged successfully: " + item.title);
+            logger_->info("Served RSS item logged successfully: " + std::string(item.title));
           } else {
-            logger_->error("Failed to log served RSS item: " + item.title);
+            logger_->error("Failed to log served RSS item: " + std::string(item.title));
           }
         });
 
@@ -643,8 +650,8 @@ namespace dotnamebot::discordbot {
 
       while (isFFTRunning_.load()) {
 
-        int itemsFetched = rssService_->refetchRssFeeds();
-        if (itemsFetched >= 0) {
+        int itemsFetched = rssService_->refetchDueRssFeeds();
+        if (itemsFetched > 0) {
           size_t itemCount = rssService_->getItemCount();
           logger_->info("Periodic RSS fetch completed. Total items in buffer: " +
                         std::to_string(itemCount));
@@ -652,14 +659,16 @@ namespace dotnamebot::discordbot {
           cluster_ptr->set_presence(dpp::presence(dpp::ps_online, dpp::at_watching,
                                                   "last fetch: " + std::to_string(itemCount)));
           rssService_->generateHtmlFeed();
-        } else {
+        } else if (itemsFetched < 0) {
           logger_->error("Periodic RSS fetch failed.");
         }
 
-        // Interruptible sleep
+        // Interruptible sleep until the next feed is due
+        auto sleepFor = std::clamp(rssService_->timeUntilNextFetch(),
+                                   std::chrono::seconds(FETCH_MIN_SLEEP_SECONDS),
+                                   std::chrono::seconds(FETCH_MAX_SLEEP_SECONDS));
         std::unique_lock<std::mutex> lock(cvMutex_);
-        cv_.wait_for(lock, std::chrono::seconds(FETCH_INTERVAL_SECONDS),
-                     [this]() { return !isFFTRunning_.load(); });
+        cv_.wait_for(lock, sleepFor, [this]() { return !isFFTRunning_.load(); });
 
       } // while isRunningTimer_
     });
@@ -718,7 +727,7 @@ namespace dotnamebot::discordbot {
       constexpr double kLong = 2.0 / (EMA_LONG_PERIOD + 1);
 
       while (isBPSTRunning_.load()) {
-        std::string price = dotnamebot::crypto::CryptoUtils::getCurrentBtcUsdPrice();
+        std::string price = cryptoUtils_->getCurrentBtcUsdPrice();
         if (!price.empty()) {
           // Trim to 2 decimal places for a cleaner status string
           auto dotPos = price.find('.');
@@ -752,7 +761,7 @@ namespace dotnamebot::discordbot {
             }
           } else if constexpr (BTC_TREND_METHOD == BtcTrendMethod::Klines) {
             // Stateless: compare last two completed hourly klines from Binance API
-            const int trend = dotnamebot::crypto::CryptoUtils::getKlinesTrend("BTCUSDT", "1h");
+            const int trend = cryptoUtils_->getKlinesTrend("BTCUSDT", "1h");
             if (trend > 0)
               arrow = " \u25B2"; // ▲
             else if (trend < 0)
@@ -25,7 +25,11 @@ namespace dotnamebot::discordbot {
   constexpr static const int MAX_DISCORD_MESSAGE_LENGTH = 2000;
   constexpr dpp::snowflake LOG_CHANNEL_ID = 1454003952533242010;
   constexpr dpp::snowflake RENAME_CHANNEL_ID = 1479759351605366926;
-  constexpr int FETCH_INTERVAL_SECONDS = 3600;      // 1 hour
+  // Feeds are polled on their own adaptive schedule (see rss::FeedScheduler); the fetch
+  // timer sleeps until the next one is due, but wakes at least this often so feeds added
+  // by slash commands are picked up
+  constexpr int FETCH_MIN_SLEEP_SECONDS = 5;
+  constexpr int FETCH_MAX_SLEEP_SECONDS = 300; // 5 minutes
   constexpr int PUT_INTERVAL_SECONDS = 30;
   constexpr int RENAME_INTERVAL_SECONDS = 3600 * 2; // 2 hours
   constexpr int BTCPRICE_INTERVAL_SECONDS = 300;    // 5 minutes
@@ -205,6 +209,7 @@ namespace dotnamebot::discordbot {
     std::shared_ptr<dotnamebot::v1::EmojiModuleLib> emojiModuleLib_;
     std::shared_ptr<dotnamebot::rss::IRssService> rssService_;
     std::shared_ptr<dotnamebot::namegen::NameGen> nameGen_;
+    std::shared_ptr<dotnamebot::crypto::CryptoUtils> cryptoUtils_;
 
     std::function<void()> onStopRequested_;
 
@@ -0,0 +1,128 @@
+#include "HttpClient.hpp"
+
+namespace dotnamebot::http {
+
+  namespace {
+    std::once_flag curlGlobalInitFlag;
+  } // namespace
+
+  HttpClient::HttpClient(size_t maxIdleHandles) : maxIdleHandles_(maxIdleHandles) {
+    // curl_global_init is not thread-safe; make sure it runs before any worker touches curl
+    std::call_once(curlGlobalInitFlag, []() { curl_global_init(CURL_GLOBAL_DEFAULT); });
+
+    share_ = curl_share_init();
+    if (share_ != nullptr) {
+      curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, HttpClient::lockShare);
+      curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, HttpClient::unlockShare);
+      curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+      curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+      curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+      // Connections are not shared: libcurl does not support a shared connection cache used
+      // from several threads at once. A multi handle keeps its own, and an idle easy handle
+      // keeps the connections of its last blocking transfer.
+    }
+  }
+
+  HttpClient::~HttpClient() {
+    // Easy handles must be gone before the share they are attached to
+    for (CURL *handle : idleHandles_) {
+      curl_easy_cleanup(handle);
+    }
+    idleHandles_.clear();
+    if (share_ != nullptr) {
+      curl_share_cleanup(share_);
+    }
+  }
+
+  CURL *HttpClient::acquireHandle() {
+    CURL *handle = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(poolMutex_);
+      if (!idleHandles_.empty()) {
+        handle = idleHandles_.back();
+        idleHandles_.pop_back();
+      }
+    }
+    if (handle == nullptr) {
+      handle = curl_easy_init();
+      if (handle == nullptr) {
+        return nullptr;
+      }
+    }
+    if (share_ != nullptr) {
+      curl_easy_setopt(handle, CURLOPT_SHARE, share_);
+    }
+    return handle;
+  }
+
+  void HttpClient::releaseHandle(CURL *handle) {
+    if (handle == nullptr) {
+      return;
+    }
+    // Reset drops all options but keeps live connections and caches
+    curl_easy_reset(handle);
+    {
+      std::lock_guard<std::mutex> lock(poolMutex_);
+      if (idleHandles_.size() < maxIdleHandles_) {
+        idleHandles_.push_back(handle);
+        return;
+      }
+    }
+    curl_easy_cleanup(handle);
+  }
+
+  HttpResponse HttpClient::get(const std::string &url, const HttpRequestOptions &options) {
+    HttpResponse response;
+    CURL *curl = acquireHandle();
+    if (curl == nullptr) {
+      response.error = "curl_easy_init failed";
+      return response;
+    }
+
+    struct curl_slist *headers = nullptr;
+    for (const auto &header : options.headers) {
+      headers = curl_slist_append(headers, header.c_str());
+    }
+
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, HttpClient::writeCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response.body);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, options.timeoutSeconds);
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, options.connectTimeoutSeconds);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, options.userAgent.c_str());
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+
+    const CURLcode res = curl_easy_perform(curl);
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response.status);
+
+    releaseHandle(curl);
+    curl_slist_free_all(headers);
+
+    if (res != CURLE_OK) {
+      response.error = curl_easy_strerror(res);
+      response.body.clear();
+    }
+    return response;
+  }
+
+  void HttpClient::lockShare(CURL * /*handle*/, curl_lock_data data, curl_lock_access /*access*/,
+                             void *userp) {
+    auto *self = static_cast<HttpClient *>(userp);
+    self->shareLocks_[static_cast<size_t>(data) % self->shareLocks_.size()].lock();
+  }
+
+  void HttpClient::unlockShare(CURL * /*handle*/, curl_lock_data data, void *userp) {
+    auto *self = static_cast<HttpClient *>(userp);
+    self->shareLocks_[static_cast<size_t>(data) % self->shareLocks_.size()].unlock();
+  }
+
+  size_t HttpClient::writeCallback(void *contents, size_t size, size_t nmemb, void *userp) {
+    static_cast<std::string *>(userp)->append(static_cast<char *>(contents), size * nmemb);
+    return size * nmemb;
+  }
+
+} // namespace dotnamebot::http
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Http/IHttpClient.hpp>
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace dotnamebot::http {
+
+  class HttpClient : public IHttpClient {
+  public:
+    /**
+     * @brief Construct a new Http Client object
+     *
+     * @param maxIdleHandles Upper bound of easy handles kept for reuse
+     */
+    explicit HttpClient(size_t maxIdleHandles = 32);
+    ~HttpClient() override;
+
+    HttpClient(const HttpClient &) = delete;
+    HttpClient &operator=(const HttpClient &) = delete;
+    HttpClient(HttpClient &&) = delete;
+    HttpClient &operator=(HttpClient &&) = delete;
+
+    [[nodiscard]]
+    HttpResponse get(const std::string &url, const HttpRequestOptions &options = {}) override;
+
+    [[nodiscard]]
+    CURL *acquireHandle() override;
+
+    void releaseHandle(CURL *handle) override;
+
+  private:
+    static void lockShare(CURL *handle, curl_lock_data data, curl_lock_access access, void *userp);
+    static void unlockShare(CURL *handle, curl_lock_data data, void *userp);
+    static size_t writeCallback(void *contents, size_t size, size_t nmemb, void *userp);
+
+    CURLSH *share_{nullptr};
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> shareLocks_;
+
+    std::mutex poolMutex_;
+    std::vector<CURL *> idleHandles_;
+    size_t maxIdleHandles_;
+  };
+
+} // namespace dotnamebot::http
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <curl/curl.h>
+#include <string>
+#include <vector>
+
+namespace dotnamebot::http {
+
+  /**
+   * @brief Per-request settings for IHttpClient::get
+   *
+   */
+  struct HttpRequestOptions {
+    std::string userAgent{"DotNameBot/1.0"};
+    long timeoutSeconds{10};
+    long connectTimeoutSeconds{5};
+    std::vector<std::string> headers;
+  };
+
+  /**
+   * @brief Result of a blocking IHttpClient::get
+   *
+   */
+  struct HttpResponse {
+    long status{0};
+    std::string body;
+    std::string error;
+
+    [[nodiscard]] bool ok() const { return error.empty() && status < 400; }
+  };
+
+  /**
+   * @brief Interface for the shared HTTP client
+   *
+   * All easy handles handed out share one DNS cache and TLS session cache. Keep-alive
+   * connections are reused per multi handle, and per pooled easy handle for get().
+   */
+  class IHttpClient {
+  public:
+    virtual ~IHttpClient() = default;
+
+    /**
+     * @brief Perform a blocking GET request
+     *
+     * @param url The URL to fetch
+     * @param options Request settings
+     * @return HttpResponse
+     */
+    [[nodiscard]]
+    virtual HttpResponse get(const std::string &url, const HttpRequestOptions &options = {}) = 0;
+
+    /**
+     * @brief Borrow a reset easy handle attached to the shared caches
+     *
+     * The caller configures and performs the transfer itself (e.g. on a multi handle)
+     * and must hand the handle back with releaseHandle().
+     *
+     * @return CURL* or nullptr on failure
+     */
+    [[nodiscard]]
+    virtual CURL *acquireHandle() = 0;
+
+    /**
+     * @brief Return a handle obtained from acquireHandle() to the pool
+     *
+     * @param handle The handle to return
+     */
+    virtual void releaseHandle(CURL *handle) = 0;
+  };
+
+} // namespace dotnamebot::http
@@ -0,0 +1,102 @@
+#include "FeedCache.hpp"
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <system_error>
+#include <unordered_set>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    constexpr const char *CACHE_EXTENSION = ".feed";
+
+    std::string toHex(uint64_t value) {
+      std::array<char, 17> buffer{};
+      std::snprintf(buffer.data(), buffer.size(), "%llx",
+                    static_cast<unsigned long long>(value));
+      return buffer.data();
+    }
+
+  } // namespace
+
+  std::string BodyHash::hex() const {
+    if (size_ == 0) {
+      return "";
+    }
+    return toHex(value_) + "-" + toHex(size_);
+  }
+
+  FeedCache::FeedCache(std::filesystem::path directory) : directory_(std::move(directory)) {}
+
+  std::filesystem::path FeedCache::pathFor(const std::string &url) const {
+    BodyHash hash;
+    hash.update(url);
+    return directory_ / (toHex(hash.value()) + CACHE_EXTENSION);
+  }
+
+  bool FeedCache::store(const std::string &url, std::string_view body) const {
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec) {
+      return false;
+    }
+
+    // Write next to the target and rename, so a crash never leaves half a body behind
+    const std::filesystem::path target = pathFor(url);
+    std::filesystem::path temporary = target;
+    temporary += ".tmp";
+    {
+      std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+      if (!file.is_open()) {
+        return false;
+      }
+      file.write(body.data(), static_cast<std::streamsize>(body.size()));
+      if (!file) {
+        return false;
+      }
+    }
+    std::filesystem::rename(temporary, target, ec);
+    return !ec;
+  }
+
+  bool FeedCache::load(const std::string &url, std::string &body) const {
+    const std::filesystem::path path = pathFor(url);
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+      return false;
+    }
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+      return false;
+    }
+    body.resize(size);
+    file.read(body.data(), static_cast<std::streamsize>(size));
+    return static_cast<bool>(file);
+  }
+
+  size_t FeedCache::prune(const std::vector<RSSUrl> &urls) const {
+    std::error_code ec;
+    if (!std::filesystem::is_directory(directory_, ec)) {
+      return 0;
+    }
+    std::unordered_set<std::string> keep;
+    for (const auto &rssUrl : urls) {
+      keep.insert(pathFor(rssUrl.url).filename().string());
+    }
+
+    size_t removed = 0;
+    for (const auto &entry : std::filesystem::directory_iterator(directory_, ec)) {
+      const std::string name = entry.path().filename().string();
+      if (entry.path().extension() == CACHE_EXTENSION && !keep.contains(name)) {
+        if (std::filesystem::remove(entry.path(), ec)) {
+          removed++;
+        }
+      }
+    }
+    return removed;
+  }
+
+} // namespace dotnamebot::rss
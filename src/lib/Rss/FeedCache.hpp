@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Rss/RSSUrl.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Incremental 64-bit FNV-1a hash of a response body.
+   *
+   * Fed chunk by chunk from the curl write callback, so the digest is ready when the
+   * transfer ends without the body ever being held in one piece. Only compared against
+   * the previous body of the same feed, where 64 bits are plenty.
+   */
+  class BodyHash {
+  public:
+    void update(std::string_view chunk) {
+      for (unsigned char byte : chunk) {
+        value_ ^= byte;
+        value_ *= PRIME;
+      }
+      size_ += chunk.size();
+    }
+
+    [[nodiscard]] uint64_t value() const { return value_; }
+    [[nodiscard]] uint64_t size() const { return size_; }
+
+    /**
+     * @brief Digest as stored in rssFeedState.json: hash and body length in hex
+     *
+     * @return std::string e.g. "cbf29ce484222325-1f4"; empty for an empty body
+     */
+    [[nodiscard]] std::string hex() const;
+
+  private:
+    static constexpr uint64_t OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    static constexpr uint64_t PRIME = 0x100000001b3ULL;
+
+    uint64_t value_{OFFSET_BASIS};
+    uint64_t size_{0};
+  };
+
+  /**
+   * @brief On-disk copies of the last body of every feed, one file per feed URL.
+   *
+   * Lets a restart refill the item buffer from the bodies seen before shutdown, without
+   * waiting for the network, and primes the feeds for conditional GET right away.
+   */
+  class FeedCache {
+  public:
+    explicit FeedCache(std::filesystem::path directory = {});
+
+    void setDirectory(std::filesystem::path directory) { directory_ = std::move(directory); }
+    [[nodiscard]] const std::filesystem::path &getDirectory() const { return directory_; }
+
+    /**
+     * @brief Replace the cached body of a feed
+     *
+     * @param url RSSUrl::url of the feed
+     * @param body Raw body as downloaded
+     * @return true on success, false on failure
+     */
+    bool store(const std::string &url, std::string_view body) const;
+
+    /**
+     * @brief Read the cached body of a feed
+     *
+     * @param url RSSUrl::url of the feed
+     * @param body Receives the body
+     * @return true if a cached body was found and read, otherwise false
+     */
+    bool load(const std::string &url, std::string &body) const;
+
+    /**
+     * @brief Delete cached bodies of feeds that are no longer configured
+     *
+     * @param urls Configured feeds
+     * @return size_t Number of files removed
+     */
+    size_t prune(const std::vector<RSSUrl> &urls) const;
+
+    /**
+     * @brief Cache file of a feed: a hash of the URL, so any URL maps to a safe file name
+     *
+     * @param url RSSUrl::url of the feed
+     * @return std::filesystem::path
+     */
+    [[nodiscard]] std::filesystem::path pathFor(const std::string &url) const;
+
+  private:
+    std::filesystem::path directory_;
+  };
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <string_view>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Parses an item date as found in RSS and Atom feeds.
+   *
+   * Tries RFC 822 ("Mon, 07 May 2026 10:00:00 +0000") then ISO 8601 ("2026-05-07T10:00:00Z")
+   * and a bare date. The wall clock is read as UTC and any zone offset is ignored, which is
+   * close enough for ordering items and estimating how often a feed publishes.
+   *
+   * @param date The pubDate / updated / published text
+   * @return time_t Seconds since the epoch, or 0 when unparseable
+   */
+  inline time_t parseFeedDate(std::string_view date) {
+    if (date.empty()) {
+      return 0;
+    }
+    // strptime wants a terminated string; dates fit on the stack, odd long values are copied
+    char buffer[64];
+    std::string copy;
+    const char *s = buffer;
+    if (date.size() < sizeof(buffer)) {
+      std::memcpy(buffer, date.data(), date.size());
+      buffer[date.size()] = '\0';
+    } else {
+      copy.assign(date);
+      s = copy.c_str();
+    }
+    std::tm tm{};
+    if (strptime(s, "%a, %d %b %Y %H:%M:%S", &tm) != nullptr) {
+      return timegm(&tm);
+    }
+    tm = {};
+    if (strptime(s, "%Y-%m-%dT%H:%M:%S", &tm) != nullptr) {
+      return timegm(&tm);
+    }
+    tm = {};
+    if (strptime(s, "%Y-%m-%d", &tm) != nullptr) {
+      return timegm(&tm);
+    }
+    return 0;
+  }
+
+} // namespace dotnamebot::rss
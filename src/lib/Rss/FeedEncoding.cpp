@@ -0,0 +1,150 @@
+#include "FeedEncoding.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <unordered_map>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    const auto INVALID_CONVERTER = reinterpret_cast<iconv_t>(-1);
+    constexpr std::string_view UTF8_BOM = "\xEF\xBB\xBF";
+    constexpr std::string_view XML_DECLARATION = "<?xml";
+    constexpr std::string_view ENCODING_ATTRIBUTE = "encoding";
+    // Give up looking for the end of an XML declaration after this many bytes
+    constexpr size_t MAX_PROLOG_BYTES = 1024;
+
+    bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+    // Whether more bytes could still turn text into token
+    bool isPrefixOf(std::string_view text, std::string_view token) {
+      return text.size() < token.size() && token.starts_with(text);
+    }
+
+    bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+      return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](char x, char y) {
+        return std::tolower(static_cast<unsigned char>(x)) ==
+               std::tolower(static_cast<unsigned char>(y));
+      });
+    }
+
+    size_t skipSpaces(std::string_view text, size_t pos) {
+      while (pos < text.size() && isSpace(text[pos])) {
+        pos++;
+      }
+      return pos;
+    }
+
+    // Descriptors of one thread, closed when the thread ends
+    struct ConverterCache {
+      std::unordered_map<std::string, iconv_t> converters;
+
+      ConverterCache() = default;
+      ConverterCache(const ConverterCache &) = delete;
+      ConverterCache &operator=(const ConverterCache &) = delete;
+
+      ~ConverterCache() {
+        for (const auto &[encoding, converter] : converters) {
+          if (converter != INVALID_CONVERTER) {
+            iconv_close(converter);
+          }
+        }
+      }
+    };
+
+  } // namespace
+
+  XmlProlog scanXmlProlog(std::string_view document, bool final) {
+    XmlProlog prolog;
+    if (document.starts_with(UTF8_BOM)) {
+      prolog.bomSize = UTF8_BOM.size();
+    } else if (!final && isPrefixOf(document, UTF8_BOM)) {
+      prolog.incomplete = true;
+      return prolog;
+    }
+
+    const size_t start = skipSpaces(document, prolog.bomSize);
+    const std::string_view rest = document.substr(start);
+    if (!rest.starts_with(XML_DECLARATION)) {
+      prolog.incomplete = !final && isPrefixOf(rest, XML_DECLARATION);
+      return prolog;
+    }
+    const size_t end = rest.substr(0, MAX_PROLOG_BYTES).find("?>");
+    if (end == std::string_view::npos) {
+      prolog.incomplete = !final && rest.size() < MAX_PROLOG_BYTES;
+      return prolog;
+    }
+
+    // encoding S? = S? ("..." | '...'); anything malformed counts as undeclared
+    const std::string_view declaration = rest.substr(0, end);
+    size_t pos = declaration.find(ENCODING_ATTRIBUTE);
+    if (pos == std::string_view::npos) {
+      return prolog;
+    }
+    pos = skipSpaces(declaration, pos + ENCODING_ATTRIBUTE.size());
+    if (pos >= declaration.size() || declaration[pos] != '=') {
+      return prolog;
+    }
+    pos = skipSpaces(declaration, pos + 1);
+    if (pos >= declaration.size() || (declaration[pos] != '"' && declaration[pos] != '\'')) {
+      return prolog;
+    }
+    const size_t close = declaration.find(declaration[pos], pos + 1);
+    if (close == std::string_view::npos) {
+      return prolog;
+    }
+    prolog.encoding = declaration.substr(pos + 1, close - pos - 1);
+    prolog.encodingAt = start + pos + 1;
+    return prolog;
+  }
+
+  bool isUtf8Compatible(std::string_view encoding) {
+    return encoding.empty() || equalsIgnoreCase(encoding, "UTF-8") ||
+           equalsIgnoreCase(encoding, "UTF8") || equalsIgnoreCase(encoding, "US-ASCII") ||
+           equalsIgnoreCase(encoding, "ASCII");
+  }
+
+  iconv_t cachedUtf8Converter(std::string_view encoding) {
+    thread_local ConverterCache cache;
+    std::string key(encoding);
+    std::transform(key.begin(), key.end(), key.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    auto it = cache.converters.find(key);
+    if (it == cache.converters.end()) {
+      // Unknown encodings are remembered too, so they are not looked up again every time
+      const iconv_t converter = iconv_open("UTF-8", key.c_str());
+      it = cache.converters.emplace(std::move(key), converter).first;
+    }
+    return it->second;
+  }
+
+  bool appendAsUtf8(iconv_t converter, std::string_view bytes, std::string &out) {
+    iconv(converter, nullptr, nullptr, nullptr, nullptr);
+
+    const char *in = bytes.data();
+    size_t inLeft = bytes.size();
+    size_t used = out.size();
+    // Feeds in single-byte charsets are mostly ASCII markup, so the text hardly grows;
+    // start with a small margin and extend the buffer whenever iconv runs out of room
+    size_t room = inLeft + (inLeft / 8) + 64;
+    while (true) {
+      out.resize(used + room);
+      char *outPtr = out.data() + used;
+      size_t outLeft = room;
+      const size_t rc = iconv(converter, const_cast<char **>(&in), &inLeft, &outPtr, &outLeft);
+      used += room - outLeft;
+      if (rc != static_cast<size_t>(-1)) {
+        out.resize(used);
+        return true;
+      }
+      if (errno != E2BIG) {
+        out.resize(used);
+        return false;
+      }
+      room = (inLeft * 2) + 64;
+    }
+  }
+
+} // namespace dotnamebot::rss
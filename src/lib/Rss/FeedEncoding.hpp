@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <iconv.h>
+#include <string>
+#include <string_view>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief What the start of a document says about its encoding: a UTF-8 byte order mark
+   * and the encoding attribute of the XML declaration.
+   *
+   */
+  struct XmlProlog {
+    // Length of a leading UTF-8 BOM, 0 when there is none
+    size_t bomSize{0};
+    // Value of encoding="..." in the XML declaration, empty when not declared
+    std::string_view encoding;
+    // Offset of that value in the document, npos when not declared
+    size_t encodingAt{std::string_view::npos};
+    // More bytes are needed before the prolog can be judged
+    bool incomplete{false};
+  };
+
+  /**
+   * @brief Read the BOM and the XML declaration, e.g.
+   * <?xml version="1.0" encoding="windows-1250"?>, without looking any further into the
+   * document. A declaration has to end within the first kilobyte to count.
+   *
+   * @param document Start of the raw document
+   * @param final Whether no more bytes will follow; if not, a start that may still grow into
+   * a BOM or a declaration leaves the result incomplete
+   * @return XmlProlog Views into document
+   */
+  XmlProlog scanXmlProlog(std::string_view document, bool final = true);
+
+  /**
+   * @brief Whether text in this encoding can be read as UTF-8 without transcoding
+   *
+   * @param encoding Declared encoding, any case; empty means undeclared, i.e. UTF-8
+   * @return true for UTF-8 and ASCII, otherwise false
+   */
+  bool isUtf8Compatible(std::string_view encoding);
+
+  /**
+   * @brief iconv descriptor from an encoding to UTF-8. Descriptors are opened once per
+   * thread and encoding and reused for every later document; the caller must not close it.
+   *
+   * @param encoding Declared encoding, any case
+   * @return iconv_t The descriptor, or (iconv_t)-1 when iconv does not know the encoding
+   */
+  iconv_t cachedUtf8Converter(std::string_view encoding);
+
+  /**
+   * @brief Transcode a complete text with a descriptor from cachedUtf8Converter(), growing
+   * the output as needed instead of reserving for the worst case up front
+   *
+   * @param converter Descriptor to UTF-8; its shift state is reset first
+   * @param bytes Text in the source encoding
+   * @param out Receives the UTF-8 text, appended to what it already holds
+   * @return true on success, false on an invalid or truncated sequence
+   */
+  bool appendAsUtf8(iconv_t converter, std::string_view bytes, std::string &out);
+
+} // namespace dotnamebot::rss
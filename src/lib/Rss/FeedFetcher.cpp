@@ -0,0 +1,368 @@
+#include "FeedFetcher.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <curl/curl.h>
+#include <numeric>
+#include <string_view>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    // Pause used for a 429 / 503 without a usable Retry-After, and the longest pause honoured
+    constexpr curl_off_t DEFAULT_RETRY_AFTER_SECONDS = 60;
+    constexpr curl_off_t MAX_RETRY_AFTER_SECONDS = 6 * 3600;
+
+    // Per-transfer bookkeeping, addressed through CURLOPT_PRIVATE
+    struct Transfer {
+      size_t index{0};
+      const FeedRequest *request{nullptr};
+      FeedResponse *response{nullptr};
+      CURL *easy{nullptr};
+      struct curl_slist *headers{nullptr};
+      // Content-Length of the current response, -1 when not sent
+      curl_off_t contentLength{-1};
+      // Decoded body bytes delivered so far, and their running hash
+      size_t received{0};
+      BodyHash hash;
+    };
+
+    bool headerNameEquals(std::string_view line, std::string_view name) {
+      if (line.size() <= name.size() || line[name.size()] != ':') {
+        return false;
+      }
+      return std::equal(name.begin(), name.end(), line.begin(), [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) ==
+               std::tolower(static_cast<unsigned char>(b));
+      });
+    }
+
+    std::string oversizedError(size_t limit) {
+      return "feed body exceeds the limit of " + std::to_string(limit) + " bytes";
+    }
+
+    std::string headerValue(std::string_view line, std::string_view name) {
+      std::string_view value = line.substr(name.size() + 1);
+      while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+        value.remove_prefix(1);
+      }
+      while (!value.empty() && (value.back() == '\r' || value.back() == '\n' ||
+                                value.back() == ' ' || value.back() == '\t')) {
+        value.remove_suffix(1);
+      }
+      return std::string(value);
+    }
+
+  } // namespace
+
+  FeedFetcher::FeedFetcher(std::shared_ptr<dotnamebot::logging::ILogger> logger,
+                           std::shared_ptr<dotnamebot::http::IHttpClient> httpClient,
+                           size_t maxParallel)
+      : logger_(std::move(logger)), httpClient_(std::move(httpClient)),
+        maxParallel_(maxParallel > 0 ? maxParallel : 1) {}
+
+  std::vector<FeedResponse> FeedFetcher::fetchAll(const std::vector<FeedRequest> &requests) {
+    std::vector<FeedResponse> responses(requests.size());
+    fetchEach(requests, [&responses](size_t index, FeedResponse &&response) {
+      responses[index] = std::move(response);
+    });
+    return responses;
+  }
+
+  void FeedFetcher::fetchEach(const std::vector<FeedRequest> &requests,
+                              const ResponseHandler &onResponse) {
+    std::vector<FeedResponse> responses(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+      responses[i].url = requests[i].url;
+    }
+    if (requests.empty()) {
+      return;
+    }
+
+    CURLM *multi = curl_multi_init();
+    if (multi == nullptr) {
+      for (size_t i = 0; i < responses.size(); ++i) {
+        responses[i].error = "curl_multi_init failed";
+        onResponse(i, std::move(responses[i]));
+      }
+      return;
+    }
+
+    std::vector<Transfer> transfers(requests.size());
+    std::vector<size_t> pending(requests.size());
+    std::iota(pending.begin(), pending.end(), 0);
+    size_t inFlight = 0;
+
+    auto hostOf = [&requests](size_t index) -> const std::string & {
+      return requests[index].host.empty() ? requests[index].url : requests[index].host;
+    };
+
+    auto startTransfer = [&](size_t index) -> void {
+      Transfer &transfer = transfers[index];
+      transfer.index = index;
+      transfer.request = &requests[index];
+      transfer.response = &responses[index];
+      transfer.easy = httpClient_->acquireHandle();
+      if (transfer.easy == nullptr) {
+        responses[index].error = "no HTTP handle available";
+        limiter_.release(hostOf(index));
+        onResponse(index, std::move(responses[index]));
+        return;
+      }
+
+      CURL *curl = transfer.easy;
+      // Atom and JSON Feed are parsed too; servers that negotiate still prefer the XML formats
+      transfer.headers = curl_slist_append(
+          nullptr, "Accept: application/rss+xml, application/atom+xml, application/xml;q=0.9, "
+                   "text/xml;q=0.9, application/feed+json;q=0.8, application/json;q=0.7");
+      if (requests[index].etag.empty() && requests[index].lastModified.empty()) {
+        // Without validators a cached copy could be older than what we merged last time. A
+        // conditional GET lets caches in front of the feed answer from a fresh copy.
+        transfer.headers = curl_slist_append(transfer.headers, "Cache-Control: no-cache");
+      }
+      if (!requests[index].etag.empty()) {
+        transfer.headers = curl_slist_append(
+            transfer.headers, ("If-None-Match: " + requests[index].etag).c_str());
+      }
+      if (!requests[index].lastModified.empty()) {
+        transfer.headers = curl_slist_append(
+            transfer.headers, ("If-Modified-Since: " + requests[index].lastModified).c_str());
+      }
+      curl_easy_setopt(curl, CURLOPT_HTTPHEADER, transfer.headers);
+      curl_easy_setopt(curl, CURLOPT_URL, requests[index].url.c_str());
+      curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, FeedFetcher::WriteCallback);
+      curl_easy_setopt(curl, CURLOPT_WRITEDATA, &transfer);
+      curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, FeedFetcher::HeaderCallback);
+      curl_easy_setopt(curl, CURLOPT_HEADERDATA, &transfer);
+      curl_easy_setopt(curl, CURLOPT_PRIVATE, &transfer);
+      curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+      curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
+      curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
+      curl_easy_setopt(
+          curl, CURLOPT_USERAGENT,
+          "DotNameBot RSS Reader by DotName: https://github.com/tomasmark79/DotNameBot");
+      curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);
+      curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
+      curl_easy_setopt(curl, CURLOPT_ENCODING, "");
+      curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+      if (requests[index].maxBodyBytes > 0) {
+        // Lets curl refuse an announced oversized body before any of it is received
+        curl_easy_setopt(curl, CURLOPT_MAXFILESIZE_LARGE,
+                         static_cast<curl_off_t>(requests[index].maxBodyBytes));
+      }
+
+      if (curl_multi_add_handle(multi, curl) != CURLM_OK) {
+        responses[index].error = "curl_multi_add_handle failed";
+        limiter_.release(hostOf(index));
+        httpClient_->releaseHandle(curl);
+        curl_slist_free_all(transfer.headers);
+        transfer.headers = nullptr;
+        transfer.easy = nullptr;
+        onResponse(index, std::move(responses[index]));
+        return;
+      }
+      ++inFlight;
+    };
+
+    // Start pending requests in order, skipping hosts that are out of tokens or slots
+    auto fillSlots = [&]() -> void {
+      const auto now = HostRateLimiter::Clock::now();
+      size_t kept = 0;
+      for (size_t index : pending) {
+        const std::string &host = hostOf(index);
+        if (limiter_.isPaused(host, now)) {
+          // The server asked us to back off; do not hold the whole refresh for it
+          auto left = std::chrono::ceil<std::chrono::seconds>(limiter_.pausedUntil(host) - now);
+          responses[index].error =
+              "host paused by Retry-After for another " + std::to_string(left.count()) + " s";
+          responses[index].retryAfterSeconds = static_cast<long>(left.count());
+          onResponse(index, std::move(responses[index]));
+        } else if (inFlight < maxParallel_ && limiter_.tryAcquire(host, now)) {
+          startTransfer(index);
+        } else {
+          pending[kept++] = index;
+        }
+      }
+      pending.resize(kept);
+    };
+
+    // How long to wait for curl activity: when requests are held back by empty buckets,
+    // wake up as soon as the first token is available. Requests waiting for a free slot, of
+    // the refresh or of their host, are started after a finishing transfer wakes the poll.
+    auto pollTimeoutMs = [&]() -> int {
+      int timeoutMs = 1000;
+      if (inFlight >= maxParallel_) {
+        return timeoutMs;
+      }
+      const auto now = HostRateLimiter::Clock::now();
+      for (size_t index : pending) {
+        const auto tokenAt = limiter_.nextTokenAt(hostOf(index), now);
+        if (tokenAt <= now) {
+          continue;
+        }
+        auto wait = std::chrono::ceil<std::chrono::milliseconds>(tokenAt - now);
+        timeoutMs = std::clamp(static_cast<int>(wait.count()), 1, timeoutMs);
+      }
+      return timeoutMs;
+    };
+
+    fillSlots();
+    while (inFlight > 0 || !pending.empty()) {
+      int running = 0;
+      if (curl_multi_perform(multi, &running) != CURLM_OK) {
+        logger_->error("curl_multi_perform failed, aborting feed downloads");
+        break;
+      }
+
+      int queued = 0;
+      while (CURLMsg *msg = curl_multi_info_read(multi, &queued)) {
+        if (msg->msg != CURLMSG_DONE) {
+          continue;
+        }
+        CURL *curl = msg->easy_handle;
+        char *privateData = nullptr;
+        curl_easy_getinfo(curl, CURLINFO_PRIVATE, &privateData);
+        auto *transfer = reinterpret_cast<Transfer *>(privateData);
+        FeedResponse &response = responses[transfer->index];
+
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response.httpCode);
+        curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME, &response.elapsedSeconds);
+        response.bodyBytes = transfer->received;
+        const std::string &host = hostOf(transfer->index);
+        limiter_.release(host);
+        if (response.httpCode == 429 || response.httpCode == 503) {
+          // curl parses both forms of Retry-After (delta seconds and HTTP date)
+          curl_off_t retryAfter = 0;
+          curl_easy_getinfo(curl, CURLINFO_RETRY_AFTER, &retryAfter);
+          response.retryAfterSeconds = static_cast<long>(
+              std::clamp<curl_off_t>(retryAfter > 0 ? retryAfter : DEFAULT_RETRY_AFTER_SECONDS,
+                                     1, MAX_RETRY_AFTER_SECONDS));
+          if (respectRetryAfter_) {
+            limiter_.pauseUntil(host, HostRateLimiter::Clock::now() +
+                                          std::chrono::seconds(response.retryAfterSeconds));
+          }
+        }
+        if (response.oversized || msg->data.result == CURLE_FILESIZE_EXCEEDED) {
+          response.oversized = true;
+          response.error = oversizedError(requests[transfer->index].maxBodyBytes);
+          response.body.clear();
+          response.body.shrink_to_fit();
+        } else if (msg->data.result != CURLE_OK) {
+          response.error = curl_easy_strerror(msg->data.result);
+          response.body.clear();
+        } else if (response.httpCode >= 400) {
+          response.error = "HTTP " + std::to_string(response.httpCode);
+          response.body.clear();
+        } else if (response.httpCode != 304) {
+          response.bodyHash = transfer->hash.hex();
+        } else {
+          // Not modified: the server echoes validators at most, keep the ones we sent
+          const FeedRequest &request = requests[transfer->index];
+          if (response.etag.empty()) {
+            response.etag = request.etag;
+          }
+          if (response.lastModified.empty()) {
+            response.lastModified = request.lastModified;
+          }
+        }
+
+        curl_multi_remove_handle(multi, curl);
+        httpClient_->releaseHandle(curl);
+        curl_slist_free_all(transfer->headers);
+        transfer->headers = nullptr;
+        transfer->easy = nullptr;
+        --inFlight;
+        onResponse(transfer->index, std::move(response));
+      }
+
+      fillSlots();
+      if (inFlight > 0 || !pending.empty()) {
+        // With no transfers in flight this simply sleeps for the timeout
+        curl_multi_poll(multi, nullptr, 0, pollTimeoutMs(), nullptr);
+      }
+    }
+
+    // Only reached with transfers left on a hard multi failure
+    for (auto &transfer : transfers) {
+      if (transfer.easy != nullptr) {
+        responses[transfer.index].error = "transfer aborted";
+        responses[transfer.index].body.clear();
+        limiter_.release(hostOf(transfer.index));
+        curl_multi_remove_handle(multi, transfer.easy);
+        httpClient_->releaseHandle(transfer.easy);
+        curl_slist_free_all(transfer.headers);
+        onResponse(transfer.index, std::move(responses[transfer.index]));
+      }
+    }
+    for (size_t index : pending) {
+      responses[index].error = "transfer not started";
+      onResponse(index, std::move(responses[index]));
+    }
+    curl_multi_cleanup(multi);
+  }
+
+  size_t FeedFetcher::WriteCallback(void *contents, size_t size, size_t nmemb, void *userp) {
+    auto *transfer = static_cast<Transfer *>(userp);
+    const std::string_view chunk(static_cast<char *>(contents), size * nmemb);
+    const size_t limit = transfer->request->maxBodyBytes;
+
+    // Content-Length is the size on the wire; with compression the decoded body is
+    // usually larger, so it serves as an early rejection and a reservation hint only
+    if (transfer->received == 0 && transfer->contentLength > 0) {
+      const auto announced = static_cast<size_t>(transfer->contentLength);
+      if (limit > 0 && announced > limit) {
+        transfer->response->oversized = true;
+        return 0;
+      }
+      if (!transfer->request->onData) {
+        transfer->response->body.reserve(announced);
+      }
+    }
+
+    // Returning less than the chunk size makes curl fail the transfer (CURLE_WRITE_ERROR)
+    if (limit > 0 && chunk.size() > limit - std::min(limit, transfer->received)) {
+      transfer->response->oversized = true;
+      return 0;
+    }
+    transfer->received += chunk.size();
+    transfer->hash.update(chunk);
+    if (transfer->request->onData) {
+      return transfer->request->onData(chunk) ? chunk.size() : 0;
+    }
+    transfer->response->body.append(chunk);
+    return chunk.size();
+  }
+
+  size_t FeedFetcher::HeaderCallback(char *buffer, size_t size, size_t nitems, void *userp) {
+    auto *transfer = static_cast<Transfer *>(userp);
+    FeedResponse *response = transfer->response;
+    const std::string_view line(buffer, size * nitems);
+
+    // A new status line starts a new response (redirect hop), forget earlier headers
+    if (line.rfind("HTTP/", 0) == 0) {
+      response->etag.clear();
+      response->lastModified.clear();
+      response->contentType.clear();
+      transfer->contentLength = -1;
+    } else if (headerNameEquals(line, "content-length")) {
+      const std::string value = headerValue(line, "content-length");
+      const auto *end = value.data() + value.size();
+      curl_off_t length = -1;
+      if (std::from_chars(value.data(), end, length).ptr != end) {
+        length = -1;
+      }
+      transfer->contentLength = length;
+    } else if (headerNameEquals(line, "etag")) {
+      response->etag = headerValue(line, "etag");
+    } else if (headerNameEquals(line, "last-modified")) {
+      response->lastModified = headerValue(line, "last-modified");
+    } else if (headerNameEquals(line, "content-type")) {
+      response->contentType = headerValue(line, "content-type");
+    }
+    return size * nitems;
+  }
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <Http/IHttpClient.hpp>
+#include <Rss/FeedCache.hpp>
+#include <Rss/HostRateLimiter.hpp>
+#include <Utils/Logger/ILogger.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief A single feed download scheduled on the FeedFetcher.
+   *
+   */
+  struct FeedRequest {
+    std::string url;
+    // Politeness group for the per-host limits; the URL itself when empty
+    std::string host;
+    // Validators from the previous response; when set the request becomes a conditional GET
+    std::string etag;
+    std::string lastModified;
+    // Optional sink for body chunks as they arrive. When set the body is not collected in
+    // FeedResponse::body; returning false aborts the transfer.
+    std::function<bool(std::string_view chunk)> onData;
+    // Largest body accepted, in decoded bytes; 0 means unlimited. Bigger transfers are
+    // aborted as soon as Content-Length or the received data exceeds it.
+    size_t maxBodyBytes{0};
+  };
+
+  /**
+   * @brief Outcome of a single feed download.
+   *
+   */
+  struct FeedResponse {
+    std::string url;
+    std::string body;
+    long httpCode{0};
+    std::string etag;
+    std::string lastModified;
+    // Content-Type header, a hint for telling feed formats apart
+    std::string contentType;
+    std::string error;
+    double elapsedSeconds{0.0};
+    // Pause requested by the server with a 429 / 503 Retry-After, in seconds
+    long retryAfterSeconds{0};
+    // The body exceeded FeedRequest::maxBodyBytes and the transfer was aborted
+    bool oversized{false};
+    // Decoded body bytes received, also when they went to FeedRequest::onData
+    size_t bodyBytes{0};
+    // BodyHash::hex() of the body, hashed while it arrived (also in streaming mode)
+    std::string bodyHash;
+
+    [[nodiscard]] bool ok() const { return error.empty(); }
+    [[nodiscard]] bool notModified() const { return ok() && httpCode == 304; }
+  };
+
+  /**
+   * @brief Downloads many feeds concurrently on a single curl multi handle.
+   *
+   * All transfers are driven from the calling thread; at most maxParallel of them
+   * are in flight at any time, so a slow host only delays its own feed. Easy handles
+   * are borrowed from the shared HTTP client, so connections survive between refreshes.
+   *
+   * Requests are also limited per host (token bucket plus a concurrency cap), so many
+   * feeds on one server are spread out instead of hitting it at once. A host answering
+   * 429 / 503 is paused for its Retry-After; its remaining requests fail fast meanwhile.
+   *
+   * Buffered bodies are reserved up front from Content-Length, and every transfer is cut
+   * off once it exceeds its request's size limit, so a wrong URL pointing at a huge file
+   * cannot exhaust memory.
+   */
+  class FeedFetcher {
+  public:
+    using ResponseHandler = std::function<void(size_t index, FeedResponse &&response)>;
+
+    FeedFetcher(std::shared_ptr<dotnamebot::logging::ILogger> logger,
+                std::shared_ptr<dotnamebot::http::IHttpClient> httpClient, size_t maxParallel = 16);
+
+    /**
+     * @brief Download all requests and wait until every transfer has finished.
+     *
+     * @param requests Feeds to download
+     * @return std::vector<FeedResponse> One response per request, in request order
+     */
+    std::vector<FeedResponse> fetchAll(const std::vector<FeedRequest> &requests);
+
+    /**
+     * @brief Download all requests, handing every response over as soon as it is final.
+     *
+     * The handler runs on the calling thread between transfers, exactly once per request
+     * and in completion order; while it runs no other transfer makes progress, so it should
+     * pass heavy work on. Returns once every transfer has finished.
+     *
+     * @param requests Feeds to download
+     * @param onResponse Receives the request index and its response
+     */
+    void fetchEach(const std::vector<FeedRequest> &requests, const ResponseHandler &onResponse);
+
+    void setMaxParallel(size_t maxParallel) { maxParallel_ = maxParallel > 0 ? maxParallel : 1; }
+    [[nodiscard]] size_t getMaxParallel() const { return maxParallel_; }
+
+    void setHostLimits(const HostLimits &limits) { limiter_.setLimits(limits); }
+    [[nodiscard]] const HostLimits &getHostLimits() const { return limiter_.getLimits(); }
+
+    // When disabled, 429 / 503 responses are reported but do not pause the host
+    void setRespectRetryAfter(bool respect) { respectRetryAfter_ = respect; }
+
+  private:
+    /**
+     * @brief CURL write callback function
+     *
+     * @param contents Pointer to the delivered data
+     * @param size Size of each data element
+     * @param nmemb Number of data elements
+     * @param userp Pointer to the transfer (body buffer or the request's data sink)
+     * @return size_t
+     */
+    static size_t WriteCallback(void *contents, size_t size, size_t nmemb, void *userp);
+
+    /**
+     * @brief CURL header callback, captures the validators and the announced body size
+     *
+     * @param buffer One complete header line (not NUL terminated)
+     * @param size Always 1
+     * @param nitems Length of the header line
+     * @param userp Pointer to the transfer (validators and Content-Length are recorded)
+     * @return size_t
+     */
+    static size_t HeaderCallback(char *buffer, size_t size, size_t nitems, void *userp);
+
+    std::shared_ptr<dotnamebot::logging::ILogger> logger_;
+    std::shared_ptr<dotnamebot::http::IHttpClient> httpClient_;
+    size_t maxParallel_;
+    HostRateLimiter limiter_;
+    bool respectRetryAfter_{true};
+  };
+
+} // namespace dotnamebot::rss
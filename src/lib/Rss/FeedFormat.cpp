@@ -0,0 +1,126 @@
+#include "FeedFormat.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    constexpr std::string_view UTF8_BOM = "\xEF\xBB\xBF";
+    // Comments or a DOCTYPE longer than this before the root leave the sniffing to the
+    // Content-Type
+    constexpr size_t MAX_SNIFF_BYTES = 4096;
+
+    bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+    size_t skipSpaces(std::string_view text, size_t pos) {
+      while (pos < text.size() && isSpace(text[pos])) {
+        pos++;
+      }
+      return pos;
+    }
+
+    // Media type of a Content-Type value, lower-cased and without parameters
+    std::string mediaType(std::string_view contentType) {
+      contentType = contentType.substr(0, contentType.find(';'));
+      const size_t first = skipSpaces(contentType, 0);
+      size_t last = contentType.size();
+      while (last > first && isSpace(contentType[last - 1])) {
+        last--;
+      }
+      std::string type(contentType.substr(first, last - first));
+      std::transform(type.begin(), type.end(), type.begin(),
+                     [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+      return type;
+    }
+
+    FeedFormat formatOfContentType(std::string_view contentType) {
+      const std::string type = mediaType(contentType);
+      if (type == "application/feed+json" || type == "application/json") {
+        return FeedFormat::JsonFeed;
+      }
+      if (type == "application/atom+xml") {
+        return FeedFormat::Atom;
+      }
+      if (type == "application/rss+xml") {
+        return FeedFormat::Rss;
+      }
+      if (type == "application/rdf+xml") {
+        return FeedFormat::Rdf;
+      }
+      return FeedFormat::Unknown;
+    }
+
+    // Root element name of an XML document, skipping declaration, comments and DOCTYPE;
+    // false when it does not show up within the sniffing window
+    bool findRootName(std::string_view text, size_t pos, std::string_view &name) {
+      while (true) {
+        pos = skipSpaces(text, pos);
+        if (pos >= text.size() || text[pos] != '<') {
+          return false;
+        }
+        std::string_view terminator;
+        if (text.substr(pos).starts_with("<?")) {
+          terminator = "?>";
+        } else if (text.substr(pos).starts_with("<!--")) {
+          terminator = "-->";
+        } else if (text.substr(pos).starts_with("<!")) {
+          terminator = ">";
+        } else {
+          const size_t start = pos + 1;
+          size_t end = start;
+          while (end < text.size() && !isSpace(text[end]) && text[end] != '/' &&
+                 text[end] != '>') {
+            end++;
+          }
+          if (end == text.size()) {
+            return false;
+          }
+          name = text.substr(start, end - start);
+          return true;
+        }
+        const size_t close = text.find(terminator, pos + 2);
+        if (close == std::string_view::npos) {
+          return false;
+        }
+        pos = close + terminator.size();
+      }
+    }
+
+  } // namespace
+
+  FeedFormat feedFormatOfRoot(std::string_view name) {
+    if (name == "rss") {
+      return FeedFormat::Rss;
+    }
+    if (name == "rdf:RDF") {
+      return FeedFormat::Rdf;
+    }
+    if (name == "feed") {
+      return FeedFormat::Atom;
+    }
+    return FeedFormat::Unknown;
+  }
+
+  FeedFormat detectFeedFormat(std::string_view contentType, std::string_view document) {
+    document = document.substr(0, MAX_SNIFF_BYTES);
+    size_t pos = document.starts_with(UTF8_BOM) ? UTF8_BOM.size() : 0;
+    pos = skipSpaces(document, pos);
+    if (pos < document.size() && document[pos] == '{') {
+      return FeedFormat::JsonFeed;
+    }
+    if (std::string_view root; findRootName(document, pos, root)) {
+      // Servers often label feeds with a generic or wrong type; the root element is certain
+      return feedFormatOfRoot(root);
+    }
+    if (pos < document.size() && document[pos] == '<') {
+      // XML whose root lies beyond the window: only an XML type may refine it
+      const FeedFormat hinted = formatOfContentType(contentType);
+      return hinted == FeedFormat::JsonFeed ? FeedFormat::Unknown : hinted;
+    }
+    return formatOfContentType(contentType);
+  }
+
+} // namespace dotnamebot::rss
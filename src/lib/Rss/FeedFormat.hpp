@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Syntax of a feed document. RSS 2.0 and RDF share their item format.
+   *
+   */
+  enum class FeedFormat : std::uint8_t { Unknown, Rss, Rdf, Atom, JsonFeed };
+
+  /**
+   * @brief Decide the format before parsing: sniff the start of the document (BOM, XML
+   * prolog, root element, or the '{' of a JSON Feed) and fall back to the Content-Type
+   * when the start is inconclusive.
+   *
+   * @param contentType Content-Type response header, may be empty
+   * @param document Start of the document; only the first few KiB are looked at
+   * @return FeedFormat Unknown when neither tells; readers then treat the document as XML
+   */
+  FeedFormat detectFeedFormat(std::string_view contentType, std::string_view document);
+
+  /**
+   * @brief Format named by the root element of an XML feed
+   *
+   * @param name Qualified element name, e.g. "rss", "rdf:RDF" or "feed"
+   * @return FeedFormat Unknown for any other element
+   */
+  FeedFormat feedFormatOfRoot(std::string_view name);
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,553 @@
+#include "FeedReader.hpp"
+
+#include <Rss/HtmlEntities.hpp>
+#include <Rss/HtmlText.hpp>
+#include <Rss/JsonFeedReader.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <utility>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    using FirstChild = XmlPullParser::FirstChild;
+
+    enum class FeedTag : std::uint8_t {
+      Other,
+      Channel,
+      Item,
+      Entry,
+      Title,
+      Link,
+      Description,
+      Subtitle,
+      Summary,
+      Content,
+      Ttl,
+      UpdatePeriod,
+      UpdateFrequency,
+      PubDate,
+      Updated,
+      Published,
+      Image,
+      Url,
+      MediaContent,
+      Enclosure,
+      SznImage,
+      SznUrl
+    };
+
+    // 32-bit FNV-1a, evaluated at compile time for the case labels below
+    constexpr uint32_t tagHash(std::string_view name) {
+      uint32_t hash = 2166136261U;
+      for (const char c : name) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 16777619U;
+      }
+      return hash;
+    }
+
+    // One hash and one comparison per element. Two tag names sharing a hash would be
+    // duplicate case labels, so a collision cannot slip in unnoticed.
+    FeedTag feedTag(std::string_view name) {
+      auto match = [name](std::string_view expected, FeedTag tag) {
+        return name == expected ? tag : FeedTag::Other;
+      };
+      switch (tagHash(name)) {
+      case tagHash("channel"): return match("channel", FeedTag::Channel);
+      case tagHash("item"): return match("item", FeedTag::Item);
+      case tagHash("entry"): return match("entry", FeedTag::Entry);
+      case tagHash("title"): return match("title", FeedTag::Title);
+      case tagHash("link"): return match("link", FeedTag::Link);
+      case tagHash("description"): return match("description", FeedTag::Description);
+      case tagHash("subtitle"): return match("subtitle", FeedTag::Subtitle);
+      case tagHash("summary"): return match("summary", FeedTag::Summary);
+      case tagHash("content"): return match("content", FeedTag::Content);
+      case tagHash("ttl"): return match("ttl", FeedTag::Ttl);
+      case tagHash("sy:updatePeriod"): return match("sy:updatePeriod", FeedTag::UpdatePeriod);
+      case tagHash("sy:updateFrequency"):
+        return match("sy:updateFrequency", FeedTag::UpdateFrequency);
+      case tagHash("pubDate"): return match("pubDate", FeedTag::PubDate);
+      case tagHash("updated"): return match("updated", FeedTag::Updated);
+      case tagHash("published"): return match("published", FeedTag::Published);
+      case tagHash("image"): return match("image", FeedTag::Image);
+      case tagHash("url"): return match("url", FeedTag::Url);
+      case tagHash("media:content"): return match("media:content", FeedTag::MediaContent);
+      case tagHash("enclosure"): return match("enclosure", FeedTag::Enclosure);
+      case tagHash("szn:image"): return match("szn:image", FeedTag::SznImage);
+      case tagHash("szn:url"): return match("szn:url", FeedTag::SznUrl);
+      default: return FeedTag::Other;
+      }
+    }
+
+    // Compile-time description of an XML feed dialect. The readers below are instantiated
+    // once per dialect, so walking a channel or an item involves no format checks at run time.
+    template <typename Format>
+    concept XmlFeedFormat = requires {
+      { Format::IS_ATOM } -> std::convertible_to<bool>;
+      { Format::CHANNEL_ITEM } -> std::convertible_to<FeedTag>;
+    };
+
+    struct RssFormat {
+      static constexpr bool IS_ATOM = false;
+      // Items are children of <channel>
+      static constexpr FeedTag CHANNEL_ITEM = FeedTag::Item;
+    };
+
+    struct RdfFormat {
+      static constexpr bool IS_ATOM = false;
+      // Items are siblings of <channel>, so the channel has none
+      static constexpr FeedTag CHANNEL_ITEM = FeedTag::Other;
+    };
+
+    struct AtomFormat {
+      static constexpr bool IS_ATOM = true;
+      // The root <feed> is the channel and its entries are direct children
+      static constexpr FeedTag CHANNEL_ITEM = FeedTag::Entry;
+    };
+
+    // Keeps the first occurrence of an element, like FirstChildElement() did
+    void readFirst(XmlPullParser &xml, std::optional<FirstChild> &slot) {
+      if (!slot) {
+        slot = xml.readElement();
+      }
+    }
+
+    // First <tag> child of the current element, e.g. <url> inside <image>
+    void readNestedFirst(XmlPullParser &xml, FeedTag tag, std::optional<FirstChild> &slot) {
+      const size_t depth = xml.depth();
+      while (xml.nextChild(depth)) {
+        if (!slot && feedTag(xml.name()) == tag) {
+          slot = xml.readElement();
+        }
+      }
+    }
+
+    std::string attributeOrEmpty(const XmlPullParser &xml, std::string_view name) {
+      std::string value;
+      xml.attribute(name, value);
+      return value;
+    }
+
+    struct FeedHeader {
+      std::optional<FirstChild> title;
+      std::optional<FirstChild> description; // <description>, or <subtitle> in Atom
+      std::optional<FirstChild> link;
+      std::optional<std::string> atomLinkHref;
+      std::optional<FirstChild> ttl;
+      std::optional<FirstChild> updatePeriod;
+      std::optional<FirstChild> updateFrequency;
+    };
+
+    template <XmlFeedFormat Format>
+    void readHeaderField(XmlPullParser &xml, FeedTag tag, FeedHeader &header) {
+      switch (tag) {
+      case FeedTag::Title: readFirst(xml, header.title); break;
+      case FeedTag::Description:
+        if constexpr (!Format::IS_ATOM) {
+          readFirst(xml, header.description);
+        }
+        break;
+      case FeedTag::Subtitle:
+        if constexpr (Format::IS_ATOM) {
+          readFirst(xml, header.description);
+        }
+        break;
+      case FeedTag::Link:
+        if constexpr (!Format::IS_ATOM) {
+          readFirst(xml, header.link);
+        } else if (!header.atomLinkHref) {
+          header.atomLinkHref = attributeOrEmpty(xml, "href");
+        }
+        break;
+      case FeedTag::Ttl: readFirst(xml, header.ttl); break;
+      case FeedTag::UpdatePeriod: readFirst(xml, header.updatePeriod); break;
+      case FeedTag::UpdateFrequency: readFirst(xml, header.updateFrequency); break;
+      default: break;
+      }
+    }
+
+    void applyHeader(const FeedHeader &header, RSSFeed &feed) {
+      if (header.title) {
+        feed.headTitle = header.title->text();
+      }
+      if (header.description) {
+        feed.headDescription = header.description->text();
+      }
+      if (header.atomLinkHref) {
+        feed.headLink = *header.atomLinkHref;
+      } else if (header.link) {
+        feed.headLink = header.link->text();
+      }
+
+      // Refresh hints: <ttl> is in minutes, sy:updatePeriod / sy:updateFrequency (RSS 1.0
+      // syndication module, also seen in RSS 2.0 and Atom) give updates per period
+      if (header.ttl && header.ttl->isText()) {
+        feed.updateHintSeconds = std::max(0L, std::atol(header.ttl->value.c_str()) * 60);
+      }
+      if (header.updatePeriod) {
+        static const std::pair<const char *, long> periods[] = {
+            {"hourly", 3600},     {"daily", 86400},       {"weekly", 604800},
+            {"monthly", 2592000}, {"yearly", 31536000},
+        };
+        std::string period = header.updatePeriod->text();
+        period.erase(0, period.find_first_not_of(" \t\n\r"));
+        period.erase(period.find_last_not_of(" \t\n\r") + 1);
+        long frequency = 1;
+        if (header.updateFrequency && header.updateFrequency->isText() &&
+            std::atol(header.updateFrequency->value.c_str()) > 0) {
+          frequency = std::atol(header.updateFrequency->value.c_str());
+        }
+        for (const auto &[name, seconds] : periods) {
+          if (period == name) {
+            feed.updateHintSeconds = std::max(feed.updateHintSeconds, seconds / frequency);
+          }
+        }
+      }
+    }
+
+    // Everything an item provides, first occurrence of each element. Each format fills and
+    // builds from its own subset.
+    struct ItemFields {
+      std::optional<FirstChild> title;
+      std::optional<FirstChild> link;
+      std::optional<FirstChild> description;
+      std::optional<FirstChild> pubDate;
+
+      // Atom <link href>: the first rel="alternate" one, else the first with an href
+      std::optional<std::string> alternateHref;
+      std::optional<std::string> firstHref;
+      std::optional<FirstChild> summary;
+      std::optional<FirstChild> content;
+      bool hasImage{false};
+      std::optional<FirstChild> imageUrl;
+      std::optional<FirstChild> updated;
+      std::optional<FirstChild> published;
+
+      // Attributes are only readable on the start tag, so they are copied there
+      bool hasMediaContent{false};
+      std::string mediaUrl;
+      std::string mediaType;
+      std::string mediaMedium;
+      bool hasEnclosure{false};
+      std::string enclosureUrl;
+      std::string enclosureType;
+      bool hasSznImage{false};
+      std::optional<FirstChild> sznUrl;
+    };
+
+    void readAtomItemField(XmlPullParser &xml, ItemFields &fields) {
+      switch (feedTag(xml.name())) {
+      case FeedTag::Title: readFirst(xml, fields.title); break;
+      case FeedTag::Link: {
+        std::string href;
+        const bool hasHref = xml.attribute("href", href);
+        std::string rel;
+        if (!fields.alternateHref && xml.attribute("rel", rel) && rel == "alternate") {
+          fields.alternateHref = href;
+        }
+        if (!fields.firstHref && hasHref) {
+          fields.firstHref = std::move(href);
+        }
+        break;
+      }
+      case FeedTag::Summary: readFirst(xml, fields.summary); break;
+      case FeedTag::Content: readFirst(xml, fields.content); break;
+      case FeedTag::Updated: readFirst(xml, fields.updated); break;
+      case FeedTag::Published: readFirst(xml, fields.published); break;
+      case FeedTag::Image:
+        if (!fields.hasImage) {
+          fields.hasImage = true;
+          readNestedFirst(xml, FeedTag::Url, fields.imageUrl);
+        }
+        break;
+      default: break; // nextChild() skips whatever is left of it
+      }
+    }
+
+    void readRssItemField(XmlPullParser &xml, ItemFields &fields) {
+      switch (feedTag(xml.name())) {
+      case FeedTag::Title: readFirst(xml, fields.title); break;
+      case FeedTag::Link: readFirst(xml, fields.link); break;
+      case FeedTag::Description: readFirst(xml, fields.description); break;
+      case FeedTag::PubDate: readFirst(xml, fields.pubDate); break;
+      case FeedTag::MediaContent:
+        if (!fields.hasMediaContent) {
+          fields.hasMediaContent = true;
+          fields.mediaUrl = attributeOrEmpty(xml, "url");
+          fields.mediaType = attributeOrEmpty(xml, "type");
+          fields.mediaMedium = attributeOrEmpty(xml, "medium");
+        }
+        break;
+      case FeedTag::Enclosure:
+        if (!fields.hasEnclosure) {
+          fields.hasEnclosure = true;
+          fields.enclosureUrl = attributeOrEmpty(xml, "url");
+          fields.enclosureType = attributeOrEmpty(xml, "type");
+        }
+        break;
+      case FeedTag::SznImage:
+        if (!fields.hasSznImage) {
+          fields.hasSznImage = true;
+          readNestedFirst(xml, FeedTag::SznUrl, fields.sznUrl);
+        }
+        break;
+      default: break; // nextChild() skips whatever is left of it
+      }
+    }
+
+    void setImage(RSSItem &item, std::string_view url) {
+      item.rssMedia.url = item.arena->store(url);
+      item.rssMedia.type = "image/";
+    }
+
+    void buildAtomItem(ItemFields &fields, RSSItem &item) {
+      ItemArena &arena = *item.arena;
+      if (fields.title) {
+        // Strip any residual HTML tags from title (e.g. type="html")
+        item.title = arena.store(decodeHtmlEntities(stripHtmlTags(fields.title->text())));
+      }
+      if (fields.alternateHref) {
+        item.url = arena.store(*fields.alternateHref);
+      } else if (fields.firstHref) {
+        item.url = arena.store(*fields.firstHref);
+      }
+
+      // Use <summary> for description text; fall back to <content> if missing
+      const std::optional<FirstChild> &descEl = fields.summary ? fields.summary : fields.content;
+      if (descEl) {
+        const std::string descValue = descEl->text();
+        if (!descValue.empty()) {
+          // Decode HTML entities first, then strip tags, trim and pick the first image
+          HtmlText html = extractHtmlText(decodeHtmlEntities(descValue), true);
+          if (!html.imageSrc.empty()) {
+            setImage(item, html.imageSrc);
+          }
+          item.description = arena.store(html.text);
+        }
+      }
+      // If no image found yet, also scan <content> (e.g. when description came from <summary>)
+      if (item.rssMedia.url.empty() && fields.summary && fields.content) {
+        const std::string contentValue = fields.content->text();
+        if (!contentValue.empty()) {
+          const std::string decoded = decodeHtmlEntities(contentValue);
+          if (std::string_view src = findImageSrc(decoded); !src.empty()) {
+            setImage(item, src);
+          }
+        }
+      }
+
+      // <image><title>iSport.cz</title><url>https://picture.png</url></image>
+      if (fields.hasImage) {
+        if (fields.imageUrl) {
+          item.rssMedia.url = arena.store(fields.imageUrl->text());
+        }
+        // Type is not usually provided in Atom <image>, set as empty
+        item.rssMedia.type = "";
+      }
+
+      if (fields.updated) {
+        item.pubDate = arena.store(fields.updated->text());
+      } else if (fields.published) {
+        item.pubDate = arena.store(fields.published->text());
+      }
+    }
+
+    void buildRssItem(ItemFields &fields, RSSItem &item) {
+      ItemArena &arena = *item.arena;
+      if (fields.title) {
+        item.title = arena.store(decodeHtmlEntities(stripHtmlTags(fields.title->text())));
+      }
+      if (fields.link) {
+        item.url = arena.store(fields.link->text());
+      }
+
+      // Any first child counts here, as it did with tinyxml2's FirstChild()->Value()
+      if (fields.description && fields.description->kind != FirstChild::Kind::None) {
+        // Decode HTML entities first, then take the CDATA content if there is some left
+        const std::string descValue = decodeHtmlEntities(fields.description->value);
+        std::string_view html = descValue;
+        findCdataSection(descValue, html);
+
+        // Strip tags, trim and pick the first image in one pass
+        HtmlText text = extractHtmlText(html, true);
+        if (!text.imageSrc.empty()) {
+          setImage(item, text.imageSrc);
+        }
+        item.description = arena.store(text.text);
+      }
+
+      // Later sources override earlier ones: description image, <media:content url type
+      // medium>, <enclosure url type>, then <szn:image><szn:url>
+      if (fields.hasMediaContent) {
+        item.rssMedia.url = arena.store(fields.mediaUrl);
+        item.rssMedia.type = arena.store(fields.mediaType);
+        if (item.rssMedia.type.empty() && fields.mediaMedium == "image") {
+          item.rssMedia.type = "image/";
+        }
+      }
+      if (fields.hasEnclosure) {
+        item.rssMedia.url = arena.store(fields.enclosureUrl);
+        item.rssMedia.type = arena.store(fields.enclosureType);
+      }
+
+      if (fields.pubDate) {
+        item.pubDate = arena.store(fields.pubDate->text());
+      }
+
+      if (fields.hasSznImage) {
+        if (fields.sznUrl) {
+          item.rssMedia.url = arena.store(fields.sznUrl->text());
+        }
+        item.rssMedia.type = "image/"; // Type is not usually provided, set as image
+      }
+    }
+
+    template <XmlFeedFormat Format>
+    RSSItem readItem(XmlPullParser &xml, const std::shared_ptr<ItemArena> &arena) {
+      ItemFields fields;
+      const size_t depth = xml.depth();
+      while (xml.nextChild(depth)) {
+        if constexpr (Format::IS_ATOM) {
+          readAtomItemField(xml, fields);
+        } else {
+          readRssItemField(xml, fields);
+        }
+      }
+
+      RSSItem item;
+      item.arena = arena;
+      if constexpr (Format::IS_ATOM) {
+        buildAtomItem(fields, item);
+      } else {
+        buildRssItem(fields, item);
+      }
+      return item;
+    }
+
+    // Hands an item over; false once the handler asked to stop
+    template <XmlFeedFormat Format>
+    bool emitItem(XmlPullParser &xml, const std::shared_ptr<ItemArena> &arena,
+                  const FeedItemHandler &onItem) {
+      RSSItem item = readItem<Format>(xml, arena);
+      return !onItem || onItem(std::move(item));
+    }
+
+    // Children of a <channel> or Atom <feed>: header fields, and the items of formats that
+    // nest them there. Returns false when the item handler stopped the walk.
+    template <XmlFeedFormat Format>
+    bool readChannel(XmlPullParser &xml, FeedHeader &header,
+                     const std::shared_ptr<ItemArena> &arena, const FeedItemHandler &onItem) {
+      const size_t depth = xml.depth();
+      while (xml.nextChild(depth)) {
+        const FeedTag tag = feedTag(xml.name());
+        if (Format::CHANNEL_ITEM != FeedTag::Other && tag == Format::CHANNEL_ITEM) {
+          if (!emitItem<Format>(xml, arena, onItem)) {
+            return false;
+          }
+        } else {
+          readHeaderField<Format>(xml, tag, header);
+        }
+      }
+      return true;
+    }
+
+    // Children of <rss> or <rdf:RDF>: RSS 2.0 nests the items in the first <channel>,
+    // RSS 1.0 puts them next to it. Returns false when the item handler stopped the walk.
+    template <XmlFeedFormat Format>
+    bool readRssRoot(XmlPullParser &xml, FeedHeader &header, bool &hasChannel,
+                     const std::shared_ptr<ItemArena> &arena, const FeedItemHandler &onItem) {
+      const size_t rootDepth = xml.depth();
+      while (xml.nextChild(rootDepth)) {
+        const FeedTag tag = feedTag(xml.name());
+        if (tag == FeedTag::Channel && !hasChannel) {
+          hasChannel = true;
+          if (!readChannel<Format>(xml, header, arena, onItem)) {
+            return false;
+          }
+        } else if (Format::CHANNEL_ITEM == FeedTag::Other && tag == FeedTag::Item) {
+          if (!emitItem<Format>(xml, arena, onItem)) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+  } // namespace
+
+  RSSItem readFeedItem(XmlPullParser &xml, FeedFormat format,
+                       const std::shared_ptr<ItemArena> &arena) {
+    return format == FeedFormat::Atom ? readItem<AtomFormat>(xml, arena)
+                                      : readItem<RssFormat>(xml, arena);
+  }
+
+  bool readFeedItem(std::string_view xml, FeedFormat format, RSSItem &item) {
+    XmlPullParser parser(xml);
+    if (parser.next() != XmlPullParser::Event::StartElement) {
+      return false;
+    }
+    std::shared_ptr<ItemArena> arena =
+        item.arena ? std::move(item.arena) : std::make_shared<ItemArena>();
+    item = readFeedItem(parser, format, arena);
+    return parser.finish();
+  }
+
+  bool readFeedDocument(std::string_view document, RSSFeed &feed, const FeedItemHandler &onItem,
+                        std::string &error, FeedFormat format) {
+    if (format == FeedFormat::Unknown) {
+      format = detectFeedFormat({}, document);
+    }
+    if (format == FeedFormat::JsonFeed) {
+      return readJsonFeed(document, feed, onItem, error);
+    }
+
+    XmlPullParser parser(document);
+    FeedHeader header;
+    if (!feed.arena) {
+      feed.arena = std::make_shared<ItemArena>();
+    }
+    const std::shared_ptr<ItemArena> &arena = feed.arena;
+    bool hasRoot = false;
+    bool hasChannel = false;
+    bool stopped = false;
+    // The first <rss>, <rdf:RDF> or <feed> at the top level is the feed and picks the reader;
+    // unless the item handler stops it, the loop runs to the end so a malformed document is
+    // rejected as a whole
+    while (!stopped && parser.nextChild(0)) {
+      if (hasRoot) {
+        continue;
+      }
+      switch (feedFormatOfRoot(parser.name())) {
+      case FeedFormat::Rss:
+        stopped = !readRssRoot<RssFormat>(parser, header, hasChannel, arena, onItem);
+        break;
+      case FeedFormat::Rdf:
+        stopped = !readRssRoot<RdfFormat>(parser, header, hasChannel, arena, onItem);
+        break;
+      case FeedFormat::Atom:
+        hasChannel = true;
+        stopped = !readChannel<AtomFormat>(parser, header, arena, onItem);
+        break;
+      default: continue;
+      }
+      hasRoot = true;
+    }
+
+    if (parser.event() == XmlPullParser::Event::Error) {
+      error = parser.error();
+      return false;
+    }
+    if (!hasChannel) {
+      error = "No valid RSS/Atom channel found.";
+      return false;
+    }
+    applyHeader(header, feed);
+    return true;
+  }
+
+} // namespace dotnamebot::rss
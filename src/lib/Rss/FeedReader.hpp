@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Rss/FeedFormat.hpp>
+#include <Rss/ItemArena.hpp>
+#include <Rss/RSSFeed.hpp>
+#include <Rss/RSSItem.hpp>
+#include <Rss/XmlPullParser.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace dotnamebot::rss {
+
+  // Returns false to stop reading the document
+  using FeedItemHandler = std::function<bool(RSSItem &&item)>;
+
+  /**
+   * @brief Read an RSS 2.0, RDF, Atom or JSON Feed document in a single pass.
+   *
+   * The feed header (title, description, link, refresh hints) is stored in feed and every
+   * <item> / <entry> is handed to onItem in document order. As with a DOM lookup, the first
+   * occurrence of each element wins. XML dialects are told apart by the root element; JSON
+   * Feeds go to readJsonFeed().
+   *
+   * @param document UTF-8 document
+   * @param feed Receives the header fields. Item text goes to feed.arena, which is created
+   * when null.
+   * @param onItem Called for every item; may be empty. When it returns false the rest of the
+   * document, header fields after that item included, is neither read nor checked.
+   * @param error Receives the reason when the document is rejected
+   * @param format Result of detectFeedFormat(), e.g. with the Content-Type; Unknown sniffs
+   * the document
+   * @return true for a well-formed (or stopped) feed. On false, onItem may already have been
+   * called for items before the error, so callers commit items only after success.
+   */
+  bool readFeedDocument(std::string_view document, RSSFeed &feed, const FeedItemHandler &onItem,
+                        std::string &error, FeedFormat format = FeedFormat::Unknown);
+
+  /**
+   * @brief Read one <item> or <entry> element and its RSS/Atom fallbacks (CDATA, media:content,
+   * enclosure, szn:image, Atom image and links)
+   *
+   * @param xml Parser standing on the item's start tag; left on its end tag
+   * @param format Atom for an <entry>; any other format reads an RSS <item>
+   * @param arena Receives the item text
+   * @return RSSItem Title, link, description, media and date; not yet hashed
+   */
+  RSSItem readFeedItem(XmlPullParser &xml, FeedFormat format,
+                       const std::shared_ptr<ItemArena> &arena);
+
+  /**
+   * @brief Read a document that consists of a single item, as cut out by FeedStreamParser
+   *
+   * @param item Receives the item; its text goes to item.arena, which is created when null
+   * @return true if the item is well-formed, otherwise false
+   */
+  bool readFeedItem(std::string_view xml, FeedFormat format, RSSItem &item);
+
+} // namespace dotnamebot::rss
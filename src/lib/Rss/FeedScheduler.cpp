@@ -0,0 +1,194 @@
+#include "FeedScheduler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    // Weight of the newest rate sample in the moving average
+    constexpr double RATE_SMOOTHING = 0.3;
+    // A quiet poll stretches the interval by this factor before the average catches up
+    constexpr double QUIET_BACKOFF = 1.5;
+    constexpr double JITTER = 0.1;
+    // Backoff doublings are capped well before the double overflows
+    constexpr int MAX_BACKOFF_EXPONENT = 20;
+    constexpr double SECONDS_PER_HOUR = 3600.0;
+
+  } // namespace
+
+  FeedScheduler::FeedScheduler(const RssOptions &options) : options_(options) {
+    rng_.seed(std::random_device{}());
+  }
+
+  bool FeedScheduler::isDue(const std::string &url, Clock::time_point now) const {
+    auto it = entries_.find(url);
+    return it == entries_.end() || it->second.nextDue <= now;
+  }
+
+  std::chrono::seconds FeedScheduler::timeUntilNextDue(const std::vector<RSSUrl> &urls,
+                                                       Clock::time_point now) const {
+    auto wait = std::chrono::seconds(options_.maxPollSeconds);
+    for (const auto &rssUrl : urls) {
+      auto it = entries_.find(rssUrl.url);
+      if (it == entries_.end() || it->second.nextDue <= now) {
+        return std::chrono::seconds(0);
+      }
+      wait = std::min(wait, std::chrono::ceil<std::chrono::seconds>(it->second.nextDue - now));
+    }
+    return wait;
+  }
+
+  long FeedScheduler::recordPoll(const RSSUrl &rssUrl, RSSFeedState &state,
+                                 const FeedPollResult &result, Clock::time_point now) {
+    const long minSeconds =
+        rssUrl.minPollSeconds > 0 ? rssUrl.minPollSeconds : options_.minPollSeconds;
+    const long maxSeconds =
+        std::max(minSeconds, rssUrl.maxPollSeconds > 0 ? rssUrl.maxPollSeconds
+                                                       : options_.maxPollSeconds);
+    const double previous = state.pollSeconds > 0
+                                ? static_cast<double>(state.pollSeconds)
+                                : static_cast<double>(options_.defaultPollSeconds);
+
+    auto it = entries_.find(rssUrl.url);
+    const bool hasPrevious = it != entries_.end() && it->second.lastPoll != Clock::time_point{};
+    double interval = previous;
+    double delaySeconds = 0.0;
+
+    if (result.fetched) {
+      // Rate sample from this poll: new items over the time since the previous poll, blended
+      // with what the item dates say. Right after startup only the dates are usable.
+      const double dateRate = estimatePublishRate(result.publishTimes, Clock::to_time_t(now));
+      double observedRate = -1.0;
+      if (hasPrevious) {
+        const double hours =
+            std::chrono::duration<double>(now - it->second.lastPoll).count() / SECONDS_PER_HOUR;
+        if (hours > 0.0) {
+          observedRate = result.newItems / hours;
+        }
+      }
+      double sample = -1.0;
+      if (observedRate >= 0.0 && dateRate >= 0.0) {
+        sample = (observedRate + dateRate) / 2.0;
+      } else {
+        sample = std::max(observedRate, dateRate);
+      }
+      if (sample >= 0.0) {
+        state.publishRate = state.publishRate < 0.0 ? sample
+                                                    : (RATE_SMOOTHING * sample) +
+                                                          ((1.0 - RATE_SMOOTHING) *
+                                                           state.publishRate);
+      }
+
+      // Aim for about one new item per poll
+      if (state.publishRate > 0.0) {
+        interval = SECONDS_PER_HOUR / state.publishRate;
+      } else if (state.publishRate == 0.0) {
+        interval = static_cast<double>(maxSeconds);
+      }
+
+      // React to the latest poll right away; the average alone needs several polls
+      if (hasPrevious && result.newItems == 0) {
+        interval = std::max(interval, previous * QUIET_BACKOFF);
+      } else if (hasPrevious && result.newItems > 1) {
+        interval = std::min(interval, previous / result.newItems);
+      }
+
+      // Polling faster than the publisher refreshes the document gains nothing
+      interval = std::max(interval, static_cast<double>(state.updateHintSeconds));
+      interval = std::clamp(interval, static_cast<double>(minSeconds),
+                            static_cast<double>(maxSeconds));
+      state.pollSeconds = static_cast<long>(interval);
+
+      state.consecutiveFailures = 0;
+      state.lastError.clear();
+      state.retryAt = 0;
+      state.lastSuccessAt = Clock::to_time_t(now);
+    } else {
+      interval = std::clamp(previous, static_cast<double>(minSeconds),
+                            static_cast<double>(maxSeconds));
+      state.lastError = result.error;
+      if (result.retryAfterSeconds <= 0) {
+        state.consecutiveFailures++;
+      }
+    }
+
+    if (!result.fetched && state.consecutiveFailures >= options_.circuitFailureThreshold) {
+      // Circuit open: double the wait with every further failure, then pick a point in the
+      // upper half of it so feeds on one dead host do not come back in lockstep
+      const int exponent = std::min(
+          state.consecutiveFailures - options_.circuitFailureThreshold + 1, MAX_BACKOFF_EXPONENT);
+      const double backoff = std::min(std::ldexp(interval, exponent),
+                                      static_cast<double>(options_.circuitMaxBackoffSeconds));
+      std::uniform_real_distribution<double> jitter(0.5, 1.0);
+      delaySeconds = std::max(backoff * jitter(rng_), interval);
+      state.retryAt = Clock::to_time_t(now) + static_cast<int64_t>(delaySeconds);
+    } else {
+      std::uniform_real_distribution<double> jitter(1.0 - JITTER, 1.0 + JITTER);
+      delaySeconds = interval * jitter(rng_);
+    }
+    delaySeconds = std::max(delaySeconds, static_cast<double>(result.retryAfterSeconds));
+
+    Entry &entry = entries_[rssUrl.url];
+    if (result.fetched) {
+      entry.lastPoll = now;
+    }
+    entry.nextDue = now + std::chrono::duration_cast<Clock::duration>(
+                              std::chrono::duration<double>(delaySeconds));
+    return static_cast<long>(interval);
+  }
+
+  void FeedScheduler::restore(const std::string &url, const RSSFeedState &state,
+                              Clock::time_point now) {
+    if (isSuspended(state, now)) {
+      entries_[url].nextDue = Clock::from_time_t(static_cast<time_t>(state.retryAt));
+    }
+  }
+
+  void FeedScheduler::reset(const std::string &url, RSSFeedState &state) {
+    state.consecutiveFailures = 0;
+    state.lastError.clear();
+    state.retryAt = 0;
+    entries_.erase(url);
+  }
+
+  bool FeedScheduler::isSuspended(const RSSFeedState &state, Clock::time_point now) const {
+    return state.consecutiveFailures >= options_.circuitFailureThreshold &&
+           state.retryAt > Clock::to_time_t(now);
+  }
+
+  void FeedScheduler::prune(const std::vector<RSSUrl> &urls) {
+    std::unordered_set<std::string> configured;
+    for (const auto &rssUrl : urls) {
+      configured.insert(rssUrl.url);
+    }
+    std::erase_if(entries_, [&configured](const auto &entry) {
+      return !configured.contains(entry.first);
+    });
+  }
+
+  double FeedScheduler::estimatePublishRate(const std::vector<time_t> &publishTimes, time_t now) {
+    // Ignore undated items and dates from the future (zone offsets are not applied)
+    const time_t latest = now + 86400;
+    time_t oldest = 0;
+    size_t count = 0;
+    for (time_t t : publishTimes) {
+      if (t <= 0 || t > latest) {
+        continue;
+      }
+      oldest = count == 0 ? t : std::min(oldest, t);
+      count++;
+    }
+    if (count < 2) {
+      return -1.0;
+    }
+
+    // Measure up to now rather than to the newest item, so a feed that went silent
+    // after a burst is not mistaken for a busy one
+    const double hours = std::max(1.0, static_cast<double>(now - oldest) / SECONDS_PER_HOUR);
+    return static_cast<double>(count) / hours;
+  }
+
+} // namespace dotnamebot::rss
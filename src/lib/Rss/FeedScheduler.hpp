@@ -0,0 +1,145 @@
+#pragma once
+
+#include <Rss/RSSFeedState.hpp>
+#include <Rss/RSSUrl.hpp>
+#include <Rss/RssOptions.hpp>
+
+#include <chrono>
+#include <ctime>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief What a single poll of a feed revealed, as input for the next interval.
+   *
+   */
+  struct FeedPollResult {
+    // False when the download or parse failed; the feed keeps its interval and rate
+    bool fetched{false};
+    // Why the poll failed, kept in the feed's health state
+    std::string error;
+    // Items that were neither buffered nor served before this poll
+    int newItems{0};
+    // Publish times of all dated items in the document (empty on 304)
+    std::vector<time_t> publishTimes;
+    // Server-requested pause (429 / 503 Retry-After); the next poll is not scheduled earlier
+    long retryAfterSeconds{0};
+  };
+
+  /**
+   * @brief Decides when each feed is polled next.
+   *
+   * Every feed carries a smoothed publish rate, estimated from the item dates in the
+   * document and from how many new items each poll finds. Busy feeds are polled about
+   * once per expected new item, quiet ones back off, and each interval is kept above the
+   * publisher's ttl / sy:update hint and within the feed's min/max bounds. A random
+   * +-10 % jitter keeps feeds from lining up into one burst again.
+   *
+   * Failing feeds go through a circuit breaker: after circuitFailureThreshold failures in
+   * a row the feed is suspended with exponential backoff (equal jitter) until retryAt in
+   * its persisted state; the next attempt then acts as the probe. Pauses requested with
+   * Retry-After do not count as failures.
+   *
+   * Due times live in memory only: after a restart every feed is due at once, which is
+   * needed anyway to refill the item buffer, except for feeds whose circuit is open
+   * (see restore()).
+   */
+  class FeedScheduler {
+  public:
+    using Clock = std::chrono::system_clock;
+
+    explicit FeedScheduler(const RssOptions &options = {});
+
+    void setOptions(const RssOptions &options) { options_ = options; }
+
+    /**
+     * @brief Whether the feed should be polled now; feeds never polled are always due
+     *
+     * @param url RSSUrl::url of the feed
+     * @param now Current time
+     * @return true if the feed is due
+     */
+    [[nodiscard]] bool isDue(const std::string &url, Clock::time_point now) const;
+
+    /**
+     * @brief Time until the earliest of the given feeds becomes due
+     *
+     * @param urls Configured feeds
+     * @param now Current time
+     * @return std::chrono::seconds Zero when a feed is already due, maxPollSeconds when
+     * there are no feeds
+     */
+    [[nodiscard]] std::chrono::seconds timeUntilNextDue(const std::vector<RSSUrl> &urls,
+                                                        Clock::time_point now) const;
+
+    /**
+     * @brief Record a poll, update the feed's rate and interval and schedule the next poll
+     *
+     * @param rssUrl The polled feed, for its per-feed bounds
+     * @param state Persisted feed state; rate, interval and health are updated in place
+     * @param result What the poll found
+     * @param now Time of the poll
+     * @return long The new polling interval in seconds (before jitter and circuit backoff)
+     */
+    long recordPoll(const RSSUrl &rssUrl, RSSFeedState &state, const FeedPollResult &result,
+                    Clock::time_point now);
+
+    /**
+     * @brief Re-apply persisted health after a restart: an open circuit stays closed to polls
+     *
+     * @param url RSSUrl::url of the feed
+     * @param state The feed's persisted state
+     * @param now Current time
+     */
+    void restore(const std::string &url, const RSSFeedState &state, Clock::time_point now);
+
+    /**
+     * @brief Close the circuit and make the feed due now, e.g. after it was edited
+     *
+     * @param url RSSUrl::url of the feed
+     * @param state The feed's state; its health fields are cleared
+     */
+    void reset(const std::string &url, RSSFeedState &state);
+
+    /**
+     * @brief Whether the feed's circuit is open, i.e. it must not be polled yet even on demand
+     *
+     * @param state The feed's state
+     * @param now Current time
+     * @return true while the feed is suspended
+     */
+    [[nodiscard]] bool isSuspended(const RSSFeedState &state, Clock::time_point now) const;
+
+    /**
+     * @brief Forget feeds that are no longer configured
+     *
+     * @param urls Configured feeds
+     */
+    void prune(const std::vector<RSSUrl> &urls);
+
+    /**
+     * @brief Estimate a publish rate from item dates
+     *
+     * @param publishTimes Item publish times, in any order
+     * @param now Current time (seconds since the epoch)
+     * @return double Items per hour, or a negative value when the dates say nothing
+     */
+    static double estimatePublishRate(const std::vector<time_t> &publishTimes, time_t now);
+
+  private:
+    struct Entry {
+      // Epoch when the feed has not been polled in this run
+      Clock::time_point lastPoll;
+      Clock::time_point nextDue;
+    };
+
+    RssOptions options_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::mt19937 rng_;
+  };
+
+} // namespace dotnamebot::rss
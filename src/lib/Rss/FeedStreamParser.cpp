@@ -0,0 +1,475 @@
+#include "FeedStreamParser.hpp"
+
+#include <Rss/FeedEncoding.hpp>
+#include <Rss/JsonFeedReader.hpp>
+
+#include <algorithm>
+#include <cerrno>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    const auto INVALID_CONVERTER = reinterpret_cast<iconv_t>(-1);
+
+    bool startsWithPrefixOf(std::string_view text, std::string_view token) {
+      const size_t n = std::min(text.size(), token.size());
+      return text.substr(0, n) == token.substr(0, n);
+    }
+
+  } // namespace
+
+  FeedStreamParser::FeedStreamParser(HeaderHandler onHeader, FeedItemHandler onItem)
+      : onHeader_(std::move(onHeader)), onItem_(std::move(onItem)),
+        arena_(std::make_shared<ItemArena>()) {}
+
+  FeedStreamParser::~FeedStreamParser() {
+    if (converter_ != INVALID_CONVERTER) {
+      iconv_close(converter_);
+    }
+  }
+
+  bool FeedStreamParser::write(std::string_view chunk) {
+    if (state_ == State::Failed || state_ == State::Done) {
+      return state_ != State::Failed;
+    }
+
+    if (encodingKnown_) {
+      decode(chunk);
+    } else {
+      pending_.append(chunk);
+      if (detectEncoding(false)) {
+        std::string head = std::move(pending_);
+        pending_.clear();
+        decode(head);
+      }
+    }
+    peakBufferSize_ = std::max(peakBufferSize_, text_.size());
+
+    scan();
+    return state_ != State::Failed;
+  }
+
+  bool FeedStreamParser::finish() {
+    if (state_ == State::Failed || state_ == State::Done) {
+      return state_ != State::Failed;
+    }
+
+    if (!encodingKnown_) {
+      detectEncoding(true);
+      std::string head = std::move(pending_);
+      pending_.clear();
+      decode(head);
+    }
+    scan();
+
+    if (state_ == State::Json) {
+      emitJsonFeed();
+    } else if (state_ == State::Prolog) {
+      fail("No valid RSS/Atom channel found.");
+    } else if (state_ == State::Header) {
+      // A feed without items: the rest of the document is the header
+      emitHeader(text_.size());
+    }
+    // A truncated last item (State::InItem) is dropped
+    if (state_ != State::Failed) {
+      state_ = State::Done;
+    }
+    text_.clear();
+    return state_ != State::Failed;
+  }
+
+  bool FeedStreamParser::detectEncoding(bool final) {
+    const XmlProlog prolog = scanXmlProlog(pending_, final);
+    if (prolog.incomplete) {
+      return false;
+    }
+
+    encodingKnown_ = true;
+    if (detectFeedFormat({}, pending_) == FeedFormat::JsonFeed) {
+      state_ = State::Json;
+    }
+    if (!isUtf8Compatible(prolog.encoding)) {
+      // A descriptor of its own: chunks of one body may be decoded on different threads.
+      // An unknown encoding is passed through untouched, as the buffered path does.
+      converter_ = iconv_open("UTF-8", std::string(prolog.encoding).c_str());
+    }
+    pending_.erase(0, prolog.bomSize);
+    return true;
+  }
+
+  void FeedStreamParser::decode(std::string_view bytes) {
+    if (converter_ == INVALID_CONVERTER) {
+      text_.append(bytes);
+      return;
+    }
+
+    // Prepend the tail of a multi-byte sequence split across chunks
+    std::string joined;
+    if (!pending_.empty()) {
+      joined = std::move(pending_);
+      pending_.clear();
+      joined.append(bytes);
+      bytes = joined;
+    }
+
+    const char *in = bytes.data();
+    size_t inLeft = bytes.size();
+    while (inLeft > 0) {
+      // Single-byte charsets need at most 3 UTF-8 bytes per input byte; grow on E2BIG
+      const size_t used = text_.size();
+      text_.resize(used + (inLeft * 2) + 16);
+      char *out = text_.data() + used;
+      size_t outLeft = text_.size() - used;
+      const size_t rc = iconv(converter_, const_cast<char **>(&in), &inLeft, &out, &outLeft);
+      text_.resize(text_.size() - outLeft);
+      if (rc != static_cast<size_t>(-1)) {
+        break;
+      }
+      if (errno == E2BIG) {
+        continue;
+      }
+      if (errno == EINVAL) {
+        pending_.assign(in, inLeft); // incomplete sequence, wait for the next chunk
+        break;
+      }
+      // EILSEQ: replace the offending byte and carry on
+      text_ += '?';
+      ++in;
+      --inLeft;
+    }
+  }
+
+  void FeedStreamParser::scan() {
+    while (true) {
+      Scan result = Scan::NeedMore;
+      switch (state_) {
+      case State::Prolog: result = scanProlog(); break;
+      case State::Header: result = scanHeader(); break;
+      case State::Items:
+      case State::InItem: result = scanItems(); break;
+      case State::Json: // read as a whole in finish()
+      case State::Done:
+      case State::Failed: return;
+      }
+      if (result == Scan::NeedMore) {
+        break;
+      }
+    }
+    compact();
+  }
+
+  FeedStreamParser::Scan FeedStreamParser::scanProlog() {
+    while (true) {
+      const size_t lt = text_.find('<', pos_);
+      if (lt == std::string::npos) {
+        pos_ = text_.size();
+        return Scan::NeedMore;
+      }
+      pos_ = lt;
+
+      size_t end = 0;
+      if (skipMarkup(lt, end) == Scan::NeedMore) {
+        return Scan::NeedMore;
+      }
+      if (end != std::string::npos) {
+        pos_ = end;
+        continue;
+      }
+
+      std::string_view name;
+      bool closing = false;
+      bool selfClosing = false;
+      if (readTag(lt, name, closing, selfClosing, end) == Scan::NeedMore) {
+        return Scan::NeedMore;
+      }
+      format_ = feedFormatOfRoot(name);
+      if (format_ == FeedFormat::Rss || format_ == FeedFormat::Rdf) {
+        itemTag_ = "item";
+      } else if (format_ == FeedFormat::Atom) {
+        itemTag_ = "entry";
+      } else {
+        fail("No valid RSS/Atom channel found (root element <" + std::string(name) + ">).");
+        return Scan::Complete;
+      }
+
+      headerStart_ = lt;
+      openElements_.clear();
+      if (!selfClosing) {
+        openElements_.emplace_back(name);
+      }
+      pos_ = end;
+      state_ = State::Header;
+      return Scan::Complete;
+    }
+  }
+
+  FeedStreamParser::Scan FeedStreamParser::scanHeader() {
+    while (true) {
+      const size_t lt = text_.find('<', pos_);
+      if (lt == std::string::npos) {
+        pos_ = text_.size();
+        return Scan::NeedMore;
+      }
+      pos_ = lt;
+
+      size_t end = 0;
+      if (skipMarkup(lt, end) == Scan::NeedMore) {
+        return Scan::NeedMore;
+      }
+      if (end != std::string::npos) {
+        pos_ = end;
+        continue;
+      }
+
+      std::string_view name;
+      bool closing = false;
+      bool selfClosing = false;
+      if (readTag(lt, name, closing, selfClosing, end) == Scan::NeedMore) {
+        return Scan::NeedMore;
+      }
+
+      if (!closing && name == itemTag_) {
+        // The header ends where the first item starts; scanItems re-reads this tag
+        emitHeader(lt);
+        if (state_ != State::Failed) {
+          state_ = State::Items;
+        }
+        return Scan::Complete;
+      }
+
+      if (closing) {
+        auto it = std::find(openElements_.rbegin(), openElements_.rend(), name);
+        if (it != openElements_.rend()) {
+          openElements_.erase(std::prev(it.base()), openElements_.end());
+        }
+      } else if (!selfClosing) {
+        openElements_.emplace_back(name);
+      }
+      pos_ = end;
+    }
+  }
+
+  FeedStreamParser::Scan FeedStreamParser::scanItems() {
+    while (true) {
+      const size_t lt = text_.find('<', pos_);
+      if (lt == std::string::npos) {
+        pos_ = text_.size();
+        return Scan::NeedMore;
+      }
+      pos_ = lt;
+
+      size_t end = 0;
+      if (skipMarkup(lt, end) == Scan::NeedMore) {
+        return Scan::NeedMore;
+      }
+      if (end != std::string::npos) {
+        pos_ = end;
+        continue;
+      }
+
+      std::string_view name;
+      bool closing = false;
+      bool selfClosing = false;
+      if (readTag(lt, name, closing, selfClosing, end) == Scan::NeedMore) {
+        return Scan::NeedMore;
+      }
+      pos_ = end;
+      if (name != itemTag_) {
+        continue;
+      }
+
+      if (state_ == State::Items) {
+        if (closing) {
+          continue;
+        }
+        itemStart_ = lt;
+        if (selfClosing) {
+          emitItem(end);
+        } else {
+          itemDepth_ = 1;
+          state_ = State::InItem;
+        }
+      } else if (closing) {
+        if (--itemDepth_ == 0) {
+          state_ = State::Items;
+          emitItem(end);
+        }
+      } else if (!selfClosing) {
+        ++itemDepth_;
+      }
+      if (stopped_) {
+        state_ = State::Done;
+        text_.clear();
+        pos_ = 0;
+        return Scan::Complete;
+      }
+    }
+  }
+
+  FeedStreamParser::Scan FeedStreamParser::skipMarkup(size_t at, size_t &end) {
+    const std::string_view rest = std::string_view(text_).substr(at);
+    if (rest.size() < 2) {
+      return Scan::NeedMore;
+    }
+    if (rest[1] != '!' && rest[1] != '?') {
+      end = std::string::npos; // an ordinary tag
+      return Scan::Complete;
+    }
+
+    constexpr std::string_view cdata = "<![CDATA[";
+    constexpr std::string_view comment = "<!--";
+    std::string_view terminator = ">"; // <!DOCTYPE ...>; internal subsets are skipped piecewise
+    size_t openLength = 2;
+    if (rest[1] == '?') {
+      terminator = "?>";
+    } else if (rest.starts_with(cdata)) {
+      terminator = "]]>";
+      openLength = cdata.size();
+    } else if (rest.starts_with(comment)) {
+      terminator = "-->";
+      openLength = comment.size();
+    } else if ((rest.size() < cdata.size() && startsWithPrefixOf(rest, cdata)) ||
+               (rest.size() < comment.size() && startsWithPrefixOf(rest, comment))) {
+      return Scan::NeedMore;
+    }
+
+    const size_t from = (pendingAt_ == at) ? pendingSearch_ : at + openLength;
+    const size_t found = text_.find(terminator, from);
+    if (found == std::string::npos) {
+      // Do not rescan a long CDATA section from its start on every chunk
+      pendingAt_ = at;
+      pendingSearch_ = std::max(at + openLength, text_.size() - (terminator.size() - 1));
+      return Scan::NeedMore;
+    }
+    pendingAt_ = std::string::npos;
+    end = found + terminator.size();
+    return Scan::Complete;
+  }
+
+  FeedStreamParser::Scan FeedStreamParser::readTag(size_t at, std::string_view &name,
+                                                   bool &closing, bool &selfClosing,
+                                                   size_t &end) {
+    closing = at + 1 < text_.size() && text_[at + 1] == '/';
+    const size_t nameStart = at + (closing ? 2 : 1);
+    const size_t nameEnd = text_.find_first_of(" \t\r\n/>", nameStart);
+    if (nameEnd == std::string::npos) {
+      return Scan::NeedMore;
+    }
+
+    // Find the closing '>' outside attribute values
+    char quote = 0;
+    size_t i = nameEnd;
+    for (; i < text_.size(); ++i) {
+      const char c = text_[i];
+      if (quote != 0) {
+        if (c == quote) {
+          quote = 0;
+        }
+      } else if (c == '"' || c == '\'') {
+        quote = c;
+      } else if (c == '>') {
+        break;
+      }
+    }
+    if (i == text_.size()) {
+      return Scan::NeedMore;
+    }
+
+    name = std::string_view(text_).substr(nameStart, nameEnd - nameStart);
+    selfClosing = !closing && text_[i - 1] == '/';
+    end = i + 1;
+    return Scan::Complete;
+  }
+
+  void FeedStreamParser::emitHeader(size_t headerEnd) {
+    std::string fragment = text_.substr(headerStart_, headerEnd - headerStart_);
+    for (auto it = openElements_.rbegin(); it != openElements_.rend(); ++it) {
+      fragment += "</" + *it + ">";
+    }
+
+    RSSFeed header;
+    header.arena = arena_;
+    std::string error;
+    if (!readFeedDocument(fragment, header, nullptr, error)) {
+      fail("Feed header is not well-formed: " + error);
+      return;
+    }
+    if (onHeader_) {
+      onHeader_(std::move(header), format_);
+    }
+  }
+
+  void FeedStreamParser::emitItem(size_t itemEnd) {
+    RSSItem item;
+    item.arena = arena_;
+    // A malformed item is skipped; the rest of the feed is still usable
+    if (!readFeedItem(std::string_view(text_).substr(itemStart_, itemEnd - itemStart_), format_,
+                      item)) {
+      return;
+    }
+    itemCount_++;
+    if (onItem_ && !onItem_(std::move(item))) {
+      stopped_ = true;
+    }
+  }
+
+  void FeedStreamParser::emitJsonFeed() {
+    // Header fields may follow the items in a JSON Feed, so the items are only handed over
+    // once the whole document has been read
+    RSSFeed header;
+    header.arena = arena_;
+    std::vector<RSSItem> items;
+    std::string error;
+    auto collect = [&items](RSSItem &&item) {
+      items.push_back(std::move(item));
+      return true;
+    };
+    if (!readJsonFeed(text_, header, collect, error)) {
+      fail(error);
+      return;
+    }
+    format_ = FeedFormat::JsonFeed;
+    if (onHeader_) {
+      onHeader_(std::move(header), format_);
+    }
+    for (RSSItem &item : items) {
+      itemCount_++;
+      if (onItem_ && !onItem_(std::move(item))) {
+        stopped_ = true;
+        break;
+      }
+    }
+  }
+
+  void FeedStreamParser::compact() {
+    size_t keep = pos_;
+    if (state_ == State::Header) {
+      keep = headerStart_;
+    } else if (state_ == State::InItem) {
+      keep = itemStart_;
+    }
+    if (keep == 0) {
+      return;
+    }
+
+    text_.erase(0, keep);
+    pos_ -= keep;
+    headerStart_ -= std::min(headerStart_, keep);
+    itemStart_ -= std::min(itemStart_, keep);
+    if (pendingAt_ != std::string::npos) {
+      pendingAt_ -= keep;
+      pendingSearch_ -= keep;
+    }
+  }
+
+  void FeedStreamParser::fail(std::string message) {
+    state_ = State::Failed;
+    error_ = std::move(message);
+    text_.clear();
+    pending_.clear();
+    pos_ = 0;
+    pendingAt_ = std::string::npos;
+  }
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <Rss/FeedFormat.hpp>
+#include <Rss/FeedReader.hpp>
+#include <Rss/RSSFeed.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iconv.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Incremental RSS 2.0 / RDF / Atom reader fed with raw body chunks.
+   *
+   * Bytes are transcoded to UTF-8 as they arrive (the encoding is taken from the BOM or
+   * the XML declaration) and scanned for item boundaries. The feed header, i.e. everything
+   * between the root element and the first item, and then each complete <item> / <entry>
+   * is read on its own with the FeedReader and handed to the callbacks. Only
+   * the item currently being received is buffered, never the whole body. The header and
+   * all items share one ItemArena for their text.
+   *
+   * Channel elements that follow the items are not reported.
+   *
+   * A JSON Feed, recognised by its leading '{', cannot be cut into items as it arrives: it
+   * is collected and read with readJsonFeed() in finish().
+   */
+  class FeedStreamParser {
+  public:
+    using HeaderHandler = std::function<void(RSSFeed &&header, FeedFormat format)>;
+
+    /**
+     * @brief Construct a new Feed Stream Parser object
+     *
+     * @param onHeader Called once with the header fields of the <channel> (RSS, RDF) or
+     * <feed> (Atom) element, or of the JSON Feed object; the feed has no items
+     * @param onItem Called with every complete, well-formed <item> or <entry>; returning
+     * false stops parsing, and the rest of the body is then ignored
+     */
+    FeedStreamParser(HeaderHandler onHeader, FeedItemHandler onItem);
+    ~FeedStreamParser();
+
+    FeedStreamParser(const FeedStreamParser &) = delete;
+    FeedStreamParser &operator=(const FeedStreamParser &) = delete;
+
+    /**
+     * @brief Feed the next chunk of the raw body
+     *
+     * @param chunk Bytes exactly as received
+     * @return true while the document still looks like a feed, false once it failed
+     */
+    bool write(std::string_view chunk);
+
+    /**
+     * @brief Signal the end of the body and flush what is left
+     *
+     * @return true if a feed was recognised, otherwise false (see error())
+     */
+    bool finish();
+
+    [[nodiscard]] const std::string &error() const { return error_; }
+    [[nodiscard]] size_t itemCount() const { return itemCount_; }
+    // The item handler stopped parsing before the end of the body
+    [[nodiscard]] bool stopped() const { return stopped_; }
+    // Largest amount of decoded text held at once, useful to check memory behaviour
+    [[nodiscard]] size_t peakBufferSize() const { return peakBufferSize_; }
+
+  private:
+    enum class State { Prolog, Header, Items, InItem, Json, Done, Failed };
+    enum class Scan { Complete, NeedMore };
+
+    bool detectEncoding(bool final);
+    void decode(std::string_view bytes);
+    void scan();
+    Scan scanProlog();
+    Scan scanHeader();
+    Scan scanItems();
+    Scan skipMarkup(size_t at, size_t &end);
+    Scan readTag(size_t at, std::string_view &name, bool &closing, bool &selfClosing,
+                 size_t &end);
+    void emitHeader(size_t headerEnd);
+    void emitItem(size_t itemEnd);
+    void emitJsonFeed();
+    void compact();
+    void fail(std::string message);
+
+    HeaderHandler onHeader_;
+    FeedItemHandler onItem_;
+    std::shared_ptr<ItemArena> arena_;
+
+    State state_{State::Prolog};
+    std::string error_;
+
+    // Encoding
+    std::string pending_; // raw bytes not decoded yet (prolog sniffing, split sequences)
+    bool encodingKnown_{false};
+    iconv_t converter_{reinterpret_cast<iconv_t>(-1)};
+
+    // Decoded UTF-8 text still needed; offsets below are relative to it
+    std::string text_;
+    size_t pos_{0};
+    size_t headerStart_{0};
+    size_t itemStart_{0};
+    int itemDepth_{0};
+    // Resume point for a long construct (CDATA, comment) whose terminator has not arrived
+    size_t pendingAt_{std::string::npos};
+    size_t pendingSearch_{0};
+
+    std::string itemTag_;
+    FeedFormat format_{FeedFormat::Unknown};
+    std::vector<std::string> openElements_;
+
+    size_t itemCount_{0};
+    bool stopped_{false};
+    size_t peakBufferSize_{0};
+  };
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,88 @@
+#include "HostRateLimiter.hpp"
+
+#include <algorithm>
+
+namespace dotnamebot::rss {
+
+  HostRateLimiter::HostRateLimiter(HostLimits limits) { setLimits(limits); }
+
+  void HostRateLimiter::setLimits(const HostLimits &limits) {
+    limits_ = limits;
+    limits_.maxConcurrent = std::max<size_t>(1, limits_.maxConcurrent);
+    limits_.burst = std::max(1.0, limits_.burst);
+    if (limits_.requestsPerSecond <= 0.0) {
+      limits_.requestsPerSecond = 1.0;
+    }
+  }
+
+  bool HostRateLimiter::tryAcquire(const std::string &host, Clock::time_point now) {
+    Bucket &bucket = bucketFor(host, now);
+    refill(bucket, now);
+    if (now < bucket.pausedUntil || bucket.inFlight >= limits_.maxConcurrent ||
+        bucket.tokens < 1.0) {
+      return false;
+    }
+    bucket.tokens -= 1.0;
+    bucket.inFlight++;
+    return true;
+  }
+
+  void HostRateLimiter::release(const std::string &host) {
+    auto it = buckets_.find(host);
+    if (it != buckets_.end() && it->second.inFlight > 0) {
+      it->second.inFlight--;
+    }
+  }
+
+  HostRateLimiter::Clock::time_point HostRateLimiter::nextTokenAt(const std::string &host,
+                                                                  Clock::time_point now) const {
+    auto it = buckets_.find(host);
+    if (it == buckets_.end()) {
+      return now;
+    }
+    Bucket bucket = it->second;
+    refill(bucket, now);
+    Clock::time_point at = now;
+    if (bucket.tokens < 1.0) {
+      at += std::chrono::duration_cast<Clock::duration>(
+          std::chrono::duration<double>((1.0 - bucket.tokens) / limits_.requestsPerSecond));
+    }
+    return std::max(at, bucket.pausedUntil);
+  }
+
+  void HostRateLimiter::pauseUntil(const std::string &host, Clock::time_point until) {
+    Bucket &bucket = bucketFor(host, Clock::now());
+    bucket.pausedUntil = std::max(bucket.pausedUntil, until);
+  }
+
+  bool HostRateLimiter::isPaused(const std::string &host, Clock::time_point now) const {
+    auto it = buckets_.find(host);
+    return it != buckets_.end() && now < it->second.pausedUntil;
+  }
+
+  HostRateLimiter::Clock::time_point HostRateLimiter::pausedUntil(const std::string &host) const {
+    auto it = buckets_.find(host);
+    return it != buckets_.end() ? it->second.pausedUntil : Clock::time_point{};
+  }
+
+  HostRateLimiter::Bucket &HostRateLimiter::bucketFor(const std::string &host,
+                                                     Clock::time_point now) {
+    auto [it, inserted] = buckets_.try_emplace(host);
+    if (inserted) {
+      // A new host starts with a full bucket
+      it->second.tokens = limits_.burst;
+      it->second.refilledAt = now;
+    }
+    return it->second;
+  }
+
+  void HostRateLimiter::refill(Bucket &bucket, Clock::time_point now) const {
+    if (now <= bucket.refilledAt) {
+      return;
+    }
+    const double elapsed = std::chrono::duration<double>(now - bucket.refilledAt).count();
+    bucket.tokens = std::min(limits_.burst, bucket.tokens + (elapsed * limits_.requestsPerSecond));
+    bucket.refilledAt = now;
+  }
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Politeness limits applied to every host separately.
+   *
+   */
+  struct HostLimits {
+    // Transfers to one host that may be in flight at the same time
+    size_t maxConcurrent{2};
+    // Token bucket: sustained request rate and the burst allowed on top of it
+    double requestsPerSecond{1.0};
+    double burst{4.0};
+  };
+
+  /**
+   * @brief Per-host token bucket with a concurrency cap and server-requested pauses.
+   *
+   * Not thread-safe; FeedFetcher drives it from its single event loop. Buckets persist
+   * between refreshes, so a host that answered 429 / 503 with Retry-After stays paused
+   * for the next refresh as well.
+   */
+  class HostRateLimiter {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit HostRateLimiter(HostLimits limits = {});
+
+    void setLimits(const HostLimits &limits);
+    [[nodiscard]] const HostLimits &getLimits() const { return limits_; }
+
+    /**
+     * @brief Take a token and a concurrency slot for a request to host if both are free
+     *
+     * @param host Host name as returned by extractDomain
+     * @param now Current time
+     * @return true if the request may start now; release() must follow when it ends
+     */
+    bool tryAcquire(const std::string &host, Clock::time_point now);
+
+    /**
+     * @brief Give back the concurrency slot taken by tryAcquire
+     *
+     * @param host Host name
+     */
+    void release(const std::string &host);
+
+    /**
+     * @brief Earliest time a token for host is available, ignoring the concurrency cap
+     *
+     * @param host Host name
+     * @param now Current time
+     * @return Clock::time_point now when a token is available already
+     */
+    [[nodiscard]] Clock::time_point nextTokenAt(const std::string &host,
+                                                Clock::time_point now) const;
+
+    /**
+     * @brief Pause all requests to host, e.g. on 429 / 503 with Retry-After
+     *
+     * @param host Host name
+     * @param until End of the pause; an earlier pause is never shortened
+     */
+    void pauseUntil(const std::string &host, Clock::time_point until);
+
+    /**
+     * @brief Whether host is paused at the given time
+     *
+     * @param host Host name
+     * @param now Current time
+     * @return true if requests to host must not start before pausedUntil()
+     */
+    [[nodiscard]] bool isPaused(const std::string &host, Clock::time_point now) const;
+    [[nodiscard]] Clock::time_point pausedUntil(const std::string &host) const;
+
+  private:
+    struct Bucket {
+      double tokens{0.0};
+      Clock::time_point refilledAt;
+      size_t inFlight{0};
+      Clock::time_point pausedUntil;
+    };
+
+    Bucket &bucketFor(const std::string &host, Clock::time_point now);
+    void refill(Bucket &bucket, Clock::time_point now) const;
+
+    HostLimits limits_;
+    std::unordered_map<std::string, Bucket> buckets_;
+  };
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,228 @@
+#include "HtmlEntities.hpp"
+#include "HtmlEntityTable.hpp"
+
+#include <Utils/String/TextKernels.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    constexpr uint32_t MAX_CODE_POINT = 0x10FFFF;
+    constexpr uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+    // Longest reference looked up, '&' and ';' included. Covers every named entity and
+    // numeric references with a few leading zeros; longer candidates stay as text, which
+    // keeps the lookback after each ';' constant.
+    constexpr size_t MAX_REFERENCE_LENGTH = 40;
+    static_assert(entities::MAX_NAME_LENGTH + 2 <= MAX_REFERENCE_LENGTH);
+    constexpr utils::ByteSet REFERENCE_DELIMITERS{"&;"};
+
+    constexpr uint32_t entityHash(std::string_view name, uint32_t seed) {
+      uint32_t hash = entities::FNV_OFFSET + seed * entities::SEED_MULTIPLIER;
+      for (char c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= entities::FNV_PRIME;
+      }
+      return hash ^ (hash >> 15);
+    }
+
+    constexpr size_t entitySlot(std::string_view name) {
+      const uint32_t bucket = entityHash(name, 0) % entities::SEEDS.size();
+      return entityHash(name, entities::SEEDS[bucket]) % entities::ENTITIES.size();
+    }
+
+    // The generated table must send every name to its own slot
+    constexpr bool tableIsPerfect() {
+      for (size_t slot = 0; slot < entities::ENTITIES.size(); ++slot) {
+        if (entitySlot(entities::ENTITIES[slot].name) != slot) {
+          return false;
+        }
+      }
+      return true;
+    }
+    static_assert(tableIsPerfect(), "HtmlEntityTable.hpp does not match entityHash");
+
+    bool isAsciiAlnum(char c) {
+      return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    // Anything that may appear between '&' and ';' of a reference
+    bool isReferenceChar(char c) { return isAsciiAlnum(c) || c == '#'; }
+
+    int hexValue(char c) {
+      if (c >= '0' && c <= '9') {
+        return c - '0';
+      }
+      if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+      }
+      if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+      }
+      return -1;
+    }
+
+    // UTF-8 bytes of one code point
+    struct Utf8Char {
+      std::array<char, 4> bytes{};
+      size_t size{0};
+
+      [[nodiscard]] std::string_view view() const { return {bytes.data(), size}; }
+    };
+
+    Utf8Char encodeUtf8(uint32_t codePoint) {
+      Utf8Char utf8;
+      auto put = [&utf8](uint32_t byte) { utf8.bytes[utf8.size++] = static_cast<char>(byte); };
+      if (codePoint <= 0x7F) {
+        put(codePoint);
+      } else if (codePoint <= 0x7FF) {
+        put(0xC0 | (codePoint >> 6));
+        put(0x80 | (codePoint & 0x3F));
+      } else if (codePoint <= 0xFFFF) {
+        put(0xE0 | (codePoint >> 12));
+        put(0x80 | ((codePoint >> 6) & 0x3F));
+        put(0x80 | (codePoint & 0x3F));
+      } else {
+        put(0xF0 | (codePoint >> 18));
+        put(0x80 | ((codePoint >> 12) & 0x3F));
+        put(0x80 | ((codePoint >> 6) & 0x3F));
+        put(0x80 | (codePoint & 0x3F));
+      }
+      return utf8;
+    }
+
+    // Decode the body of &#...; (without '&' and ';'); false when it is not a numeric
+    // reference. An out of range reference decodes to nothing.
+    bool decodeNumeric(std::string_view body, Utf8Char &replacement) {
+      const bool hex = body.size() > 1 && (body[1] == 'x' || body[1] == 'X');
+      const std::string_view digits = body.substr(hex ? 2 : 1);
+      if (digits.empty()) {
+        return false;
+      }
+      uint32_t codePoint = 0;
+      bool tooLarge = false;
+      for (char c : digits) {
+        const int digit = hex ? hexValue(c) : (c >= '0' && c <= '9' ? c - '0' : -1);
+        if (digit < 0) {
+          return false;
+        }
+        if (!tooLarge) {
+          codePoint = codePoint * (hex ? 16 : 10) + static_cast<uint32_t>(digit);
+          tooLarge = codePoint > MAX_CODE_POINT;
+        }
+      }
+      if (tooLarge) {
+        replacement = {};
+        return true;
+      }
+      if (codePoint == 0 || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+        codePoint = REPLACEMENT_CHARACTER;
+      }
+      replacement = encodeUtf8(codePoint);
+      return true;
+    }
+
+    class EntityDecoder {
+    public:
+      explicit EntityDecoder(size_t capacity) { out_.reserve(capacity); }
+
+      void append(std::string_view text) {
+        size_t pos = 0;
+        while (pos < text.size()) {
+          // Copy plain runs in bulk, only '&' and ';' need a closer look
+          const size_t special = utils::findFirstOf(text, REFERENCE_DELIMITERS, pos);
+          if (special == std::string_view::npos) {
+            out_.append(text.substr(pos));
+            return;
+          }
+          out_.append(text.substr(pos, special - pos));
+          if (text[special] == '&') {
+            ampersand_ = out_.size();
+            out_ += '&';
+          } else {
+            out_ += ';';
+            closeReference();
+          }
+          pos = special + 1;
+        }
+      }
+
+      std::string take() { return std::move(out_); }
+
+    private:
+      // Called right after a ';' was appended
+      void closeReference() {
+        if (ampersand_ == std::string::npos) {
+          return;
+        }
+        const size_t start = ampersand_;
+        // Whatever happens, no reference can start before this ';' any more
+        ampersand_ = std::string::npos;
+        if (out_.size() - start > MAX_REFERENCE_LENGTH) {
+          return;
+        }
+        const std::string_view body =
+            std::string_view(out_).substr(start + 1, out_.size() - start - 2);
+
+        Utf8Char numeric;
+        std::string_view replacement;
+        if (!body.empty() && body[0] == '#') {
+          if (!decodeNumeric(body, numeric)) {
+            return;
+          }
+          replacement = numeric.view();
+        } else {
+          replacement = lookupHtmlEntity(body);
+          if (replacement.empty()) {
+            return;
+          }
+        }
+
+        out_.resize(start);
+        // A '&' shortly before the reference may now be completed by the replacement
+        // (&l&#116;; gives &lt; once &#116; is decoded). Only name characters can lie
+        // between it and the end, so the walk back usually stops at once.
+        const size_t limit = out_.size() - std::min(out_.size(), MAX_REFERENCE_LENGTH);
+        size_t previous = out_.size();
+        while (previous > limit && isReferenceChar(out_[previous - 1])) {
+          --previous;
+        }
+        if (previous > limit && out_[previous - 1] == '&') {
+          ampersand_ = previous - 1;
+        }
+        // The replacement goes through the same path, so a decoded '&' or ';' can take
+        // part in another reference (&amp;lt; gives <)
+        append(replacement);
+      }
+
+      std::string out_;
+      // Output position of the '&' that may still start a reference, npos when none
+      size_t ampersand_{std::string::npos};
+    };
+
+  } // namespace
+
+  std::string_view lookupHtmlEntity(std::string_view name) {
+    if (name.empty() || name.size() > entities::MAX_NAME_LENGTH ||
+        !std::all_of(name.begin(), name.end(), isAsciiAlnum)) {
+      return {};
+    }
+    const entities::NamedEntity &entity = entities::ENTITIES[entitySlot(name)];
+    return entity.name == name ? entity.utf8 : std::string_view{};
+  }
+
+  std::string decodeHtmlEntities(std::string_view text) {
+    // Plain text is the common case
+    if (text.find('&') == std::string_view::npos) {
+      return std::string(text);
+    }
+    EntityDecoder decoder(text.size());
+    decoder.append(text);
+    return decoder.take();
+  }
+
+} // namespace dotnamebot::rss
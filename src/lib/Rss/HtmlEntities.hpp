@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Look up an HTML5 named character reference
+   *
+   * @param name Entity name without '&' and ';', e.g. "scaron"
+   * @return std::string_view Replacement in UTF-8, empty when the name is unknown
+   */
+  std::string_view lookupHtmlEntity(std::string_view name);
+
+  /**
+   * @brief Decode numeric (&#353; &#x161;) and HTML5 named (&scaron;) character references
+   * in a single left-to-right pass.
+   *
+   * Double-escaped text such as &amp;#353; or &amp;amp;lt; is resolved fully, as if the
+   * input were decoded again until nothing changes: a reference is looked up whenever a ';'
+   * reaches the output, including one produced by an earlier reference. Numeric references
+   * above U+10FFFF are dropped, U+0000 and surrogates become U+FFFD. Names without the
+   * trailing ';' are left as they are.
+   *
+   * @param text Text with character references
+   * @return std::string The decoded text
+   */
+  std::string decodeHtmlEntities(std::string_view text);
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,2203 @@
+// Generated by scripts/gen-html-entities.py from the HTML5 named character
+// references. Do not edit by hand; rerun the script instead.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace dotnamebot::rss::entities {
+
+  struct NamedEntity {
+    // Name without the leading '&' and the trailing ';'
+    std::string_view name;
+    // Replacement text in UTF-8
+    std::string_view utf8;
+  };
+
+  inline constexpr uint32_t FNV_OFFSET = 2166136261U;
+  inline constexpr uint32_t FNV_PRIME = 16777619U;
+  inline constexpr uint32_t SEED_MULTIPLIER = 0x9E3779B9U;
+  inline constexpr size_t MAX_NAME_LENGTH = 31;
+
+  // Bucket seeds: a name lands in bucket hash(name, 0) % size and then in
+  // slot hash(name, seed) % ENTITIES.size()
+  inline constexpr std::array<uint16_t, 531> SEEDS = {
+    0, 0, 1, 24, 1, 29, 18, 65, 0, 12, 23, 0,
+    49, 23, 123, 8, 7, 126, 17, 1, 1, 82, 0, 17,
+    2, 1, 456, 146, 0, 8, 17, 311, 11, 21, 16, 56,
+    1, 60, 58, 188, 75, 36, 1, 0, 111, 4, 335, 0,
+    1, 38, 60, 16, 201, 183, 59, 33, 1, 62, 13, 90,
+    3, 98, 1, 245, 2, 3, 3, 0, 21, 85, 152, 237,
+    220, 15, 10, 3, 11, 2, 26, 14, 28, 5, 140, 0,
+    69, 116, 357, 12, 0, 36, 103, 10, 20, 6, 324, 7,
+    101, 45, 0, 1, 0, 4, 40, 0, 9, 155, 6, 16,
+    21, 2, 173, 25, 23, 3, 0, 83, 4, 5, 1, 36,
+    25, 41, 113, 24, 112, 7, 32, 0, 43, 37, 2, 213,
+    20, 0, 28, 90, 71, 0, 13, 1, 0, 0, 1, 0,
+    80, 14, 22, 94, 1, 16, 85, 0, 36, 35, 161, 0,
+    70, 2, 50, 19, 20, 1, 1, 3, 87, 82, 314, 50,
+    113, 248, 49, 13, 8, 125, 12, 659, 2, 85, 0, 94,
+    2, 7, 2, 140, 1, 15, 28, 83, 24, 1, 2, 18,
+    2, 57, 8, 1, 100, 50, 22, 27, 772, 18, 4, 20,
+    115, 2, 3, 39, 29, 43, 373, 63, 55, 35, 0, 100,
+    0, 0, 807, 100, 17, 43, 7, 363, 110, 80, 12, 0,
+    54, 5, 18, 0, 72, 3, 7, 313, 22, 123, 124, 17,
+    33, 150, 737, 779, 52, 53, 11, 49, 295, 56, 328, 0,
+    42, 3, 0, 116, 4, 47, 47, 153, 285, 325, 104, 60,
+    183, 314, 36, 66, 12, 1, 798, 24, 144, 4, 2, 23,
+    1073, 16, 765, 31, 9, 19, 34, 100, 243, 205, 88, 6,
+    0, 665, 0, 2, 112, 5, 9, 8, 1808, 60, 447, 147,
+    37, 381, 0, 1, 171, 13, 74, 4, 203, 0, 295, 237,
+    258, 31, 627, 0, 85, 336, 1, 30, 25, 258, 10, 166,
+    3, 155, 323, 78, 19, 0, 81, 263, 349, 139, 1, 16,
+    90, 59, 140, 1284, 2076, 94, 10, 71, 427, 320, 139, 136,
+    10, 314, 283, 28, 358, 13, 312, 390, 12, 540, 365, 1990,
+    86, 12, 2, 2, 2, 61, 100, 218, 4, 8, 19, 331,
+    67, 1, 511, 1, 147, 13, 24, 35, 79, 336, 185, 5,
+    166, 52, 10, 14, 497, 35, 133, 114, 74, 13, 4, 21,
+    140, 360, 211, 81, 4, 245, 37, 3, 122, 60, 1520, 2,
+    144, 110, 172, 4, 101, 221, 25, 623, 1188, 0, 665, 25,
+    21, 122, 5, 6, 602, 482, 2149, 103, 1092, 268, 0, 418,
+    407, 8, 125, 280, 0, 5, 100, 11, 50, 27, 39, 2396,
+    1, 621, 734, 1300, 206, 33, 277, 55, 29, 554, 28, 86,
+    403, 8, 50, 60, 2, 4, 264, 10, 107, 2, 2, 18,
+    214, 967, 82, 162, 0, 95, 72, 197, 230, 51, 95, 2,
+    74, 241, 127, 2075, 123, 161, 97, 0, 562, 468, 349, 2224,
+    196, 10, 195, 63, 1, 263, 288, 2285, 1623, 815, 4, 1,
+    2, 32, 136, 50, 2843, 94, 38, 45, 546, 36, 182, 433,
+    6008, 2, 60, 10, 303, 1399, 3, 52, 393, 296, 1465, 536,
+    975, 508, 12,
+  };
+
+  inline constexpr std::array<NamedEntity, 2125> ENTITIES = {{
+    {"cscr", "\360\235\222\270"},
+    {"ni", "\342\210\213"},
+    {"smt", "\342\252\252"},
+    {"DiacriticalDoubleAcute", "\313\235"},
+    {"blacklozenge", "\342\247\253"},
+    {"gammad", "\317\235"},
+    {"wreath", "\342\211\200"},
+    {"nharr", "\342\206\256"},
+    {"grave", "`"},
+    {"leftharpoonup", "\342\206\274"},
+    {"odiv", "\342\250\270"},
+    {"Cacute", "\304\206"},
+    {"Vscr", "\360\235\222\261"},
+    {"rbrace", "}"},
+    {"conint", "\342\210\256"},
+    {"RightDownVectorBar", "\342\245\225"},
+    {"FilledSmallSquare", "\342\227\274"},
+    {"zcaron", "\305\276"},
+    {"macr", "\302\257"},
+    {"lacute", "\304\272"},
+    {"DownLeftVectorBar", "\342\245\226"},
+    {"timesb", "\342\212\240"},
+    {"longleftarrow", "\342\237\265"},
+    {"upharpoonleft", "\342\206\277"},
+    {"Lcaron", "\304\275"},
+    {"YIcy", "\320\207"},
+    {"pertenk", "\342\200\261"},
+    {"DScy", "\320\205"},
+    {"digamma", "\317\235"},
+    {"nsce", "\342\252\260\314\270"},
+    {"upharpoonright", "\342\206\276"},
+    {"circledcirc", "\342\212\232"},
+    {"Umacr", "\305\252"},
+    {"circeq", "\342\211\227"},
+    {"marker", "\342\226\256"},
+    {"Epsilon", "\316\225"},
+    {"varsubsetneqq", "\342\253\213\357\270\200"},
+    {"lesseqgtr", "\342\213\232"},
+    {"UpDownArrow", "\342\206\225"},
+    {"precsim", "\342\211\276"},
+    {"minusd", "\342\210\270"},
+    {"CircleTimes", "\342\212\227"},
+    {"DownLeftTeeVector", "\342\245\236"},
+    {"aacute", "\303\241"},
+    {"ges", "\342\251\276"},
+    {"cuepr", "\342\213\236"},
+    {"GreaterFullEqual", "\342\211\247"},
+    {"Supset", "\342\213\221"},
+    {"equals", "="},
+    {"minus", "\342\210\222"},
+    {"supplus", "\342\253\200"},
+    {"curlyeqprec", "\342\213\236"},
+    {"YAcy", "\320\257"},
+    {"smile", "\342\214\243"},
+    {"congdot", "\342\251\255"},
+    {"trianglelefteq", "\342\212\264"},
+    {"iota", "\316\271"},
+    {"PrecedesEqual", "\342\252\257"},
+    {"spades", "\342\231\240"},
+    {"sacute", "\305\233"},
+    {"LessGreater", "\342\211\266"},
+    {"excl", "!"},
+    {"rlarr", "\342\207\204"},
+    {"DownRightTeeVector", "\342\245\237"},
+    {"NotLeftTriangle", "\342\213\252"},
+    {"gesl", "\342\213\233\357\270\200"},
+    {"comp", "\342\210\201"},
+    {"ccaron", "\304\215"},
+    {"Wedge", "\342\213\200"},
+    {"Zdot", "\305\273"},
+    {"upsi", "\317\205"},
+    {"plustwo", "\342\250\247"},
+    {"NotLessTilde", "\342\211\264"},
+    {"dscr", "\360\235\222\271"},
+    {"mldr", "\342\200\246"},
+    {"precnapprox", "\342\252\271"},
+    {"oscr", "\342\204\264"},
+    {"xmap", "\342\237\274"},
+    {"colon", ":"},
+    {"DownArrow", "\342\206\223"},
+    {"srarr", "\342\206\222"},
+    {"Delta", "\316\224"},
+    {"nacute", "\305\204"},
+    {"CircleDot", "\342\212\231"},
+    {"TripleDot", "\342\203\233"},
+    {"gimel", "\342\204\267"},
+    {"scy", "\321\201"},
+    {"NotElement", "\342\210\211"},
+    {"Bumpeq", "\342\211\216"},
+    {"Integral", "\342\210\253"},
+    {"complexes", "\342\204\202"},
+    {"sup1", "\302\271"},
+    {"nwarhk", "\342\244\243"},
+    {"ldquo", "\342\200\234"},
+    {"qint", "\342\250\214"},
+    {"SquareSupersetEqual", "\342\212\222"},
+    {"ImaginaryI", "\342\205\210"},
+    {"Gbreve", "\304\236"},
+    {"iquest", "\302\277"},
+    {"simrarr", "\342\245\262"},
+    {"NewLine", "\012"},
+    {"rightarrow", "\342\206\222"},
+    {"DoubleRightTee", "\342\212\250"},
+    {"langle", "\342\237\250"},
+    {"nleq", "\342\211\260"},
+    {"ssmile", "\342\214\243"},
+    {"nsube", "\342\212\210"},
+    {"NotPrecedes", "\342\212\200"},
+    {"Square", "\342\226\241"},
+    {"mp", "\342\210\223"},
+    {"hkswarow", "\342\244\246"},
+    {"Rcedil", "\305\226"},
+    {"thorn", "\303\276"},
+    {"smeparsl", "\342\247\244"},
+    {"HorizontalLine", "\342\224\200"},
+    {"frac23", "\342\205\224"},
+    {"chi", "\317\207"},
+    {"OverBrace", "\342\217\236"},
+    {"Popf", "\342\204\231"},
+    {"HARDcy", "\320\252"},
+    {"rarrc", "\342\244\263"},
+    {"ntrianglelefteq", "\342\213\254"},
+    {"InvisibleTimes", "\342\201\242"},
+    {"SucceedsTilde", "\342\211\277"},
+    {"varepsilon", "\317\265"},
+    {"questeq", "\342\211\237"},
+    {"coprod", "\342\210\220"},
+    {"UpperRightArrow", "\342\206\227"},
+    {"sigmav", "\317\202"},
+    {"kappa", "\316\272"},
+    {"xharr", "\342\237\267"},
+    {"Lacute", "\304\271"},
+    {"Backslash", "\342\210\226"},
+    {"nang", "\342\210\240\342\203\222"},
+    {"uopf", "\360\235\225\246"},
+    {"LeftUpTeeVector", "\342\245\240"},
+    {"gjcy", "\321\223"},
+    {"xlarr", "\342\237\265"},
+    {"blank", "\342\220\243"},
+    {"Cedilla", "\302\270"},
+    {"lcy", "\320\273"},
+    {"blacktriangledown", "\342\226\276"},
+    {"iinfin", "\342\247\234"},
+    {"vopf", "\360\235\225\247"},
+    {"Verbar", "\342\200\226"},
+    {"SquareUnion", "\342\212\224"},
+    {"curvearrowleft", "\342\206\266"},
+    {"DoubleRightArrow", "\342\207\222"},
+    {"rightleftharpoons", "\342\207\214"},
+    {"odash", "\342\212\235"},
+    {"slarr", "\342\206\220"},
+    {"lbbrk", "\342\235\262"},
+    {"nwnear", "\342\244\247"},
+    {"equiv", "\342\211\241"},
+    {"lsh", "\342\206\260"},
+    {"bigtriangleup", "\342\226\263"},
+    {"triangleq", "\342\211\234"},
+    {"mcomma", "\342\250\251"},
+    {"DiacriticalDot", "\313\231"},
+    {"Pscr", "\360\235\222\253"},
+    {"sharp", "\342\231\257"},
+    {"cdot", "\304\213"},
+    {"kappav", "\317\260"},
+    {"HilbertSpace", "\342\204\213"},
+    {"omacr", "\305\215"},
+    {"kjcy", "\321\234"},
+    {"bigodot", "\342\250\200"},
+    {"LongLeftArrow", "\342\237\265"},
+    {"capand", "\342\251\204"},
+    {"wedge", "\342\210\247"},
+    {"bigotimes", "\342\250\202"},
+    {"lhblk", "\342\226\204"},
+    {"xfr", "\360\235\224\265"},
+    {"hbar", "\342\204\217"},
+    {"larrtl", "\342\206\242"},
+    {"scnap", "\342\252\272"},
+    {"dotsquare", "\342\212\241"},
+    {"Lsh", "\342\206\260"},
+    {"lowbar", "_"},
+    {"cupcap", "\342\251\206"},
+    {"dHar", "\342\245\245"},
+    {"rsquor", "\342\200\231"},
+    {"mapstoleft", "\342\206\244"},
+    {"Igrave", "\303\214"},
+    {"simg", "\342\252\236"},
+    {"le", "\342\211\244"},
+    {"Beta", "\316\222"},
+    {"horbar", "\342\200\225"},
+    {"zwj", "\342\200\215"},
+    {"Ubrcy", "\320\216"},
+    {"OElig", "\305\222"},
+    {"boxtimes", "\342\212\240"},
+    {"Scaron", "\305\240"},
+    {"rho", "\317\201"},
+    {"quest", "\077"},
+    {"GJcy", "\320\203"},
+    {"LeftDownTeeVector", "\342\245\241"},
+    {"MinusPlus", "\342\210\223"},
+    {"Rarr", "\342\206\240"},
+    {"Acy", "\320\220"},
+    {"gfr", "\360\235\224\244"},
+    {"urcorner", "\342\214\235"},
+    {"toea", "\342\244\250"},
+    {"sce", "\342\252\260"},
+    {"Vdashl", "\342\253\246"},
+    {"roang", "\342\237\255"},
+    {"DownRightVectorBar", "\342\245\227"},
+    {"orderof", "\342\204\264"},
+    {"larrsim", "\342\245\263"},
+    {"RightCeiling", "\342\214\211"},
+    {"acE", "\342\210\276\314\263"},
+    {"boxhD", "\342\225\245"},
+    {"weierp", "\342\204\230"},
+    {"bumpE", "\342\252\256"},
+    {"popf", "\360\235\225\241"},
+    {"andslope", "\342\251\230"},
+    {"CapitalDifferentialD", "\342\205\205"},
+    {"trianglerighteq", "\342\212\265"},
+    {"nvgt", ">\342\203\222"},
+    {"hookrightarrow", "\342\206\252"},
+    {"Gscr", "\360\235\222\242"},
+    {"frac14", "\302\274"},
+    {"Udblac", "\305\260"},
+    {"neArr", "\342\207\227"},
+    {"Nacute", "\305\203"},
+    {"Gcy", "\320\223"},
+    {"Ccirc", "\304\210"},
+    {"oopf", "\360\235\225\240"},
+    {"Xscr", "\360\235\222\263"},
+    {"dashv", "\342\212\243"},
+    {"lat", "\342\252\253"},
+    {"zigrarr", "\342\207\235"},
+    {"nexists", "\342\210\204"},
+    {"notni", "\342\210\214"},
+    {"setmn", "\342\210\226"},
+    {"xhArr", "\342\237\272"},
+    {"trade", "\342\204\242"},
+    {"ntrianglerighteq", "\342\213\255"},
+    {"drbkarow", "\342\244\220"},
+    {"cup", "\342\210\252"},
+    {"dash", "\342\200\220"},
+    {"nrarrc", "\342\244\263\314\270"},
+    {"ovbar", "\342\214\275"},
+    {"LeftDownVectorBar", "\342\245\231"},
+    {"latail", "\342\244\231"},
+    {"Kcedil", "\304\266"},
+    {"cuvee", "\342\213\216"},
+    {"mapsto", "\342\206\246"},
+    {"aogon", "\304\205"},
+    {"rsquo", "\342\200\231"},
+    {"boxvr", "\342\224\234"},
+    {"umacr", "\305\253"},
+    {"ring", "\313\232"},
+    {"Cdot", "\304\212"},
+    {"oline", "\342\200\276"},
+    {"Superset", "\342\212\203"},
+    {"zscr", "\360\235\223\217"},
+    {"cupdot", "\342\212\215"},
+    {"qopf", "\360\235\225\242"},
+    {"npolint", "\342\250\224"},
+    {"nap", "\342\211\211"},
+    {"Iuml", "\303\217"},
+    {"ntriangleleft", "\342\213\252"},
+    {"frac78", "\342\205\236"},
+    {"rAarr", "\342\207\233"},
+    {"rightsquigarrow", "\342\206\235"},
+    {"ge", "\342\211\245"},
+    {"RightTeeVector", "\342\245\233"},
+    {"mu", "\316\274"},
+    {"lceil", "\342\214\210"},
+    {"ltcc", "\342\252\246"},
+    {"lnap", "\342\252\211"},
+    {"ap", "\342\211\210"},
+    {"nlE", "\342\211\246\314\270"},
+    {"prod", "\342\210\217"},
+    {"nsccue", "\342\213\241"},
+    {"brvbar", "\302\246"},
+    {"angrtvbd", "\342\246\235"},
+    {"wedgeq", "\342\211\231"},
+    {"rlm", "\342\200\217"},
+    {"ngt", "\342\211\257"},
+    {"bnequiv", "\342\211\241\342\203\245"},
+    {"Ncedil", "\305\205"},
+    {"lparlt", "\342\246\223"},
+    {"SucceedsSlantEqual", "\342\211\275"},
+    {"NotGreaterFullEqual", "\342\211\247\314\270"},
+    {"vnsup", "\342\212\203\342\203\222"},
+    {"complement", "\342\210\201"},
+    {"nGt", "\342\211\253\342\203\222"},
+    {"micro", "\302\265"},
+    {"uparrow", "\342\206\221"},
+    {"Oacute", "\303\223"},
+    {"frac45", "\342\205\230"},
+    {"blk34", "\342\226\223"},
+    {"omicron", "\316\277"},
+    {"uHar", "\342\245\243"},
+    {"uogon", "\305\263"},
+    {"oelig", "\305\223"},
+    {"prec", "\342\211\272"},
+    {"lsim", "\342\211\262"},
+    {"lfloor", "\342\214\212"},
+    {"frac13", "\342\205\223"},
+    {"Iukcy", "\320\206"},
+    {"nleftarrow", "\342\206\232"},
+    {"triangledown", "\342\226\277"},
+    {"numero", "\342\204\226"},
+    {"angmsdaa", "\342\246\250"},
+    {"NotNestedGreaterGreater", "\342\252\242\314\270"},
+    {"par", "\342\210\245"},
+    {"apE", "\342\251\260"},
+    {"mho", "\342\204\247"},
+    {"iscr", "\360\235\222\276"},
+    {"nles", "\342\251\275\314\270"},
+    {"lEg", "\342\252\213"},
+    {"Xi", "\316\236"},
+    {"Idot", "\304\260"},
+    {"imof", "\342\212\267"},
+    {"succnsim", "\342\213\251"},
+    {"swnwar", "\342\244\252"},
+    {"psi", "\317\210"},
+    {"Gt", "\342\211\253"},
+    {"Ubreve", "\305\254"},
+    {"diams", "\342\231\246"},
+    {"approx", "\342\211\210"},
+    {"laquo", "\302\253"},
+    {"supne", "\342\212\213"},
+    {"trie", "\342\211\234"},
+    {"CloseCurlyDoubleQuote", "\342\200\235"},
+    {"jcy", "\320\271"},
+    {"searrow", "\342\206\230"},
+    {"nexist", "\342\210\204"},
+    {"half", "\302\275"},
+    {"glj", "\342\252\244"},
+    {"minusb", "\342\212\237"},
+    {"lates", "\342\252\255\357\270\200"},
+    {"Subset", "\342\213\220"},
+    {"rbbrk", "\342\235\263"},
+    {"Gopf", "\360\235\224\276"},
+    {"nrArr", "\342\207\217"},
+    {"barwed", "\342\214\205"},
+    {"Rho", "\316\241"},
+    {"isinsv", "\342\213\263"},
+    {"qfr", "\360\235\224\256"},
+    {"nsubE", "\342\253\205\314\270"},
+    {"subseteq", "\342\212\206"},
+    {"RightDownTeeVector", "\342\245\235"},
+    {"Gcirc", "\304\234"},
+    {"xutri", "\342\226\263"},
+    {"supe", "\342\212\207"},
+    {"bull", "\342\200\242"},
+    {"ropf", "\360\235\225\243"},
+    {"bigsqcup", "\342\250\206"},
+    {"notnivb", "\342\213\276"},
+    {"check", "\342\234\223"},
+    {"rAtail", "\342\244\234"},
+    {"SquareSuperset", "\342\212\220"},
+    {"leg", "\342\213\232"},
+    {"NotTildeEqual", "\342\211\204"},
+    {"lscr", "\360\235\223\201"},
+    {"supdsub", "\342\253\230"},
+    {"RightTeeArrow", "\342\206\246"},
+    {"Icy", "\320\230"},
+    {"parsl", "\342\253\275"},
+    {"boxH", "\342\225\220"},
+    {"ic", "\342\201\243"},
+    {"lang", "\342\237\250"},
+    {"Mcy", "\320\234"},
+    {"gneq", "\342\252\210"},
+    {"notindot", "\342\213\265\314\270"},
+    {"vBar", "\342\253\250"},
+    {"gnsim", "\342\213\247"},
+    {"commat", "@"},
+    {"Chi", "\316\247"},
+    {"nrtrie", "\342\213\255"},
+    {"disin", "\342\213\262"},
+    {"NotLeftTriangleBar", "\342\247\217\314\270"},
+    {"xnis", "\342\213\273"},
+    {"dagger", "\342\200\240"},
+    {"rdquo", "\342\200\235"},
+    {"scap", "\342\252\270"},
+    {"Ifr", "\342\204\221"},
+    {"uscr", "\360\235\223\212"},
+    {"COPY", "\302\251"},
+    {"ngtr", "\342\211\257"},
+    {"hairsp", "\342\200\212"},
+    {"SHcy", "\320\250"},
+    {"robrk", "\342\237\247"},
+    {"nLeftrightarrow", "\342\207\216"},
+    {"ncedil", "\305\206"},
+    {"Ocirc", "\303\224"},
+    {"scE", "\342\252\264"},
+    {"Alpha", "\316\221"},
+    {"boxDr", "\342\225\223"},
+    {"boxuL", "\342\225\233"},
+    {"GreaterSlantEqual", "\342\251\276"},
+    {"blacksquare", "\342\226\252"},
+    {"nvDash", "\342\212\255"},
+    {"Hstrok", "\304\246"},
+    {"wscr", "\360\235\223\214"},
+    {"dfisht", "\342\245\277"},
+    {"boxvH", "\342\225\252"},
+    {"submult", "\342\253\201"},
+    {"nshortparallel", "\342\210\246"},
+    {"rangd", "\342\246\222"},
+    {"thinsp", "\342\200\211"},
+    {"ange", "\342\246\244"},
+    {"mumap", "\342\212\270"},
+    {"rarrtl", "\342\206\243"},
+    {"coloneq", "\342\211\224"},
+    {"pm", "\302\261"},
+    {"ncup", "\342\251\202"},
+    {"jsercy", "\321\230"},
+    {"infintie", "\342\247\235"},
+    {"Nfr", "\360\235\224\221"},
+    {"Proportion", "\342\210\267"},
+    {"Iota", "\316\231"},
+    {"boxvl", "\342\224\244"},
+    {"racute", "\305\225"},
+    {"ratio", "\342\210\266"},
+    {"hercon", "\342\212\271"},
+    {"Phi", "\316\246"},
+    {"plusb", "\342\212\236"},
+    {"Ecaron", "\304\232"},
+    {"prnE", "\342\252\265"},
+    {"race", "\342\210\275\314\261"},
+    {"hfr", "\360\235\224\245"},
+    {"preccurlyeq", "\342\211\274"},
+    {"Dashv", "\342\253\244"},
+    {"caron", "\313\207"},
+    {"larrb", "\342\207\244"},
+    {"longmapsto", "\342\237\274"},
+    {"hardcy", "\321\212"},
+    {"GreaterGreater", "\342\252\242"},
+    {"ltri", "\342\227\203"},
+    {"Omega", "\316\251"},
+    {"squ", "\342\226\241"},
+    {"rbarr", "\342\244\215"},
+    {"succnapprox", "\342\252\272"},
+    {"zcy", "\320\267"},
+    {"PartialD", "\342\210\202"},
+    {"RightUpTeeVector", "\342\245\234"},
+    {"sim", "\342\210\274"},
+    {"RightTriangleBar", "\342\247\220"},
+    {"csub", "\342\253\217"},
+    {"imacr", "\304\253"},
+    {"profline", "\342\214\222"},
+    {"rhard", "\342\207\201"},
+    {"bigwedge", "\342\213\200"},
+    {"utilde", "\305\251"},
+    {"DownTee", "\342\212\244"},
+    {"ngsim", "\342\211\265"},
+    {"fscr", "\360\235\222\273"},
+    {"scpolint", "\342\250\223"},
+    {"gsim", "\342\211\263"},
+    {"dotminus", "\342\210\270"},
+    {"tilde", "\313\234"},
+    {"ograve", "\303\262"},
+    {"subsup", "\342\253\223"},
+    {"intprod", "\342\250\274"},
+    {"SuchThat", "\342\210\213"},
+    {"larrhk", "\342\206\251"},
+    {"block", "\342\226\210"},
+    {"gtreqqless", "\342\252\214"},
+    {"thetasym", "\317\221"},
+    {"multimap", "\342\212\270"},
+    {"preceq", "\342\252\257"},
+    {"DDotrahd", "\342\244\221"},
+    {"bfr", "\360\235\224\237"},
+    {"yacy", "\321\217"},
+    {"nabla", "\342\210\207"},
+    {"ShortDownArrow", "\342\206\223"},
+    {"InvisibleComma", "\342\201\243"},
+    {"Euml", "\303\213"},
+    {"backsimeq", "\342\213\215"},
+    {"Racute", "\305\224"},
+    {"eqslantgtr", "\342\252\226"},
+    {"nsup", "\342\212\205"},
+    {"scedil", "\305\237"},
+    {"DownLeftRightVector", "\342\245\220"},
+    {"quot", "\042"},
+    {"SquareSubsetEqual", "\342\212\221"},
+    {"rtri", "\342\226\271"},
+    {"boxv", "\342\224\202"},
+    {"UnderBar", "_"},
+    {"leftrightarrow", "\342\206\224"},
+    {"nRightarrow", "\342\207\217"},
+    {"Jcirc", "\304\264"},
+    {"ycirc", "\305\267"},
+    {"lesdotor", "\342\252\203"},
+    {"scaron", "\305\241"},
+    {"bullet", "\342\200\242"},
+    {"Uring", "\305\256"},
+    {"osol", "\342\212\230"},
+    {"Bernoullis", "\342\204\254"},
+    {"vltri", "\342\212\262"},
+    {"intlarhk", "\342\250\227"},
+    {"female", "\342\231\200"},
+    {"sup2", "\302\262"},
+    {"HumpEqual", "\342\211\217"},
+    {"Ofr", "\360\235\224\222"},
+    {"Tcedil", "\305\242"},
+    {"LessEqualGreater", "\342\213\232"},
+    {"rscr", "\360\235\223\207"},
+    {"OverBar", "\342\200\276"},
+    {"it", "\342\201\242"},
+    {"nvrArr", "\342\244\203"},
+    {"emsp13", "\342\200\204"},
+    {"integers", "\342\204\244"},
+    {"ldrushar", "\342\245\213"},
+    {"ThickSpace", "\342\201\237\342\200\212"},
+    {"IEcy", "\320\225"},
+    {"Bfr", "\360\235\224\205"},
+    {"npar", "\342\210\246"},
+    {"parsim", "\342\253\263"},
+    {"bsim", "\342\210\275"},
+    {"frac35", "\342\205\227"},
+    {"otimes", "\342\212\227"},
+    {"Rarrtl", "\342\244\226"},
+    {"AMP", "&"},
+    {"euml", "\303\253"},
+    {"ell", "\342\204\223"},
+    {"dd", "\342\205\206"},
+    {"omega", "\317\211"},
+    {"Vert", "\342\200\226"},
+    {"therefore", "\342\210\264"},
+    {"boxhd", "\342\224\254"},
+    {"tprime", "\342\200\264"},
+    {"MediumSpace", "\342\201\237"},
+    {"nsubseteq", "\342\212\210"},
+    {"tstrok", "\305\247"},
+    {"hybull", "\342\201\203"},
+    {"Upsi", "\317\222"},
+    {"fllig", "\357\254\202"},
+    {"tosa", "\342\244\251"},
+    {"apacir", "\342\251\257"},
+    {"Uogon", "\305\262"},
+    {"ropar", "\342\246\206"},
+    {"natural", "\342\231\256"},
+    {"fflig", "\357\254\200"},
+    {"ll", "\342\211\252"},
+    {"lneq", "\342\252\207"},
+    {"Ncy", "\320\235"},
+    {"ufisht", "\342\245\276"},
+    {"mcy", "\320\274"},
+    {"Aopf", "\360\235\224\270"},
+    {"LT", "<"},
+    {"UpEquilibrium", "\342\245\256"},
+    {"lAarr", "\342\207\232"},
+    {"DoubleUpDownArrow", "\342\207\225"},
+    {"int", "\342\210\253"},
+    {"varsubsetneq", "\342\212\212\357\270\200"},
+    {"ffr", "\360\235\224\243"},
+    {"rtrie", "\342\212\265"},
+    {"DoubleLongLeftRightArrow", "\342\237\272"},
+    {"circleddash", "\342\212\235"},
+    {"ccaps", "\342\251\215"},
+    {"wedbar", "\342\251\237"},
+    {"zeta", "\316\266"},
+    {"Jopf", "\360\235\225\201"},
+    {"hookleftarrow", "\342\206\251"},
+    {"fnof", "\306\222"},
+    {"LeftUpVectorBar", "\342\245\230"},
+    {"nesim", "\342\211\202\314\270"},
+    {"Topf", "\360\235\225\213"},
+    {"Dfr", "\360\235\224\207"},
+    {"lt", "<"},
+    {"nLl", "\342\213\230\314\270"},
+    {"wfr", "\360\235\224\264"},
+    {"Rightarrow", "\342\207\222"},
+    {"NotSuperset", "\342\212\203\342\203\222"},
+    {"dscy", "\321\225"},
+    {"lesssim", "\342\211\262"},
+    {"notnivc", "\342\213\275"},
+    {"Fouriertrf", "\342\204\261"},
+    {"NotGreaterTilde", "\342\211\265"},
+    {"bigtriangledown", "\342\226\275"},
+    {"gbreve", "\304\237"},
+    {"Auml", "\303\204"},
+    {"bumpeq", "\342\211\217"},
+    {"Vvdash", "\342\212\252"},
+    {"hksearow", "\342\244\245"},
+    {"NotTildeFullEqual", "\342\211\207"},
+    {"NegativeThinSpace", "\342\200\213"},
+    {"Im", "\342\204\221"},
+    {"efDot", "\342\211\222"},
+    {"hArr", "\342\207\224"},
+    {"fallingdotseq", "\342\211\222"},
+    {"planckh", "\342\204\216"},
+    {"rightleftarrows", "\342\207\204"},
+    {"lsime", "\342\252\215"},
+    {"leqq", "\342\211\246"},
+    {"Longleftrightarrow", "\342\237\272"},
+    {"ac", "\342\210\276"},
+    {"Zcy", "\320\227"},
+    {"angmsdae", "\342\246\254"},
+    {"hscr", "\360\235\222\275"},
+    {"HumpDownHump", "\342\211\216"},
+    {"DoubleContourIntegral", "\342\210\257"},
+    {"efr", "\360\235\224\242"},
+    {"boxdl", "\342\224\220"},
+    {"Cross", "\342\250\257"},
+    {"dblac", "\313\235"},
+    {"ltquest", "\342\251\273"},
+    {"plusdu", "\342\250\245"},
+    {"alpha", "\316\261"},
+    {"sopf", "\360\235\225\244"},
+    {"angmsdah", "\342\246\257"},
+    {"Ufr", "\360\235\224\230"},
+    {"die", "\302\250"},
+    {"blk14", "\342\226\221"},
+    {"target", "\342\214\226"},
+    {"af", "\342\201\241"},
+    {"sime", "\342\211\203"},
+    {"omid", "\342\246\266"},
+    {"escr", "\342\204\257"},
+    {"Breve", "\313\230"},
+    {"rthree", "\342\213\214"},
+    {"ntriangleright", "\342\213\253"},
+    {"sum", "\342\210\221"},
+    {"RightVectorBar", "\342\245\223"},
+    {"boxdR", "\342\225\222"},
+    {"rightrightarrows", "\342\207\211"},
+    {"curlyvee", "\342\213\216"},
+    {"lvnE", "\342\211\250\357\270\200"},
+    {"NegativeVeryThinSpace", "\342\200\213"},
+    {"seArr", "\342\207\230"},
+    {"infin", "\342\210\236"},
+    {"LeftFloor", "\342\214\212"},
+    {"dlcrop", "\342\214\215"},
+    {"ExponentialE", "\342\205\207"},
+    {"nlsim", "\342\211\264"},
+    {"raemptyv", "\342\246\263"},
+    {"rightharpoondown", "\342\207\201"},
+    {"OverBracket", "\342\216\264"},
+    {"Downarrow", "\342\207\223"},
+    {"ldca", "\342\244\266"},
+    {"drcrop", "\342\214\214"},
+    {"DoubleLongRightArrow", "\342\237\271"},
+    {"bdquo", "\342\200\236"},
+    {"boxdr", "\342\224\214"},
+    {"angmsdad", "\342\246\253"},
+    {"Diamond", "\342\213\204"},
+    {"EqualTilde", "\342\211\202"},
+    {"comma", ","},
+    {"subsim", "\342\253\207"},
+    {"LeftAngleBracket", "\342\237\250"},
+    {"boxV", "\342\225\221"},
+    {"nGg", "\342\213\231\314\270"},
+    {"el", "\342\252\231"},
+    {"NotDoubleVerticalBar", "\342\210\246"},
+    {"ddotseq", "\342\251\267"},
+    {"acy", "\320\260"},
+    {"gl", "\342\211\267"},
+    {"nvlArr", "\342\244\202"},
+    {"Ncaron", "\305\207"},
+    {"yopf", "\360\235\225\252"},
+    {"downharpoonleft", "\342\207\203"},
+    {"frac18", "\342\205\233"},
+    {"niv", "\342\210\213"},
+    {"rbrack", "]"},
+    {"NotCupCap", "\342\211\255"},
+    {"LongLeftRightArrow", "\342\237\267"},
+    {"geqq", "\342\211\247"},
+    {"supedot", "\342\253\204"},
+    {"chcy", "\321\207"},
+    {"EmptyVerySmallSquare", "\342\226\253"},
+    {"pound", "\302\243"},
+    {"caps", "\342\210\251\357\270\200"},
+    {"gamma", "\316\263"},
+    {"gneqq", "\342\211\251"},
+    {"softcy", "\321\214"},
+    {"curlyeqsucc", "\342\213\237"},
+    {"DoubleDot", "\302\250"},
+    {"qscr", "\360\235\223\206"},
+    {"iiota", "\342\204\251"},
+    {"harr", "\342\206\224"},
+    {"egsdot", "\342\252\230"},
+    {"triplus", "\342\250\271"},
+    {"RightUpVectorBar", "\342\245\224"},
+    {"circ", "\313\206"},
+    {"nlarr", "\342\206\232"},
+    {"DotEqual", "\342\211\220"},
+    {"rarrfs", "\342\244\236"},
+    {"mapstodown", "\342\206\247"},
+    {"zeetrf", "\342\204\250"},
+    {"nge", "\342\211\261"},
+    {"smte", "\342\252\254"},
+    {"jopf", "\360\235\225\233"},
+    {"hamilt", "\342\204\213"},
+    {"Kfr", "\360\235\224\216"},
+    {"CupCap", "\342\211\215"},
+    {"sqsub", "\342\212\217"},
+    {"nLeftarrow", "\342\207\215"},
+    {"iexcl", "\302\241"},
+    {"Eogon", "\304\230"},
+    {"pointint", "\342\250\225"},
+    {"nleqq", "\342\211\246\314\270"},
+    {"rarr", "\342\206\222"},
+    {"bcong", "\342\211\214"},
+    {"ShortRightArrow", "\342\206\222"},
+    {"Implies", "\342\207\222"},
+    {"NJcy", "\320\212"},
+    {"blacktriangleleft", "\342\227\202"},
+    {"frown", "\342\214\242"},
+    {"Yopf", "\360\235\225\220"},
+    {"KJcy", "\320\214"},
+    {"uuml", "\303\274"},
+    {"igrave", "\303\254"},
+    {"GreaterEqual", "\342\211\245"},
+    {"expectation", "\342\204\260"},
+    {"jfr", "\360\235\224\247"},
+    {"part", "\342\210\202"},
+    {"iukcy", "\321\226"},
+    {"LeftVector", "\342\206\274"},
+    {"NotTildeTilde", "\342\211\211"},
+    {"Emacr", "\304\222"},
+    {"zdot", "\305\274"},
+    {"GreaterEqualLess", "\342\213\233"},
+    {"scnsim", "\342\213\251"},
+    {"plusacir", "\342\250\243"},
+    {"iff", "\342\207\224"},
+    {"npre", "\342\252\257\314\270"},
+    {"tbrk", "\342\216\264"},
+    {"And", "\342\251\223"},
+    {"tcy", "\321\202"},
+    {"LeftArrowBar", "\342\207\244"},
+    {"Psi", "\316\250"},
+    {"Ycy", "\320\253"},
+    {"timesd", "\342\250\260"},
+    {"eplus", "\342\251\261"},
+    {"LeftTriangle", "\342\212\262"},
+    {"longleftrightarrow", "\342\237\267"},
+    {"gtrarr", "\342\245\270"},
+    {"DJcy", "\320\202"},
+    {"simdot", "\342\251\252"},
+    {"ncaron", "\305\210"},
+    {"Tilde", "\342\210\274"},
+    {"eqcirc", "\342\211\226"},
+    {"bigvee", "\342\213\201"},
+    {"DownArrowBar", "\342\244\223"},
+    {"nshortmid", "\342\210\244"},
+    {"sdote", "\342\251\246"},
+    {"Vcy", "\320\222"},
+    {"sol", "/"},
+    {"puncsp", "\342\200\210"},
+    {"Copf", "\342\204\202"},
+    {"Ugrave", "\303\231"},
+    {"Cayleys", "\342\204\255"},
+    {"RightArrowLeftArrow", "\342\207\204"},
+    {"TSHcy", "\320\213"},
+    {"Lstrok", "\305\201"},
+    {"Element", "\342\210\210"},
+    {"nhArr", "\342\207\216"},
+    {"Omicron", "\316\237"},
+    {"nleqslant", "\342\251\275\314\270"},
+    {"ee", "\342\205\207"},
+    {"nsupE", "\342\253\206\314\270"},
+    {"NotRightTriangleBar", "\342\247\220\314\270"},
+    {"pluscir", "\342\250\242"},
+    {"breve", "\313\230"},
+    {"subset", "\342\212\202"},
+    {"dtri", "\342\226\277"},
+    {"els", "\342\252\225"},
+    {"phiv", "\317\225"},
+    {"nbumpe", "\342\211\217\314\270"},
+    {"NotSucceedsTilde", "\342\211\277\314\270"},
+    {"llcorner", "\342\214\236"},
+    {"succneqq", "\342\252\266"},
+    {"thickapprox", "\342\211\210"},
+    {"sstarf", "\342\213\206"},
+    {"esdot", "\342\211\220"},
+    {"straightphi", "\317\225"},
+    {"setminus", "\342\210\226"},
+    {"geq", "\342\211\245"},
+    {"dzcy", "\321\237"},
+    {"mfr", "\360\235\224\252"},
+    {"boxul", "\342\224\230"},
+    {"rotimes", "\342\250\265"},
+    {"tcaron", "\305\245"},
+    {"NotSquareSupersetEqual", "\342\213\243"},
+    {"nspar", "\342\210\246"},
+    {"boxDL", "\342\225\227"},
+    {"yuml", "\303\277"},
+    {"harrw", "\342\206\255"},
+    {"rcub", "}"},
+    {"ApplyFunction", "\342\201\241"},
+    {"nbsp", "\302\240"},
+    {"ccedil", "\303\247"},
+    {"angrtvb", "\342\212\276"},
+    {"oslash", "\303\270"},
+    {"frac56", "\342\205\232"},
+    {"laemptyv", "\342\246\264"},
+    {"uwangle", "\342\246\247"},
+    {"udblac", "\305\261"},
+    {"vartriangleleft", "\342\212\262"},
+    {"blk12", "\342\226\222"},
+    {"lbrkslu", "\342\246\215"},
+    {"homtht", "\342\210\273"},
+    {"Gcedil", "\304\242"},
+    {"DiacriticalAcute", "\302\264"},
+    {"eth", "\303\260"},
+    {"aelig", "\303\246"},
+    {"Sopf", "\360\235\225\212"},
+    {"rharul", "\342\245\254"},
+    {"Rfr", "\342\204\234"},
+    {"sscr", "\360\235\223\210"},
+    {"supsub", "\342\253\224"},
+    {"maltese", "\342\234\240"},
+    {"bkarow", "\342\244\215"},
+    {"acd", "\342\210\277"},
+    {"supsetneq", "\342\212\213"},
+    {"RightTee", "\342\212\242"},
+    {"Ffr", "\360\235\224\211"},
+    {"phmmat", "\342\204\263"},
+    {"zfr", "\360\235\224\267"},
+    {"Dcaron", "\304\216"},
+    {"imath", "\304\261"},
+    {"num", "#"},
+    {"rarrpl", "\342\245\205"},
+    {"nwarr", "\342\206\226"},
+    {"Lleftarrow", "\342\207\232"},
+    {"Tab", "\011"},
+    {"ulcorn", "\342\214\234"},
+    {"NotExists", "\342\210\204"},
+    {"lesdoto", "\342\252\201"},
+    {"Vopf", "\360\235\225\215"},
+    {"xrarr", "\342\237\266"},
+    {"Yacute", "\303\235"},
+    {"szlig", "\303\237"},
+    {"oacute", "\303\263"},
+    {"ycy", "\321\213"},
+    {"eacute", "\303\251"},
+    {"para", "\302\266"},
+    {"prcue", "\342\211\274"},
+    {"nrightarrow", "\342\206\233"},
+    {"gE", "\342\211\247"},
+    {"iprod", "\342\250\274"},
+    {"boxVH", "\342\225\254"},
+    {"ntgl", "\342\211\271"},
+    {"otimesas", "\342\250\266"},
+    {"rbrksld", "\342\246\216"},
+    {"Ropf", "\342\204\235"},
+    {"bne", "=\342\203\245"},
+    {"Sc", "\342\252\274"},
+    {"thkap", "\342\211\210"},
+    {"nsimeq", "\342\211\204"},
+    {"Exists", "\342\210\203"},
+    {"fopf", "\360\235\225\227"},
+    {"Vfr", "\360\235\224\231"},
+    {"eDot", "\342\211\221"},
+    {"pr", "\342\211\272"},
+    {"filig", "\357\254\201"},
+    {"longrightarrow", "\342\237\266"},
+    {"lE", "\342\211\246"},
+    {"boxUR", "\342\225\232"},
+    {"kscr", "\360\235\223\200"},
+    {"Iogon", "\304\256"},
+    {"nGtv", "\342\211\253\314\270"},
+    {"nopf", "\360\235\225\237"},
+    {"Gammad", "\317\234"},
+    {"Mu", "\316\234"},
+    {"mid", "\342\210\243"},
+    {"Tcy", "\320\242"},
+    {"simplus", "\342\250\244"},
+    {"Agrave", "\303\200"},
+    {"notinvc", "\342\213\266"},
+    {"Leftrightarrow", "\342\207\224"},
+    {"atilde", "\303\243"},
+    {"ContourIntegral", "\342\210\256"},
+    {"circledR", "\302\256"},
+    {"Otilde", "\303\225"},
+    {"urtri", "\342\227\271"},
+    {"daleth", "\342\204\270"},
+    {"squf", "\342\226\252"},
+    {"Scedil", "\305\236"},
+    {"ngeqq", "\342\211\247\314\270"},
+    {"RightTriangle", "\342\212\263"},
+    {"in", "\342\210\210"},
+    {"orarr", "\342\206\273"},
+    {"NestedGreaterGreater", "\342\211\253"},
+    {"copysr", "\342\204\227"},
+    {"semi", ";"},
+    {"divonx", "\342\213\207"},
+    {"eogon", "\304\231"},
+    {"ReverseUpEquilibrium", "\342\245\257"},
+    {"Union", "\342\213\203"},
+    {"mapstoup", "\342\206\245"},
+    {"vartheta", "\317\221"},
+    {"lcaron", "\304\276"},
+    {"loarr", "\342\207\275"},
+    {"olarr", "\342\206\272"},
+    {"udarr", "\342\207\205"},
+    {"NotSquareSuperset", "\342\212\220\314\270"},
+    {"Dopf", "\360\235\224\273"},
+    {"Nopf", "\342\204\225"},
+    {"fpartint", "\342\250\215"},
+    {"nsqsube", "\342\213\242"},
+    {"cir", "\342\227\213"},
+    {"nvap", "\342\211\215\342\203\222"},
+    {"mstpos", "\342\210\276"},
+    {"gap", "\342\252\206"},
+    {"dzigrarr", "\342\237\277"},
+    {"harrcir", "\342\245\210"},
+    {"VerticalLine", "|"},
+    {"dcaron", "\304\217"},
+    {"NestedLessLess", "\342\211\252"},
+    {"rangle", "\342\237\251"},
+    {"rect", "\342\226\255"},
+    {"qprime", "\342\201\227"},
+    {"varsigma", "\317\202"},
+    {"xoplus", "\342\250\201"},
+    {"quaternions", "\342\204\215"},
+    {"cylcty", "\342\214\255"},
+    {"LeftDownVector", "\342\207\203"},
+    {"lsaquo", "\342\200\271"},
+    {"strns", "\302\257"},
+    {"xuplus", "\342\250\204"},
+    {"nvltrie", "\342\212\264\342\203\222"},
+    {"Zeta", "\316\226"},
+    {"rHar", "\342\245\244"},
+    {"asymp", "\342\211\210"},
+    {"FilledVerySmallSquare", "\342\226\252"},
+    {"Darr", "\342\206\241"},
+    {"larrfs", "\342\244\235"},
+    {"udhar", "\342\245\256"},
+    {"ncongdot", "\342\251\255\314\270"},
+    {"gtrless", "\342\211\267"},
+    {"bopf", "\360\235\225\223"},
+    {"boxHU", "\342\225\251"},
+    {"luruhar", "\342\245\246"},
+    {"nwArr", "\342\207\226"},
+    {"gtdot", "\342\213\227"},
+    {"Leftarrow", "\342\207\220"},
+    {"veebar", "\342\212\273"},
+    {"DoubleUpArrow", "\342\207\221"},
+    {"RightUpDownVector", "\342\245\217"},
+    {"and", "\342\210\247"},
+    {"Uuml", "\303\234"},
+    {"swarhk", "\342\244\246"},
+    {"boxDl", "\342\225\226"},
+    {"lbrksld", "\342\246\217"},
+    {"nsupe", "\342\212\211"},
+    {"Yfr", "\360\235\224\234"},
+    {"nsupset", "\342\212\203\342\203\222"},
+    {"bigcirc", "\342\227\257"},
+    {"rsh", "\342\206\261"},
+    {"nrarrw", "\342\206\235\314\270"},
+    {"dharr", "\342\207\202"},
+    {"incare", "\342\204\205"},
+    {"ForAll", "\342\210\200"},
+    {"sfr", "\360\235\224\260"},
+    {"barvee", "\342\212\275"},
+    {"Lcedil", "\304\273"},
+    {"DoubleLeftArrow", "\342\207\220"},
+    {"heartsuit", "\342\231\245"},
+    {"gtrdot", "\342\213\227"},
+    {"boxUL", "\342\225\235"},
+    {"Cap", "\342\213\222"},
+    {"zwnj", "\342\200\214"},
+    {"LeftUpVector", "\342\206\277"},
+    {"vrtri", "\342\212\263"},
+    {"aring", "\303\245"},
+    {"csup", "\342\253\220"},
+    {"rfloor", "\342\214\213"},
+    {"lobrk", "\342\237\246"},
+    {"nlt", "\342\211\256"},
+    {"phone", "\342\230\216"},
+    {"fjlig", "fj"},
+    {"IOcy", "\320\201"},
+    {"lotimes", "\342\250\264"},
+    {"rsqb", "]"},
+    {"Cup", "\342\213\223"},
+    {"Hacek", "\313\207"},
+    {"LowerLeftArrow", "\342\206\231"},
+    {"ordf", "\302\252"},
+    {"rdquor", "\342\200\235"},
+    {"hcirc", "\304\245"},
+    {"pfr", "\360\235\224\255"},
+    {"urcrop", "\342\214\216"},
+    {"prop", "\342\210\235"},
+    {"PrecedesSlantEqual", "\342\211\274"},
+    {"LeftTriangleEqual", "\342\212\264"},
+    {"YUcy", "\320\256"},
+    {"DownBreve", "\314\221"},
+    {"odsold", "\342\246\274"},
+    {"boxUr", "\342\225\231"},
+    {"lesges", "\342\252\223"},
+    {"nearrow", "\342\206\227"},
+    {"ThinSpace", "\342\200\211"},
+    {"Zopf", "\342\204\244"},
+    {"rmoust", "\342\216\261"},
+    {"Vbar", "\342\253\253"},
+    {"UpperLeftArrow", "\342\206\226"},
+    {"boxHu", "\342\225\247"},
+    {"lstrok", "\305\202"},
+    {"Mopf", "\360\235\225\204"},
+    {"bumpe", "\342\211\217"},
+    {"NotSquareSubset", "\342\212\217\314\270"},
+    {"NotLess", "\342\211\256"},
+    {"sext", "\342\234\266"},
+    {"gnE", "\342\211\251"},
+    {"demptyv", "\342\246\261"},
+    {"rightthreetimes", "\342\213\214"},
+    {"rfisht", "\342\245\275"},
+    {"rppolint", "\342\250\222"},
+    {"lsquor", "\342\200\232"},
+    {"vBarv", "\342\253\251"},
+    {"napprox", "\342\211\211"},
+    {"lmoustache", "\342\216\260"},
+    {"RightArrowBar", "\342\207\245"},
+    {"Aacute", "\303\201"},
+    {"Del", "\342\210\207"},
+    {"cirE", "\342\247\203"},
+    {"doteq", "\342\211\220"},
+    {"tscy", "\321\206"},
+    {"Rang", "\342\237\253"},
+    {"DoubleDownArrow", "\342\207\223"},
+    {"abreve", "\304\203"},
+    {"tdot", "\342\203\233"},
+    {"vartriangleright", "\342\212\263"},
+    {"DownArrowUpArrow", "\342\207\265"},
+    {"epsilon", "\316\265"},
+    {"NotPrecedesEqual", "\342\252\257\314\270"},
+    {"TildeTilde", "\342\211\210"},
+    {"iecy", "\320\265"},
+    {"llarr", "\342\207\207"},
+    {"Mfr", "\360\235\224\220"},
+    {"quatint", "\342\250\226"},
+    {"NotVerticalBar", "\342\210\244"},
+    {"cupor", "\342\251\205"},
+    {"ecolon", "\342\211\225"},
+    {"uharl", "\342\206\277"},
+    {"NotGreaterSlantEqual", "\342\251\276\314\270"},
+    {"barwedge", "\342\214\205"},
+    {"lopf", "\360\235\225\235"},
+    {"bsol", "\134"},
+    {"mlcp", "\342\253\233"},
+    {"smid", "\342\210\243"},
+    {"rlhar", "\342\207\214"},
+    {"rpar", ")"},
+    {"Sum", "\342\210\221"},
+    {"nle", "\342\211\260"},
+    {"ratail", "\342\244\232"},
+    {"Yscr", "\360\235\222\264"},
+    {"capbrcup", "\342\251\211"},
+    {"sqsupset", "\342\212\220"},
+    {"nparallel", "\342\210\246"},
+    {"realpart", "\342\204\234"},
+    {"looparrowright", "\342\206\254"},
+    {"nsupseteqq", "\342\253\206\314\270"},
+    {"Afr", "\360\235\224\204"},
+    {"Aring", "\303\205"},
+    {"varsupsetneq", "\342\212\213\357\270\200"},
+    {"Uscr", "\360\235\222\260"},
+    {"DifferentialD", "\342\205\206"},
+    {"jukcy", "\321\224"},
+    {"Eacute", "\303\211"},
+    {"precneqq", "\342\252\265"},
+    {"ucirc", "\303\273"},
+    {"wcirc", "\305\265"},
+    {"supseteqq", "\342\253\206"},
+    {"shcy", "\321\210"},
+    {"UpArrow", "\342\206\221"},
+    {"cirmid", "\342\253\257"},
+    {"timesbar", "\342\250\261"},
+    {"updownarrow", "\342\206\225"},
+    {"Fopf", "\360\235\224\275"},
+    {"Wopf", "\360\235\225\216"},
+    {"RightArrow", "\342\206\222"},
+    {"lhard", "\342\206\275"},
+    {"nprec", "\342\212\200"},
+    {"looparrowleft", "\342\206\253"},
+    {"curren", "\302\244"},
+    {"epsi", "\316\265"},
+    {"isindot", "\342\213\265"},
+    {"percnt", "%"},
+    {"prurel", "\342\212\260"},
+    {"rfr", "\360\235\224\257"},
+    {"delta", "\316\264"},
+    {"simne", "\342\211\206"},
+    {"ascr", "\360\235\222\266"},
+    {"SubsetEqual", "\342\212\206"},
+    {"rightharpoonup", "\342\207\200"},
+    {"supseteq", "\342\212\207"},
+    {"gscr", "\342\204\212"},
+    {"UpArrowDownArrow", "\342\207\205"},
+    {"urcorn", "\342\214\235"},
+    {"becaus", "\342\210\265"},
+    {"doteqdot", "\342\211\221"},
+    {"sqcap", "\342\212\223"},
+    {"roarr", "\342\207\276"},
+    {"lAtail", "\342\244\233"},
+    {"nvinfin", "\342\247\236"},
+    {"models", "\342\212\247"},
+    {"erDot", "\342\211\223"},
+    {"nsqsupe", "\342\213\243"},
+    {"Abreve", "\304\202"},
+    {"NegativeMediumSpace", "\342\200\213"},
+    {"nVdash", "\342\212\256"},
+    {"Rcaron", "\305\230"},
+    {"PrecedesTilde", "\342\211\276"},
+    {"nsupseteq", "\342\212\211"},
+    {"rbrkslu", "\342\246\220"},
+    {"nlArr", "\342\207\215"},
+    {"NotLeftTriangleEqual", "\342\213\254"},
+    {"ltrif", "\342\227\202"},
+    {"cross", "\342\234\227"},
+    {"kgreen", "\304\270"},
+    {"gtlPar", "\342\246\225"},
+    {"iocy", "\321\221"},
+    {"Qfr", "\360\235\224\224"},
+    {"emacr", "\304\223"},
+    {"NotRightTriangle", "\342\213\253"},
+    {"suphsub", "\342\253\227"},
+    {"scnE", "\342\252\266"},
+    {"LowerRightArrow", "\342\206\230"},
+    {"roplus", "\342\250\256"},
+    {"boxvR", "\342\225\236"},
+    {"xopf", "\360\235\225\251"},
+    {"emsp", "\342\200\203"},
+    {"duhar", "\342\245\257"},
+    {"vee", "\342\210\250"},
+    {"plus", "+"},
+    {"ngeqslant", "\342\251\276\314\270"},
+    {"RightDownVector", "\342\207\202"},
+    {"ecirc", "\303\252"},
+    {"nLtv", "\342\211\252\314\270"},
+    {"lozenge", "\342\227\212"},
+    {"Tstrok", "\305\246"},
+    {"Bcy", "\320\221"},
+    {"forall", "\342\210\200"},
+    {"UnionPlus", "\342\212\216"},
+    {"boxh", "\342\224\200"},
+    {"blacktriangle", "\342\226\264"},
+    {"reals", "\342\204\235"},
+    {"map", "\342\206\246"},
+    {"Otimes", "\342\250\267"},
+    {"vsupnE", "\342\253\214\357\270\200"},
+    {"rx", "\342\204\236"},
+    {"opar", "\342\246\267"},
+    {"Vee", "\342\213\201"},
+    {"dtrif", "\342\226\276"},
+    {"OpenCurlyDoubleQuote", "\342\200\234"},
+    {"dsol", "\342\247\266"},
+    {"frac12", "\302\275"},
+    {"subsub", "\342\253\225"},
+    {"nscr", "\360\235\223\203"},
+    {"nvge", "\342\211\245\342\203\222"},
+    {"Zacute", "\305\271"},
+    {"Efr", "\360\235\224\210"},
+    {"primes", "\342\204\231"},
+    {"ubrcy", "\321\236"},
+    {"piv", "\317\226"},
+    {"gnapprox", "\342\252\212"},
+    {"erarr", "\342\245\261"},
+    {"Barwed", "\342\214\206"},
+    {"darr", "\342\206\223"},
+    {"Cscr", "\360\235\222\236"},
+    {"Lmidot", "\304\277"},
+    {"pi", "\317\200"},
+    {"NotPrecedesSlantEqual", "\342\213\240"},
+    {"subdot", "\342\252\275"},
+    {"bprime", "\342\200\265"},
+    {"yfr", "\360\235\224\266"},
+    {"equest", "\342\211\237"},
+    {"shortmid", "\342\210\243"},
+    {"ogt", "\342\247\201"},
+    {"Colone", "\342\251\264"},
+    {"odblac", "\305\221"},
+    {"simgE", "\342\252\240"},
+    {"Congruent", "\342\211\241"},
+    {"parallel", "\342\210\245"},
+    {"Lang", "\342\237\252"},
+    {"eqslantless", "\342\252\225"},
+    {"vDash", "\342\212\250"},
+    {"nvdash", "\342\212\254"},
+    {"gtrsim", "\342\211\263"},
+    {"xotime", "\342\250\202"},
+    {"leftarrowtail", "\342\206\242"},
+    {"iiint", "\342\210\255"},
+    {"cwint", "\342\210\261"},
+    {"sqcaps", "\342\212\223\357\270\200"},
+    {"Prime", "\342\200\263"},
+    {"NotNestedLessLess", "\342\252\241\314\270"},
+    {"oror", "\342\251\226"},
+    {"downarrow", "\342\206\223"},
+    {"nmid", "\342\210\244"},
+    {"Re", "\342\204\234"},
+    {"varrho", "\317\261"},
+    {"prnap", "\342\252\271"},
+    {"subseteqq", "\342\253\205"},
+    {"NotSucceeds", "\342\212\201"},
+    {"boxplus", "\342\212\236"},
+    {"lopar", "\342\246\205"},
+    {"olcir", "\342\246\276"},
+    {"sqcups", "\342\212\224\357\270\200"},
+    {"iuml", "\303\257"},
+    {"prnsim", "\342\213\250"},
+    {"square", "\342\226\241"},
+    {"Dagger", "\342\200\241"},
+    {"triminus", "\342\250\272"},
+    {"rarrlp", "\342\206\254"},
+    {"uarr", "\342\206\221"},
+    {"larr", "\342\206\220"},
+    {"ulcorner", "\342\214\234"},
+    {"amalg", "\342\250\277"},
+    {"elsdot", "\342\252\227"},
+    {"rtrif", "\342\226\270"},
+    {"boxVh", "\342\225\253"},
+    {"LessLess", "\342\252\241"},
+    {"DiacriticalTilde", "\313\234"},
+    {"ZeroWidthSpace", "\342\200\213"},
+    {"Bopf", "\360\235\224\271"},
+    {"LeftTeeVector", "\342\245\232"},
+    {"lharul", "\342\245\252"},
+    {"CHcy", "\320\247"},
+    {"andv", "\342\251\232"},
+    {"Tfr", "\360\235\224\227"},
+    {"ocir", "\342\212\232"},
+    {"mscr", "\360\235\223\202"},
+    {"solbar", "\342\214\277"},
+    {"Kscr", "\360\235\222\246"},
+    {"NotEqual", "\342\211\240"},
+    {"checkmark", "\342\234\223"},
+    {"xscr", "\360\235\223\215"},
+    {"leftarrow", "\342\206\220"},
+    {"scsim", "\342\211\277"},
+    {"olt", "\342\247\200"},
+    {"notinva", "\342\210\211"},
+    {"Updownarrow", "\342\207\225"},
+    {"varkappa", "\317\260"},
+    {"Sigma", "\316\243"},
+    {"Nscr", "\360\235\222\251"},
+    {"boxvh", "\342\224\274"},
+    {"sqsupe", "\342\212\222"},
+    {"Eopf", "\360\235\224\274"},
+    {"ne", "\342\211\240"},
+    {"dopf", "\360\235\225\225"},
+    {"intcal", "\342\212\272"},
+    {"ctdot", "\342\213\257"},
+    {"lrhard", "\342\245\255"},
+    {"cfr", "\360\235\224\240"},
+    {"utdot", "\342\213\260"},
+    {"djcy", "\321\222"},
+    {"ufr", "\360\235\224\262"},
+    {"ldrdhar", "\342\245\247"},
+    {"nesear", "\342\244\250"},
+    {"rrarr", "\342\207\211"},
+    {"triangle", "\342\226\265"},
+    {"QUOT", "\042"},
+    {"lArr", "\342\207\220"},
+    {"notniva", "\342\210\214"},
+    {"frac58", "\342\205\235"},
+    {"sfrown", "\342\214\242"},
+    {"Icirc", "\303\216"},
+    {"RightDoubleBracket", "\342\237\247"},
+    {"plusdo", "\342\210\224"},
+    {"lesseqqgtr", "\342\252\213"},
+    {"boxVr", "\342\225\237"},
+    {"capcup", "\342\251\207"},
+    {"Longrightarrow", "\342\237\271"},
+    {"triangleright", "\342\226\271"},
+    {"kcy", "\320\272"},
+    {"zopf", "\360\235\225\253"},
+    {"hstrok", "\304\247"},
+    {"sqsup", "\342\212\220"},
+    {"nvsim", "\342\210\274\342\203\222"},
+    {"Sub", "\342\213\220"},
+    {"frasl", "\342\201\204"},
+    {"leqslant", "\342\251\275"},
+    {"Ouml", "\303\226"},
+    {"Iopf", "\360\235\225\200"},
+    {"shy", "\302\255"},
+    {"jmath", "\310\267"},
+    {"supmult", "\342\253\202"},
+    {"nsucc", "\342\212\201"},
+    {"tfr", "\360\235\224\261"},
+    {"boxUl", "\342\225\234"},
+    {"acirc", "\303\242"},
+    {"NotGreaterLess", "\342\211\271"},
+    {"imped", "\306\265"},
+    {"Rcy", "\320\240"},
+    {"simlE", "\342\252\237"},
+    {"spadesuit", "\342\231\240"},
+    {"Qscr", "\360\235\222\254"},
+    {"lcub", "{"},
+    {"thetav", "\317\221"},
+    {"fltns", "\342\226\261"},
+    {"lpar", "("},
+    {"NegativeThickSpace", "\342\200\213"},
+    {"frac38", "\342\205\234"},
+    {"awconint", "\342\210\263"},
+    {"Pfr", "\360\235\224\223"},
+    {"VerticalSeparator", "\342\235\230"},
+    {"LeftDoubleBracket", "\342\237\246"},
+    {"Pi", "\316\240"},
+    {"top", "\342\212\244"},
+    {"Scy", "\320\241"},
+    {"ncong", "\342\211\207"},
+    {"cupbrcap", "\342\251\210"},
+    {"easter", "\342\251\256"},
+    {"bigstar", "\342\230\205"},
+    {"cong", "\342\211\205"},
+    {"lltri", "\342\227\272"},
+    {"ldsh", "\342\206\262"},
+    {"bowtie", "\342\213\210"},
+    {"Laplacetrf", "\342\204\222"},
+    {"nparsl", "\342\253\275\342\203\245"},
+    {"Imacr", "\304\252"},
+    {"rmoustache", "\342\216\261"},
+    {"acute", "\302\264"},
+    {"Sfr", "\360\235\224\226"},
+    {"frac15", "\342\205\225"},
+    {"Amacr", "\304\200"},
+    {"because", "\342\210\265"},
+    {"lthree", "\342\213\213"},
+    {"LeftUpDownVector", "\342\245\221"},
+    {"bigcap", "\342\213\202"},
+    {"times", "\303\227"},
+    {"notinvb", "\342\213\267"},
+    {"profsurf", "\342\214\223"},
+    {"LeftArrowRightArrow", "\342\207\206"},
+    {"Atilde", "\303\203"},
+    {"Ograve", "\303\222"},
+    {"swarrow", "\342\206\231"},
+    {"TScy", "\320\246"},
+    {"ubreve", "\305\255"},
+    {"xvee", "\342\213\201"},
+    {"Qopf", "\342\204\232"},
+    {"yscr", "\360\235\223\216"},
+    {"edot", "\304\227"},
+    {"lbrke", "\342\246\213"},
+    {"searr", "\342\206\230"},
+    {"awint", "\342\250\221"},
+    {"afr", "\360\235\224\236"},
+    {"circlearrowright", "\342\206\273"},
+    {"nleftrightarrow", "\342\206\256"},
+    {"cwconint", "\342\210\262"},
+    {"circledS", "\342\223\210"},
+    {"GreaterLess", "\342\211\267"},
+    {"NotRightTriangleEqual", "\342\213\255"},
+    {"npr", "\342\212\200"},
+    {"vsupne", "\342\212\213\357\270\200"},
+    {"thicksim", "\342\210\274"},
+    {"rarrbfs", "\342\244\240"},
+    {"Ocy", "\320\236"},
+    {"ncap", "\342\251\203"},
+    {"sigmaf", "\317\202"},
+    {"angst", "\303\205"},
+    {"malt", "\342\234\240"},
+    {"cirscir", "\342\247\202"},
+    {"sdot", "\342\213\205"},
+    {"sub", "\342\212\202"},
+    {"boxdL", "\342\225\225"},
+    {"jscr", "\360\235\222\277"},
+    {"yacute", "\303\275"},
+    {"bump", "\342\211\216"},
+    {"Vdash", "\342\212\251"},
+    {"copy", "\302\251"},
+    {"NotLessSlantEqual", "\342\251\275\314\270"},
+    {"sqsube", "\342\212\221"},
+    {"eqsim", "\342\211\202"},
+    {"UpTeeArrow", "\342\206\245"},
+    {"ntilde", "\303\261"},
+    {"Ascr", "\360\235\222\234"},
+    {"ast", "*"},
+    {"isinv", "\342\210\210"},
+    {"subplus", "\342\252\277"},
+    {"Kopf", "\360\235\225\202"},
+    {"xcap", "\342\213\202"},
+    {"intercal", "\342\212\272"},
+    {"twoheadleftarrow", "\342\206\236"},
+    {"NoBreak", "\342\201\240"},
+    {"tshcy", "\321\233"},
+    {"Escr", "\342\204\260"},
+    {"aopf", "\360\235\225\222"},
+    {"ngE", "\342\211\247\314\270"},
+    {"eqvparsl", "\342\247\245"},
+    {"frac34", "\302\276"},
+    {"boxminus", "\342\212\237"},
+    {"utrif", "\342\226\264"},
+    {"RightFloor", "\342\214\213"},
+    {"gesles", "\342\252\224"},
+    {"sccue", "\342\211\275"},
+    {"CloseCurlyQuote", "\342\200\231"},
+    {"angmsdaf", "\342\246\255"},
+    {"ruluhar", "\342\245\250"},
+    {"nsub", "\342\212\204"},
+    {"loang", "\342\237\254"},
+    {"tritime", "\342\250\273"},
+    {"subsetneq", "\342\212\212"},
+    {"mDDot", "\342\210\272"},
+    {"Not", "\342\253\254"},
+    {"trpezium", "\342\217\242"},
+    {"angmsdac", "\342\246\252"},
+    {"ENG", "\305\212"},
+    {"sc", "\342\211\273"},
+    {"csube", "\342\253\221"},
+    {"bigcup", "\342\213\203"},
+    {"cuesc", "\342\213\237"},
+    {"sqcup", "\342\212\224"},
+    {"supsup", "\342\253\226"},
+    {"ReverseElement", "\342\210\213"},
+    {"Gg", "\342\213\231"},
+    {"Ycirc", "\305\266"},
+    {"equivDD", "\342\251\270"},
+    {"ifr", "\360\235\224\246"},
+    {"Sacute", "\305\232"},
+    {"langd", "\342\246\221"},
+    {"NotLessEqual", "\342\211\260"},
+    {"exist", "\342\210\203"},
+    {"middot", "\302\267"},
+    {"Kappa", "\316\232"},
+    {"rightarrowtail", "\342\206\243"},
+    {"glE", "\342\252\222"},
+    {"RuleDelayed", "\342\247\264"},
+    {"xsqcup", "\342\250\206"},
+    {"VeryThinSpace", "\342\200\212"},
+    {"Yuml", "\305\270"},
+    {"leftleftarrows", "\342\207\207"},
+    {"Lopf", "\360\235\225\203"},
+    {"ugrave", "\303\271"},
+    {"ultri", "\342\227\270"},
+    {"lg", "\342\211\266"},
+    {"SupersetEqual", "\342\212\207"},
+    {"lrhar", "\342\207\213"},
+    {"prsim", "\342\211\276"},
+    {"nearhk", "\342\244\244"},
+    {"Scirc", "\305\234"},
+    {"ccupssm", "\342\251\220"},
+    {"nsim", "\342\211\201"},
+    {"dtdot", "\342\213\261"},
+    {"nvrtrie", "\342\212\265\342\203\222"},
+    {"sqsupseteq", "\342\212\222"},
+    {"ljcy", "\321\231"},
+    {"midcir", "\342\253\260"},
+    {"rtriltri", "\342\247\216"},
+    {"khcy", "\321\205"},
+    {"iacute", "\303\255"},
+    {"ntlg", "\342\211\270"},
+    {"KHcy", "\320\245"},
+    {"curlywedge", "\342\213\217"},
+    {"rationals", "\342\204\232"},
+    {"biguplus", "\342\250\204"},
+    {"ssetmn", "\342\210\226"},
+    {"plusmn", "\302\261"},
+    {"drcorn", "\342\214\237"},
+    {"boxVl", "\342\225\242"},
+    {"varpropto", "\342\210\235"},
+    {"supsim", "\342\253\210"},
+    {"naturals", "\342\204\225"},
+    {"topf", "\360\235\225\245"},
+    {"leq", "\342\211\244"},
+    {"isinE", "\342\213\271"},
+    {"minusdu", "\342\250\252"},
+    {"rdldhar", "\342\245\251"},
+    {"Tcaron", "\305\244"},
+    {"vert", "|"},
+    {"hearts", "\342\231\245"},
+    {"bsime", "\342\213\215"},
+    {"TildeFullEqual", "\342\211\205"},
+    {"thksim", "\342\210\274"},
+    {"vsubnE", "\342\253\213\357\270\200"},
+    {"Zcaron", "\305\275"},
+    {"tcedil", "\305\243"},
+    {"LeftVectorBar", "\342\245\222"},
+    {"Omacr", "\305\214"},
+    {"supE", "\342\253\206"},
+    {"ndash", "\342\200\223"},
+    {"period", "."},
+    {"ucy", "\321\203"},
+    {"risingdotseq", "\342\211\223"},
+    {"Aogon", "\304\204"},
+    {"frac25", "\342\205\226"},
+    {"rcaron", "\305\231"},
+    {"dot", "\313\231"},
+    {"clubsuit", "\342\231\243"},
+    {"varr", "\342\206\225"},
+    {"nsubseteqq", "\342\253\205\314\270"},
+    {"ClockwiseContourIntegral", "\342\210\262"},
+    {"Upsilon", "\316\245"},
+    {"lfr", "\360\235\224\251"},
+    {"dharl", "\342\207\203"},
+    {"NotReverseElement", "\342\210\214"},
+    {"TildeEqual", "\342\211\203"},
+    {"leftthreetimes", "\342\213\213"},
+    {"nldr", "\342\200\245"},
+    {"oint", "\342\210\256"},
+    {"DownRightVector", "\342\207\201"},
+    {"Poincareplane", "\342\204\214"},
+    {"lne", "\342\252\207"},
+    {"ordm", "\302\272"},
+    {"boxhU", "\342\225\250"},
+    {"Hat", "^"},
+    {"rarrw", "\342\206\235"},
+    {"succ", "\342\211\273"},
+    {"not", "\302\254"},
+    {"itilde", "\304\251"},
+    {"tint", "\342\210\255"},
+    {"succeq", "\342\252\260"},
+    {"searhk", "\342\244\245"},
+    {"div", "\303\267"},
+    {"ltimes", "\342\213\211"},
+    {"prE", "\342\252\263"},
+    {"SquareSubset", "\342\212\217"},
+    {"nbump", "\342\211\216\314\270"},
+    {"boxVL", "\342\225\243"},
+    {"gdot", "\304\241"},
+    {"Jscr", "\360\235\222\245"},
+    {"boxuR", "\342\225\230"},
+    {"vzigzag", "\342\246\232"},
+    {"nhpar", "\342\253\262"},
+    {"supnE", "\342\253\214"},
+    {"permil", "\342\200\260"},
+    {"NotSubset", "\342\212\202\342\203\222"},
+    {"orv", "\342\251\233"},
+    {"boxbox", "\342\247\211"},
+    {"apos", "'"},
+    {"andd", "\342\251\234"},
+    {"twoheadrightarrow", "\342\206\240"},
+    {"Equal", "\342\251\265"},
+    {"Hscr", "\342\204\213"},
+    {"nwarrow", "\342\206\226"},
+    {"succsim", "\342\211\277"},
+    {"Esim", "\342\251\263"},
+    {"napos", "\305\211"},
+    {"eopf", "\360\235\225\226"},
+    {"ggg", "\342\213\231"},
+    {"gacute", "\307\265"},
+    {"gescc", "\342\252\251"},
+    {"rarrap", "\342\245\265"},
+    {"Wfr", "\360\235\224\232"},
+    {"sbquo", "\342\200\232"},
+    {"Dot", "\302\250"},
+    {"LessFullEqual", "\342\211\246"},
+    {"ngeq", "\342\211\261"},
+    {"aleph", "\342\204\265"},
+    {"LeftRightArrow", "\342\206\224"},
+    {"napid", "\342\211\213\314\270"},
+    {"lap", "\342\252\205"},
+    {"rdsh", "\342\206\263"},
+    {"bscr", "\360\235\222\267"},
+    {"rdca", "\342\244\267"},
+    {"cudarrl", "\342\244\270"},
+    {"gvnE", "\342\211\251\357\270\200"},
+    {"RoundImplies", "\342\245\260"},
+    {"vprop", "\342\210\235"},
+    {"ZHcy", "\320\226"},
+    {"duarr", "\342\207\265"},
+    {"lnE", "\342\211\250"},
+    {"nsubset", "\342\212\202\342\203\222"},
+    {"angsph", "\342\210\242"},
+    {"rArr", "\342\207\222"},
+    {"diamondsuit", "\342\231\246"},
+    {"swArr", "\342\207\231"},
+    {"sqsubset", "\342\212\217"},
+    {"njcy", "\321\232"},
+    {"uharr", "\342\206\276"},
+    {"bsemi", "\342\201\217"},
+    {"pcy", "\320\277"},
+    {"nsc", "\342\212\201"},
+    {"Utilde", "\305\250"},
+    {"Map", "\342\244\205"},
+    {"Edot", "\304\226"},
+    {"reg", "\302\256"},
+    {"Iscr", "\342\204\220"},
+    {"lharu", "\342\206\274"},
+    {"pre", "\342\252\257"},
+    {"Dstrok", "\304\220"},
+    {"Pr", "\342\252\273"},
+    {"ape", "\342\211\212"},
+    {"xcirc", "\342\227\257"},
+    {"downdownarrows", "\342\207\212"},
+    {"gtreqless", "\342\213\233"},
+    {"emsp14", "\342\200\205"},
+    {"natur", "\342\231\256"},
+    {"Fscr", "\342\204\261"},
+    {"Uparrow", "\342\207\221"},
+    {"gcirc", "\304\235"},
+    {"angmsdab", "\342\246\251"},
+    {"ulcrop", "\342\214\217"},
+    {"gopf", "\360\235\225\230"},
+    {"inodot", "\304\261"},
+    {"gesdoto", "\342\252\202"},
+    {"hyphen", "\342\200\220"},
+    {"lnsim", "\342\213\246"},
+    {"larrpl", "\342\244\271"},
+    {"THORN", "\303\236"},
+    {"LeftCeiling", "\342\214\210"},
+    {"amp", "&"},
+    {"NotHumpDownHump", "\342\211\216\314\270"},
+    {"perp", "\342\212\245"},
+    {"gvertneqq", "\342\211\251\357\270\200"},
+    {"cularrp", "\342\244\275"},
+    {"Kcy", "\320\232"},
+    {"xcup", "\342\213\203"},
+    {"siml", "\342\252\235"},
+    {"backcong", "\342\211\214"},
+    {"succcurlyeq", "\342\211\275"},
+    {"SHCHcy", "\320\251"},
+    {"gEl", "\342\252\214"},
+    {"NotGreaterEqual", "\342\211\261"},
+    {"lozf", "\342\247\253"},
+    {"Jfr", "\360\235\224\215"},
+    {"lnapprox", "\342\252\211"},
+    {"EmptySmallSquare", "\342\227\273"},
+    {"vsubne", "\342\212\212\357\270\200"},
+    {"approxeq", "\342\211\212"},
+    {"Eta", "\316\227"},
+    {"vfr", "\360\235\224\263"},
+    {"bemptyv", "\342\246\260"},
+    {"LessTilde", "\342\211\262"},
+    {"nequiv", "\342\211\242"},
+    {"Equilibrium", "\342\207\214"},
+    {"Uarrocir", "\342\245\211"},
+    {"lowast", "\342\210\227"},
+    {"yicy", "\321\227"},
+    {"colone", "\342\211\224"},
+    {"cups", "\342\210\252\357\270\200"},
+    {"subE", "\342\253\205"},
+    {"beth", "\342\204\266"},
+    {"starf", "\342\230\205"},
+    {"twixt", "\342\211\254"},
+    {"Rsh", "\342\206\261"},
+    {"subrarr", "\342\245\271"},
+    {"boxDR", "\342\225\224"},
+    {"lsqb", "["},
+    {"image", "\342\204\221"},
+    {"subnE", "\342\253\213"},
+    {"verbar", "|"},
+    {"egs", "\342\252\226"},
+    {"sube", "\342\212\206"},
+    {"frac16", "\342\205\231"},
+    {"varnothing", "\342\210\205"},
+    {"upuparrows", "\342\207\210"},
+    {"late", "\342\252\255"},
+    {"ii", "\342\205\210"},
+    {"backsim", "\342\210\275"},
+    {"lurdshar", "\342\245\212"},
+    {"LongRightArrow", "\342\237\266"},
+    {"SmallCircle", "\342\210\230"},
+    {"nedot", "\342\211\220\314\270"},
+    {"Rrightarrow", "\342\207\233"},
+    {"operp", "\342\246\271"},
+    {"elinters", "\342\217\247"},
+    {"bsolb", "\342\247\205"},
+    {"agrave", "\303\240"},
+    {"Ccaron", "\304\214"},
+    {"eparsl", "\342\247\243"},
+    {"oast", "\342\212\233"},
+    {"nltri", "\342\213\252"},
+    {"capdot", "\342\251\200"},
+    {"star", "\342\230\206"},
+    {"epsiv", "\317\265"},
+    {"wp", "\342\204\230"},
+    {"Pcy", "\320\237"},
+    {"GreaterTilde", "\342\211\263"},
+    {"exponentiale", "\342\205\207"},
+    {"kfr", "\360\235\224\250"},
+    {"AElig", "\303\206"},
+    {"angmsd", "\342\210\241"},
+    {"or", "\342\210\250"},
+    {"lfisht", "\342\245\274"},
+    {"subsetneqq", "\342\253\213"},
+    {"nprcue", "\342\213\240"},
+    {"Tscr", "\360\235\222\257"},
+    {"Succeeds", "\342\211\273"},
+    {"dollar", "$"},
+    {"lessdot", "\342\213\226"},
+    {"tscr", "\360\235\223\211"},
+    {"Mellintrf", "\342\204\263"},
+    {"ReverseEquilibrium", "\342\207\213"},
+    {"blacktriangleright", "\342\226\270"},
+    {"vscr", "\360\235\223\213"},
+    {"Uarr", "\342\206\237"},
+    {"squarf", "\342\226\252"},
+    {"Dscr", "\360\235\222\237"},
+    {"ccirc", "\304\211"},
+    {"Xfr", "\360\235\224\233"},
+    {"suphsol", "\342\237\211"},
+    {"ohbar", "\342\246\265"},
+    {"nrtri", "\342\213\253"},
+    {"iopf", "\360\235\225\232"},
+    {"Ucirc", "\303\233"},
+    {"Longleftarrow", "\342\237\270"},
+    {"rtimes", "\342\213\212"},
+    {"RBarr", "\342\244\220"},
+    {"notinE", "\342\213\271\314\270"},
+    {"LessSlantEqual", "\342\251\275"},
+    {"nLt", "\342\211\252\342\203\222"},
+    {"sqsubseteq", "\342\212\221"},
+    {"LeftArrow", "\342\206\220"},
+    {"lambda", "\316\273"},
+    {"PlusMinus", "\302\261"},
+    {"Proportional", "\342\210\235"},
+    {"sdotb", "\342\212\241"},
+    {"ltrPar", "\342\246\226"},
+    {"eqcolon", "\342\211\225"},
+    {"NotLessLess", "\342\211\252\314\270"},
+    {"curarrm", "\342\244\274"},
+    {"rsaquo", "\342\200\272"},
+    {"curarr", "\342\206\267"},
+    {"angzarr", "\342\215\274"},
+    {"NotSupersetEqual", "\342\212\211"},
+    {"nfr", "\360\235\224\253"},
+    {"cent", "\302\242"},
+    {"RightAngleBracket", "\342\237\251"},
+    {"gne", "\342\252\210"},
+    {"OverParenthesis", "\342\217\234"},
+    {"Lambda", "\316\233"},
+    {"NotLessGreater", "\342\211\270"},
+    {"lbarr", "\342\244\214"},
+    {"gg", "\342\211\253"},
+    {"nsmid", "\342\210\244"},
+    {"radic", "\342\210\232"},
+    {"ijlig", "\304\263"},
+    {"ltdot", "\342\213\226"},
+    {"lneqq", "\342\211\250"},
+    {"odot", "\342\212\231"},
+    {"Ll", "\342\213\230"},
+    {"smtes", "\342\252\254\357\270\200"},
+    {"Ecirc", "\303\212"},
+    {"CirclePlus", "\342\212\225"},
+    {"NotSquareSubsetEqual", "\342\213\242"},
+    {"lmoust", "\342\216\260"},
+    {"NotTilde", "\342\211\201"},
+    {"Assign", "\342\211\224"},
+    {"egrave", "\303\250"},
+    {"rbrke", "\342\246\214"},
+    {"sup3", "\302\263"},
+    {"uhblk", "\342\226\200"},
+    {"isin", "\342\210\210"},
+    {"DotDot", "\342\203\234"},
+    {"Ccedil", "\303\207"},
+    {"VerticalTilde", "\342\211\200"},
+    {"uplus", "\342\212\216"},
+    {"hellip", "\342\200\246"},
+    {"ocy", "\320\276"},
+    {"gel", "\342\213\233"},
+    {"NotEqualTilde", "\342\211\202\314\270"},
+    {"CounterClockwiseContourIntegral", "\342\210\263"},
+    {"tau", "\317\204"},
+    {"ogon", "\313\233"},
+    {"Product", "\342\210\217"},
+    {"scirc", "\305\235"},
+    {"uring", "\305\257"},
+    {"SOFTcy", "\320\254"},
+    {"dwangle", "\342\246\246"},
+    {"tridot", "\342\227\254"},
+    {"ecaron", "\304\233"},
+    {"Lcy", "\320\233"},
+    {"VDash", "\342\212\253"},
+    {"dcy", "\320\264"},
+    {"eng", "\305\213"},
+    {"UnderBracket", "\342\216\265"},
+    {"nvle", "\342\211\244\342\203\222"},
+    {"trisb", "\342\247\215"},
+    {"lsimg", "\342\252\217"},
+    {"Precedes", "\342\211\272"},
+    {"LeftTriangleBar", "\342\247\217"},
+    {"Barv", "\342\253\247"},
+    {"IJlig", "\304\262"},
+    {"DoubleVerticalBar", "\342\210\245"},
+    {"Conint", "\342\210\257"},
+    {"Cfr", "\342\204\255"},
+    {"imagpart", "\342\204\221"},
+    {"Zfr", "\342\204\250"},
+    {"range", "\342\246\245"},
+    {"empty", "\342\210\205"},
+    {"mnplus", "\342\210\223"},
+    {"icirc", "\303\256"},
+    {"lesdot", "\342\251\277"},
+    {"UpArrowBar", "\342\244\222"},
+    {"rpargt", "\342\246\224"},
+    {"ord", "\342\251\235"},
+    {"zacute", "\305\272"},
+    {"there4", "\342\210\264"},
+    {"bbrk", "\342\216\265"},
+    {"order", "\342\204\264"},
+    {"forkv", "\342\253\231"},
+    {"simeq", "\342\211\203"},
+    {"rcy", "\321\200"},
+    {"hslash", "\342\204\217"},
+    {"ominus", "\342\212\226"},
+    {"hoarr", "\342\207\277"},
+    {"gsiml", "\342\252\220"},
+    {"compfn", "\342\210\230"},
+    {"Int", "\342\210\254"},
+    {"TRADE", "\342\204\242"},
+    {"nrarr", "\342\206\233"},
+    {"GT", ">"},
+    {"gesdotol", "\342\252\204"},
+    {"bigoplus", "\342\250\201"},
+    {"Oslash", "\303\230"},
+    {"isins", "\342\213\264"},
+    {"ldquor", "\342\200\236"},
+    {"UnderBrace", "\342\217\237"},
+    {"lescc", "\342\252\250"},
+    {"nsucceq", "\342\252\260\314\270"},
+    {"gnap", "\342\252\212"},
+    {"andand", "\342\251\225"},
+    {"swarr", "\342\206\231"},
+    {"straightepsilon", "\317\265"},
+    {"telrec", "\342\214\225"},
+    {"csupe", "\342\253\222"},
+    {"lsquo", "\342\200\230"},
+    {"rcedil", "\305\227"},
+    {"uacute", "\303\272"},
+    {"Hcirc", "\304\244"},
+    {"between", "\342\211\254"},
+    {"lrm", "\342\200\216"},
+    {"LeftTeeArrow", "\342\206\244"},
+    {"lessapprox", "\342\252\205"},
+    {"esim", "\342\211\202"},
+    {"pluse", "\342\251\262"},
+    {"Cconint", "\342\210\260"},
+    {"pscr", "\360\235\223\205"},
+    {"Jcy", "\320\231"},
+    {"curvearrowright", "\342\206\267"},
+    {"gt", ">"},
+    {"asympeq", "\342\211\215"},
+    {"otilde", "\303\265"},
+    {"spar", "\342\210\245"},
+    {"olcross", "\342\246\273"},
+    {"backprime", "\342\200\265"},
+    {"Wcirc", "\305\264"},
+    {"divide", "\303\267"},
+    {"ltlarr", "\342\245\266"},
+    {"RightUpVector", "\342\206\276"},
+    {"bernou", "\342\204\254"},
+    {"rharu", "\342\207\200"},
+    {"measuredangle", "\342\210\241"},
+    {"kcedil", "\304\267"},
+    {"ffllig", "\357\254\204"},
+    {"ofcir", "\342\246\277"},
+    {"lrtri", "\342\212\277"},
+    {"ohm", "\316\251"},
+    {"angle", "\342\210\240"},
+    {"oplus", "\342\212\225"},
+    {"ouml", "\303\266"},
+    {"yucy", "\321\216"},
+    {"circlearrowleft", "\342\206\272"},
+    {"rnmid", "\342\253\256"},
+    {"nearr", "\342\206\227"},
+    {"apid", "\342\211\213"},
+    {"Zscr", "\360\235\222\265"},
+    {"napE", "\342\251\260\314\270"},
+    {"ShortLeftArrow", "\342\206\220"},
+    {"centerdot", "\302\267"},
+    {"lrcorner", "\342\214\237"},
+    {"euro", "\342\202\254"},
+    {"nges", "\342\251\276\314\270"},
+    {"nvlt", "<\342\203\222"},
+    {"xrArr", "\342\237\271"},
+    {"Mscr", "\342\204\263"},
+    {"rang", "\342\237\251"},
+    {"Larr", "\342\206\236"},
+    {"notin", "\342\210\211"},
+    {"diam", "\342\213\204"},
+    {"leftharpoondown", "\342\206\275"},
+    {"seswar", "\342\244\251"},
+    {"ncy", "\320\275"},
+    {"cap", "\342\210\251"},
+    {"pitchfork", "\342\213\224"},
+    {"male", "\342\231\202"},
+    {"Iacute", "\303\215"},
+    {"loz", "\342\227\212"},
+    {"UnderParenthesis", "\342\217\235"},
+    {"Fcy", "\320\244"},
+    {"NotSucceedsSlantEqual", "\342\213\241"},
+    {"eta", "\316\267"},
+    {"ffilig", "\357\254\203"},
+    {"ecy", "\321\215"},
+    {"plankv", "\342\204\217"},
+    {"lvertneqq", "\342\211\250\357\270\200"},
+    {"capcap", "\342\251\213"},
+    {"ensp", "\342\200\202"},
+    {"topcir", "\342\253\261"},
+    {"UpTee", "\342\212\245"},
+    {"kopf", "\360\235\225\234"},
+    {"Gamma", "\316\223"},
+    {"rBarr", "\342\244\217"},
+    {"nu", "\316\275"},
+    {"ltcir", "\342\251\271"},
+    {"real", "\342\204\234"},
+    {"xwedge", "\342\213\200"},
+    {"gesdot", "\342\252\200"},
+    {"NotGreaterGreater", "\342\211\253\314\270"},
+    {"sup", "\342\212\203"},
+    {"Sscr", "\360\235\222\256"},
+    {"gtquest", "\342\251\274"},
+    {"vcy", "\320\262"},
+    {"ang", "\342\210\240"},
+    {"uml", "\302\250"},
+    {"lrarr", "\342\207\206"},
+    {"NotGreater", "\342\211\257"},
+    {"REG", "\302\256"},
+    {"angmsdag", "\342\246\256"},
+    {"divideontimes", "\342\213\207"},
+    {"Colon", "\342\210\267"},
+    {"backepsilon", "\317\266"},
+    {"lcedil", "\304\274"},
+    {"varphi", "\317\225"},
+    {"supset", "\342\212\203"},
+    {"theta", "\316\270"},
+    {"LeftTee", "\342\212\243"},
+    {"rarrb", "\342\207\245"},
+    {"emptyset", "\342\210\205"},
+    {"smashp", "\342\250\263"},
+    {"yen", "\302\245"},
+    {"nltrie", "\342\213\254"},
+    {"origof", "\342\212\266"},
+    {"cirfnint", "\342\250\220"},
+    {"dfr", "\360\235\224\241"},
+    {"DiacriticalGrave", "`"},
+    {"rarrsim", "\342\245\264"},
+    {"crarr", "\342\206\265"},
+    {"Bscr", "\342\204\254"},
+    {"alefsym", "\342\204\265"},
+    {"Rscr", "\342\204\233"},
+    {"NotCongruent", "\342\211\242"},
+    {"LJcy", "\320\211"},
+    {"OpenCurlyQuote", "\342\200\230"},
+    {"boxur", "\342\224\224"},
+    {"gtcir", "\342\251\272"},
+    {"Wscr", "\360\235\222\262"},
+    {"solb", "\342\247\204"},
+    {"Egrave", "\303\210"},
+    {"Ecy", "\320\255"},
+    {"eg", "\342\252\232"},
+    {"DoubleLongLeftArrow", "\342\237\270"},
+    {"loplus", "\342\250\255"},
+    {"ETH", "\303\220"},
+    {"phi", "\317\206"},
+    {"llhard", "\342\245\253"},
+    {"varsupsetneqq", "\342\253\214\357\270\200"},
+    {"copf", "\360\235\225\224"},
+    {"NotSucceedsEqual", "\342\252\260\314\270"},
+    {"dstrok", "\304\221"},
+    {"CircleMinus", "\342\212\226"},
+    {"iogon", "\304\257"},
+    {"Lscr", "\342\204\222"},
+    {"precapprox", "\342\252\267"},
+    {"bbrktbrk", "\342\216\266"},
+    {"ocirc", "\303\264"},
+    {"Dcy", "\320\224"},
+    {"epar", "\342\213\225"},
+    {"raquo", "\302\273"},
+    {"cupcup", "\342\251\212"},
+    {"nvHarr", "\342\244\204"},
+    {"planck", "\342\204\217"},
+    {"xodot", "\342\250\200"},
+    {"lbrace", "{"},
+    {"propto", "\342\210\235"},
+    {"cedil", "\302\270"},
+    {"lagran", "\342\204\222"},
+    {"xlArr", "\342\237\270"},
+    {"SucceedsEqual", "\342\252\260"},
+    {"cire", "\342\211\227"},
+    {"uuarr", "\342\207\210"},
+    {"rhov", "\317\261"},
+    {"Jukcy", "\320\204"},
+    {"SquareIntersection", "\342\212\223"},
+    {"Ucy", "\320\243"},
+    {"shchcy", "\321\211"},
+    {"fcy", "\321\204"},
+    {"leftrightarrows", "\342\207\206"},
+    {"Jsercy", "\320\210"},
+    {"Or", "\342\251\224"},
+    {"ccups", "\342\251\214"},
+    {"Intersection", "\342\213\202"},
+    {"mdash", "\342\200\224"},
+    {"Odblac", "\305\220"},
+    {"downharpoonright", "\342\207\202"},
+    {"flat", "\342\231\255"},
+    {"Oscr", "\360\235\222\252"},
+    {"cemptyv", "\342\246\262"},
+    {"precnsim", "\342\213\250"},
+    {"auml", "\303\244"},
+    {"ltrie", "\342\212\264"},
+    {"Uopf", "\360\235\225\214"},
+    {"cacute", "\304\207"},
+    {"leftrightsquigarrow", "\342\206\255"},
+    {"dotplus", "\342\210\224"},
+    {"Theta", "\316\230"},
+    {"gsime", "\342\252\216"},
+    {"zhcy", "\320\266"},
+    {"Hopf", "\342\204\215"},
+    {"imagline", "\342\204\220"},
+    {"caret", "\342\201\201"},
+    {"upsih", "\317\222"},
+    {"suplarr", "\342\245\273"},
+    {"lmidot", "\305\200"},
+    {"plussim", "\342\250\246"},
+    {"boxvL", "\342\225\241"},
+    {"geqslant", "\342\251\276"},
+    {"Gdot", "\304\240"},
+    {"Nu", "\316\235"},
+    {"angrt", "\342\210\237"},
+    {"Oopf", "\360\235\225\206"},
+    {"Tau", "\316\244"},
+    {"cudarrr", "\342\244\265"},
+    {"boxHD", "\342\225\246"},
+    {"prime", "\342\200\262"},
+    {"DoubleLeftRightArrow", "\342\207\224"},
+    {"hopf", "\360\235\225\231"},
+    {"doublebarwedge", "\342\214\206"},
+    {"nisd", "\342\213\272"},
+    {"DD", "\342\205\205"},
+    {"larrlp", "\342\206\253"},
+    {"Coproduct", "\342\210\220"},
+    {"ddarr", "\342\207\212"},
+    {"lHar", "\342\245\242"},
+    {"sung", "\342\231\252"},
+    {"bnot", "\342\214\220"},
+    {"lgE", "\342\252\221"},
+    {"DZcy", "\320\217"},
+    {"ShortUpArrow", "\342\206\221"},
+    {"bsolhsub", "\342\237\210"},
+    {"emptyv", "\342\210\205"},
+    {"midast", "*"},
+    {"boxHd", "\342\225\244"},
+    {"fork", "\342\213\224"},
+    {"prap", "\342\252\267"},
+    {"Gfr", "\360\235\224\212"},
+    {"beta", "\316\262"},
+    {"gcy", "\320\263"},
+    {"diamond", "\342\213\204"},
+    {"sigma", "\317\203"},
+    {"bottom", "\342\212\245"},
+    {"xdtri", "\342\226\275"},
+    {"supsetneqq", "\342\253\214"},
+    {"subne", "\342\212\212"},
+    {"subedot", "\342\253\203"},
+    {"deg", "\302\260"},
+    {"nless", "\342\211\256"},
+    {"ofr", "\360\235\224\254"},
+    {"triangleleft", "\342\227\203"},
+    {"VerticalBar", "\342\210\243"},
+    {"icy", "\320\270"},
+    {"nis", "\342\213\274"},
+    {"NotHumpEqual", "\342\211\217\314\270"},
+    {"wr", "\342\211\200"},
+    {"larrbfs", "\342\244\237"},
+    {"npart", "\342\210\202\314\270"},
+    {"gla", "\342\252\245"},
+    {"NonBreakingSpace", "\302\240"},
+    {"cuwed", "\342\213\217"},
+    {"orslope", "\342\251\227"},
+    {"CenterDot", "\302\267"},
+    {"boxhu", "\342\224\264"},
+    {"Lt", "\342\211\252"},
+    {"Xopf", "\360\235\225\217"},
+    {"Itilde", "\304\250"},
+    {"clubs", "\342\231\243"},
+    {"RightTriangleEqual", "\342\212\265"},
+    {"smallsetminus", "\342\210\226"},
+    {"topfork", "\342\253\232"},
+    {"lBarr", "\342\244\216"},
+    {"lessgtr", "\342\211\266"},
+    {"RightVector", "\342\207\200"},
+    {"Ntilde", "\303\221"},
+    {"Sup", "\342\213\221"},
+    {"gtcc", "\342\252\247"},
+    {"boxVR", "\342\225\240"},
+    {"NotSubsetEqual", "\342\212\210"},
+    {"DoubleLeftTee", "\342\253\244"},
+    {"wopf", "\360\235\225\250"},
+    {"vdash", "\342\212\242"},
+    {"ecir", "\342\211\226"},
+    {"utri", "\342\226\265"},
+    {"shortparallel", "\342\210\245"},
+    {"mopf", "\360\235\225\236"},
+    {"eDDot", "\342\251\267"},
+    {"supdot", "\342\252\276"},
+    {"dbkarow", "\342\244\217"},
+    {"nsime", "\342\211\204"},
+    {"oS", "\342\223\210"},
+    {"uArr", "\342\207\221"},
+    {"numsp", "\342\200\207"},
+    {"bepsi", "\317\266"},
+    {"bNot", "\342\253\255"},
+    {"amacr", "\304\201"},
+    {"vArr", "\342\207\225"},
+    {"Hfr", "\342\204\214"},
+    {"Because", "\342\210\265"},
+    {"xi", "\316\276"},
+    {"npreceq", "\342\252\257\314\270"},
+    {"rceil", "\342\214\211"},
+    {"vangrt", "\342\246\234"},
+    {"jcirc", "\304\265"},
+    {"sect", "\302\247"},
+    {"bcy", "\320\261"},
+    {"DownLeftVector", "\342\206\275"},
+    {"vnsub", "\342\212\202\342\203\222"},
+    {"rarrhk", "\342\206\252"},
+    {"upsilon", "\317\205"},
+    {"succapprox", "\342\252\270"},
+    {"realine", "\342\204\233"},
+    {"cularr", "\342\206\266"},
+    {"leftrightharpoons", "\342\207\213"},
+    {"Therefore", "\342\210\264"},
+    {"ddagger", "\342\200\241"},
+    {"vellip", "\342\213\256"},
+    {"LeftRightVector", "\342\245\216"},
+    {"Sqrt", "\342\210\232"},
+    {"iiiint", "\342\250\214"},
+    {"dArr", "\342\207\223"},
+    {"les", "\342\251\275"},
+    {"Lfr", "\360\235\224\217"},
+    {"dlcorn", "\342\214\236"},
+    {"Star", "\342\213\206"},
+    {"Acirc", "\303\202"},
+    {"DownTeeArrow", "\342\206\247"},
+    {"circledast", "\342\212\233"},
+    {"gtrapprox", "\342\252\206"},
+    {"veeeq", "\342\211\232"},
+    {"varpi", "\317\226"},
+    {"nVDash", "\342\212\257"},
+    {"profalar", "\342\214\256"},
+    {"topbot", "\342\214\266"},
+    {"bot", "\342\212\245"},
+    {"lesg", "\342\213\232\357\270\200"},
+    {"lbrack", "["},
+    {"Uacute", "\303\232"},
+  }};
+
+} // namespace dotnamebot::rss::entities
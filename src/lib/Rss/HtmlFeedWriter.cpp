@@ -1,5 +1,8 @@
 #include "HtmlFeedWriter.hpp"
 
+#include <Rss/FeedDate.hpp>
+#include <Utils/String/TextKernels.hpp>
+
 #include <algorithm>
 #include <chrono>
 #include <ctime>
@@ -68,38 +71,24 @@ namespace dotnamebot::rss {
     return out.empty() ? "feed" : out;
   }
 
-  // Tries RFC 822 ("Mon, 07 May 2026 10:00:00 +0000") then ISO 8601 ("2026-05-07T10:00:00Z").
-  // Returns 0 when unparseable — those items sort to the end.
-  static time_t parsePubDate(const std::string &s) {
-    if (s.empty()) {
-      return 0;
-    }
-    std::tm tm{};
-    if (strptime(s.c_str(), "%a, %d %b %Y %H:%M:%S", &tm) != nullptr) {
-      return mktime(&tm);
-    }
-    if (strptime(s.c_str(), "%Y-%m-%dT%H:%M:%S", &tm) != nullptr) {
-      return mktime(&tm);
-    }
-    if (strptime(s.c_str(), "%Y-%m-%d", &tm) != nullptr) {
-      return mktime(&tm);
-    }
-    return 0;
-  }
-
-  std::string HtmlFeedWriter::escapeHtml(const std::string &str) {
+  std::string HtmlFeedWriter::escapeHtml(std::string_view str) {
+    static constexpr utils::ByteSet SPECIAL{"&<>\"'"};
     std::string out;
     out.reserve(str.size());
-    for (unsigned char c : str) {
-      switch (c) {
+    size_t pos = 0;
+    for (size_t next = utils::findFirstOf(str, SPECIAL); next != std::string::npos;
+         next = utils::findFirstOf(str, SPECIAL, pos)) {
+      out.append(str, pos, next - pos);
+      switch (str[next]) {
       case '&': out += "&amp;"; break;
       case '<': out += "&lt;"; break;
       case '>': out += "&gt;"; break;
       case '"': out += "&quot;"; break;
-      case '\'': out += "&#39;"; break;
-      default: out += static_cast<char>(c); break;
+      default: out += "&#39;"; break;
       }
+      pos = next + 1;
     }
+    out.append(str, pos);
     return out;
   }
 
@@ -117,7 +106,7 @@ namespace dotnamebot::rss {
     std::vector<std::string> labelOrder;
     std::map<std::string, std::vector<const RSSItem *>> groups;
     for (const auto &item : items) {
-      const std::string &lbl = item.feedLabel.empty() ? "feed" : item.feedLabel;
+      const std::string lbl(item.feedLabel.empty() ? "feed" : item.feedLabel);
       if (groups.find(lbl) == groups.end()) {
         labelOrder.push_back(lbl);
       }
@@ -127,8 +116,8 @@ namespace dotnamebot::rss {
     // Sort each section newest-first; unparseable dates go to the end
     for (auto &[lbl, sect] : groups) {
       std::stable_sort(sect.begin(), sect.end(), [](const RSSItem *a, const RSSItem *b) {
-        time_t ta = parsePubDate(a->pubDate);
-        time_t tb = parsePubDate(b->pubDate);
+        time_t ta = parseFeedDate(a->pubDate);
+        time_t tb = parseFeedDate(b->pubDate);
         if (ta == 0 && tb == 0) {
           return false;
         }
@@ -1,6 +1,8 @@
 #pragma once
 #include <Rss/RSSItem.hpp>
 #include <filesystem>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace dotnamebot::rss {
@@ -8,9 +10,9 @@ namespace dotnamebot::rss {
   class HtmlFeedWriter {
   public:
     static bool write(const std::vector<RSSItem> &items, const std::filesystem::path &outputPath);
+    static std::string escapeHtml(std::string_view str);
 
   private:
-    static std::string escapeHtml(const std::string &str);
     static std::string buildHtml(const std::vector<RSSItem> &items);
     static std::string labelToInitials(const std::string &label);
     static std::string labelToColor(const std::string &label);
@@ -0,0 +1,173 @@
+#include "HtmlText.hpp"
+
+#include <Utils/String/TextKernels.hpp>
+
+#include <algorithm>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    constexpr std::string_view IMG_TAG = "<img";
+    constexpr std::string_view SRC_ATTRIBUTE = "src=";
+    constexpr std::string_view CDATA_OPEN = "<![CDATA[";
+    constexpr std::string_view CDATA_CLOSE = "]]>";
+    constexpr std::string_view TRIM_CHARS = " \t\n\r";
+    constexpr utils::ByteSet QUOTES{"\"'"};
+    constexpr utils::ByteSet LINE_BREAKS{"\r\n"};
+    // Whitespace that never survives collapseWhitespace, unlike a single ' '
+    constexpr utils::ByteSet NON_SPACE_WHITESPACE{"\t\n\v\f\r"};
+
+    bool isSpace(char c) {
+      return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+    }
+
+    bool isQuote(char c) { return c == '"' || c == '\''; }
+
+    // Appends html to out with every complete tag removed
+    void appendWithoutTags(std::string_view html, std::string &out) {
+      size_t pos = 0;
+      while (pos < html.size()) {
+        const size_t open = html.find('<', pos);
+        if (open == std::string_view::npos) {
+          out.append(html.substr(pos));
+          return;
+        }
+        out.append(html.substr(pos, open - pos));
+        const size_t close = html.find('>', open + 1);
+        if (close == std::string_view::npos) {
+          // No '>' left anywhere, so neither this '<' nor any later one starts a tag
+          out.append(html.substr(open));
+          return;
+        }
+        pos = close + 1;
+      }
+    }
+
+  } // namespace
+
+  std::string stripHtmlTags(std::string_view html) {
+    std::string out;
+    out.reserve(html.size());
+    appendWithoutTags(html, out);
+    return out;
+  }
+
+  std::string_view findImageSrc(std::string_view html) {
+    for (size_t start = html.find(IMG_TAG); start != std::string_view::npos;
+         start = html.find(IMG_TAG, start + 1)) {
+      // src= must follow at least one character inside the tag, i.e. before its first '>'
+      const size_t tagEnd = html.find('>', start + IMG_TAG.size());
+      if (tagEnd == std::string_view::npos) {
+        // Nothing can close a tag any more, for this <img or any later one
+        return {};
+      }
+      const size_t first = start + IMG_TAG.size() + 1;
+      if (tagEnd < first + SRC_ATTRIBUTE.size()) {
+        continue;
+      }
+
+      // [^>]+ is greedy, so the regex settles on the last src= that works
+      for (size_t at = html.rfind(SRC_ATTRIBUTE, tagEnd - SRC_ATTRIBUTE.size());
+           at != std::string_view::npos && at >= first;
+           at = at == 0 ? std::string_view::npos : html.rfind(SRC_ATTRIBUTE, at - 1)) {
+        const size_t quote = at + SRC_ATTRIBUTE.size();
+        if (quote >= html.size() || !isQuote(html[quote])) {
+          continue;
+        }
+        // The value may hold any character but a quote, '>' included
+        const size_t valueEnd = utils::findFirstOf(html, QUOTES, quote + 1);
+        if (valueEnd == std::string_view::npos || valueEnd == quote + 1 ||
+            html.find('>', valueEnd + 1) == std::string_view::npos) {
+          continue;
+        }
+        return html.substr(quote + 1, valueEnd - quote - 1);
+      }
+    }
+    return {};
+  }
+
+  HtmlText extractHtmlText(std::string_view html, bool findImage) {
+    HtmlText result;
+    if (findImage) {
+      result.imageSrc = std::string(findImageSrc(html));
+    }
+
+    // Skip leading blanks before copying, then drop trailing ones from the copy
+    const size_t begin = html.find_first_not_of(TRIM_CHARS);
+    if (begin == std::string_view::npos) {
+      return result;
+    }
+    result.text.reserve(html.size() - begin);
+    appendWithoutTags(html.substr(begin), result.text);
+
+    // Removing a tag can expose blanks that were inside the text
+    const size_t first = result.text.find_first_not_of(TRIM_CHARS);
+    if (first == std::string::npos) {
+      result.text.clear();
+      return result;
+    }
+    result.text.erase(result.text.find_last_not_of(TRIM_CHARS) + 1);
+    result.text.erase(0, first);
+    return result;
+  }
+
+  bool findCdataSection(std::string_view text, std::string_view &content) {
+    for (size_t start = text.find(CDATA_OPEN); start != std::string_view::npos;
+         start = text.find(CDATA_OPEN, start + 1)) {
+      const size_t body = start + CDATA_OPEN.size();
+      const size_t end = text.find(CDATA_CLOSE, body);
+      if (end == std::string_view::npos) {
+        return false;
+      }
+      // '.' does not match line breaks, so the section must end before the first one
+      const size_t lineBreak = utils::findFirstOf(text, LINE_BREAKS, body);
+      if (lineBreak == std::string_view::npos || lineBreak >= end) {
+        content = text.substr(body, end - body);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void collapseWhitespace(std::string &text) {
+    text.resize(collapseWhitespace(std::span<char>(text)).size());
+  }
+
+  std::string_view collapseWhitespace(std::span<char> buffer) {
+    // Most text is already collapsed: find the first byte that needs rewriting with the
+    // vector scans and leave everything before it in place
+    const std::string_view view(buffer.data(), buffer.size());
+    if (view.empty()) {
+      return view;
+    }
+    size_t start = std::min(utils::findFirstOf(view, NON_SPACE_WHITESPACE), view.find("  "));
+    if (view.front() == ' ') {
+      start = 0;
+    } else if (start == std::string_view::npos) {
+      return view.back() == ' ' ? view.substr(0, view.size() - 1) : view;
+    } else if (start > 0 && view[start - 1] == ' ') {
+      // The run starts with a single space ("a \tb")
+      --start;
+    }
+
+    // Words between runs are short, so the rest is cheaper byte by byte than with scans
+    size_t out = start;
+    bool pendingSpace = false;
+    for (size_t pos = start; pos < buffer.size(); ++pos) {
+      const char c = buffer[pos];
+      if (isSpace(c)) {
+        // Leading blanks never produce a space, trailing ones are never flushed
+        pendingSpace = out > 0;
+        continue;
+      }
+      if (pendingSpace) {
+        buffer[out++] = ' ';
+        pendingSpace = false;
+      }
+      buffer[out++] = c;
+    }
+    return view.substr(0, out);
+  }
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Plain text and first image of an HTML fragment (item description or content).
+   *
+   */
+  struct HtmlText {
+    // Tags removed, leading and trailing " \t\n\r" trimmed, inner whitespace untouched
+    std::string text;
+    // src of the first <img> tag, empty when there is none
+    std::string imageSrc;
+  };
+
+  /**
+   * @brief Remove every tag, i.e. each '<' up to the next '>'; a '<' without a closing
+   * '>' is kept as text. Same result as replacing the regex <[^>]*> with nothing.
+   *
+   * @param html HTML fragment
+   * @return std::string The fragment without tags
+   */
+  std::string stripHtmlTags(std::string_view html);
+
+  /**
+   * @brief Find the src of the first <img> tag, like the regex
+   * <img[^>]+src=["']([^"']+)["'][^>]*> (first tag that matches, last src= within it)
+   *
+   * @param html HTML fragment
+   * @return std::string_view The src value, empty when no tag matches
+   */
+  std::string_view findImageSrc(std::string_view html);
+
+  /**
+   * @brief Strip tags, trim and capture the first image in one scan over the fragment
+   *
+   * @param html HTML fragment with entities already decoded
+   * @param findImage Whether to look for an <img> src
+   * @return HtmlText
+   */
+  HtmlText extractHtmlText(std::string_view html, bool findImage);
+
+  /**
+   * @brief Content of the first CDATA section that does not span a line break, like the
+   * regex <!\[CDATA\[(.*?)\]\]>
+   *
+   * @param text Text that may contain a literal CDATA section
+   * @param content Receives the section content
+   * @return true if a section was found, otherwise false
+   */
+  bool findCdataSection(std::string_view text, std::string_view &content);
+
+  /**
+   * @brief Replace every whitespace run with one space and trim both ends, in place
+   *
+   * @param text Text to normalize; whitespace is " \t\n\v\f\r"
+   */
+  void collapseWhitespace(std::string &text);
+
+  /**
+   * @brief collapseWhitespace() over a writable buffer, e.g. text kept in an ItemArena
+   *
+   * @param buffer Text to normalize in place
+   * @return std::string_view The normalized text, a prefix of the buffer
+   */
+  std::string_view collapseWhitespace(std::span<char> buffer);
+
+} // namespace dotnamebot::rss
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <string>
 
@@ -36,6 +37,20 @@ namespace dotnamebot::rss {
      */
     [[nodiscard]] virtual int refetchRssFeeds() = 0;
 
+    /**
+     * @brief Refetch only the feeds whose adaptive polling interval has elapsed
+     *
+     * @return int Returns the number of new items fetched
+     */
+    [[nodiscard]] virtual int refetchDueRssFeeds() = 0;
+
+    /**
+     * @brief Time until the next feed becomes due for polling
+     *
+     * @return std::chrono::seconds Zero when a feed is already due
+     */
+    [[nodiscard]] virtual std::chrono::seconds timeUntilNextFetch() const = 0;
+
     /**
      * @brief List all stored RSS URLs
      *
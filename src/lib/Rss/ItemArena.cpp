@@ -0,0 +1,31 @@
+#include "ItemArena.hpp"
+
+#include <cstring>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    // First block; later ones grow geometrically, so a big feed needs only a few
+    constexpr size_t INITIAL_BLOCK_BYTES = 16 * 1024;
+
+  } // namespace
+
+  ItemArena::ItemArena() : resource_(INITIAL_BLOCK_BYTES) {}
+
+  std::string_view ItemArena::store(std::string_view text) {
+    if (text.empty()) {
+      return {};
+    }
+    auto *data = static_cast<char *>(resource_.allocate(text.size(), 1));
+    std::memcpy(data, text.data(), text.size());
+    bytesStored_ += text.size();
+    return {data, text.size()};
+  }
+
+  std::span<char> ItemArena::edit(std::string_view stored) {
+    // The bytes were allocated writable by store(); only the view made them const
+    return {const_cast<char *>(stored.data()), stored.size()};
+  }
+
+} // namespace dotnamebot::rss
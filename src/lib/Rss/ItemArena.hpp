@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Owns the text of the items read from one feed document.
+   *
+   * Text is appended to a few large blocks that are only released together, when the
+   * arena is destroyed, instead of one heap allocation per field. RSSItem fields are views
+   * into an arena and every item holds a reference to it, so an arena lives exactly as long
+   * as one of its items, or the RSSFeed it was parsed into, is still around.
+   *
+   * Not thread-safe: one arena is filled by the single parse that created it.
+   */
+  class ItemArena {
+  public:
+    ItemArena();
+
+    ItemArena(const ItemArena &) = delete;
+    ItemArena &operator=(const ItemArena &) = delete;
+
+    /**
+     * @brief Copy text into the arena
+     *
+     * @param text Text to keep
+     * @return std::string_view The copy, valid as long as the arena
+     */
+    std::string_view store(std::string_view text);
+
+    /**
+     * @brief Writable access to text returned by store(), for in-place edits that do not
+     * grow it (e.g. whitespace collapsing)
+     *
+     * @param stored A view returned by store() of this arena
+     * @return std::span<char> The same bytes
+     */
+    static std::span<char> edit(std::string_view stored);
+
+    // Text bytes stored so far
+    [[nodiscard]] size_t bytesStored() const { return bytesStored_; }
+
+  private:
+    std::pmr::monotonic_buffer_resource resource_;
+    size_t bytesStored_{0};
+  };
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,112 @@
+#include "ItemFingerprint.hpp"
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+    constexpr size_t STRIPE = 32;
+
+    // Little-endian loads, so big-endian hosts agree with the stored fingerprints
+    template <typename T> T readLittleEndian(const char *ptr) {
+      T value;
+      std::memcpy(&value, ptr, sizeof(T));
+      if constexpr (std::endian::native == std::endian::big) {
+        T swapped = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+          swapped = (swapped << 8) | ((value >> (8 * i)) & 0xFF);
+        }
+        value = swapped;
+      }
+      return value;
+    }
+
+    uint64_t round(uint64_t acc, uint64_t input) {
+      acc += input * PRIME2;
+      acc = std::rotl(acc, 31);
+      return acc * PRIME1;
+    }
+
+    uint64_t mergeRound(uint64_t acc, uint64_t value) {
+      acc ^= round(0, value);
+      return (acc * PRIME1) + PRIME4;
+    }
+
+  } // namespace
+
+  uint64_t xxh64(std::string_view data, uint64_t seed) {
+    const char *ptr = data.data();
+    const char *const end = ptr + data.size();
+    uint64_t hash;
+
+    if (data.size() >= STRIPE) {
+      uint64_t v1 = seed + PRIME1 + PRIME2;
+      uint64_t v2 = seed + PRIME2;
+      uint64_t v3 = seed;
+      uint64_t v4 = seed - PRIME1;
+      const char *const limit = end - STRIPE;
+      do {
+        v1 = round(v1, readLittleEndian<uint64_t>(ptr));
+        v2 = round(v2, readLittleEndian<uint64_t>(ptr + 8));
+        v3 = round(v3, readLittleEndian<uint64_t>(ptr + 16));
+        v4 = round(v4, readLittleEndian<uint64_t>(ptr + 24));
+        ptr += STRIPE;
+      } while (ptr <= limit);
+      hash = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+      hash = mergeRound(hash, v1);
+      hash = mergeRound(hash, v2);
+      hash = mergeRound(hash, v3);
+      hash = mergeRound(hash, v4);
+    } else {
+      hash = seed + PRIME5;
+    }
+    hash += data.size();
+
+    for (; end - ptr >= 8; ptr += 8) {
+      hash ^= round(0, readLittleEndian<uint64_t>(ptr));
+      hash = (std::rotl(hash, 27) * PRIME1) + PRIME4;
+    }
+    if (end - ptr >= 4) {
+      hash ^= static_cast<uint64_t>(readLittleEndian<uint32_t>(ptr)) * PRIME1;
+      hash = (std::rotl(hash, 23) * PRIME2) + PRIME3;
+      ptr += 4;
+    }
+    for (; ptr < end; ++ptr) {
+      hash ^= static_cast<uint64_t>(static_cast<unsigned char>(*ptr)) * PRIME5;
+      hash = std::rotl(hash, 11) * PRIME1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= PRIME2;
+    hash ^= hash >> 29;
+    hash *= PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+  }
+
+  std::string fingerprintToHex(uint64_t fingerprint) {
+    std::array<char, 17> buffer{};
+    std::snprintf(buffer.data(), buffer.size(), "%016llx",
+                  static_cast<unsigned long long>(fingerprint));
+    return buffer.data();
+  }
+
+  bool fingerprintFromHex(std::string_view text, uint64_t &fingerprint) {
+    if (text.empty() || text.size() > 16) {
+      return false;
+    }
+    const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), fingerprint, 16);
+    return ec == std::errc() && ptr == text.data() + text.size();
+  }
+
+} // namespace dotnamebot::rss
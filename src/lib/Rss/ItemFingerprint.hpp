@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief XXH64 of data (https://xxhash.com), the same value on every compiler and platform
+   *
+   * @param data Bytes to hash
+   * @param seed Seed
+   * @return uint64_t Hash
+   */
+  uint64_t xxh64(std::string_view data, uint64_t seed);
+
+  /**
+   * @brief Stable 64-bit identity of a feed item, built field by field.
+   *
+   * Each field is hashed with the running value as its seed, so nothing is concatenated
+   * and the field boundaries count ("ab" + "c" differs from "a" + "bc"). Fingerprints are
+   * persisted in seenHashes.json: the seed and the field order must never change, or every
+   * item would be posted again.
+   */
+  class ItemFingerprint {
+  public:
+    ItemFingerprint &add(std::string_view field) {
+      value_ = xxh64(field, value_);
+      return *this;
+    }
+
+    [[nodiscard]] uint64_t value() const { return value_; }
+
+  private:
+    static constexpr uint64_t SEED = 0x646f746e616d6562ULL; // "dotnameb"
+
+    uint64_t value_{SEED};
+  };
+
+  /**
+   * @brief Fingerprint as stored in seenHashes.json
+   *
+   * @param fingerprint Fingerprint
+   * @return std::string 16 lower-case hex digits
+   */
+  std::string fingerprintToHex(uint64_t fingerprint);
+
+  /**
+   * @brief Parse a fingerprint written by fingerprintToHex
+   *
+   * @param text Hex digits
+   * @param fingerprint Receives the value
+   * @return true if text is 1 to 16 hex digits and nothing else
+   */
+  bool fingerprintFromHex(std::string_view text, uint64_t &fingerprint);
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,314 @@
+#include "JsonFeedReader.hpp"
+
+#include <Rss/HtmlEntities.hpp>
+#include <Rss/HtmlText.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <utility>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    constexpr std::string_view VERSION_PREFIX = "https://jsonfeed.org/version/";
+
+    // Nesting of the containers the reader cares about; anything deeper is skipped
+    constexpr size_t FEED_DEPTH = 1;
+    constexpr size_t ITEMS_DEPTH = 2;
+    constexpr size_t ITEM_DEPTH = 3;
+    constexpr size_t ATTACHMENTS_DEPTH = 4;
+    constexpr size_t ATTACHMENT_DEPTH = 5;
+
+    enum class FeedKey : std::uint8_t { Other, Version, Title, Description, HomePageUrl, Items };
+
+    enum class ItemKey : std::uint8_t {
+      Other,
+      Title,
+      Url,
+      ExternalUrl,
+      Summary,
+      ContentText,
+      ContentHtml,
+      Image,
+      BannerImage,
+      DatePublished,
+      DateModified,
+      Attachments
+    };
+
+    FeedKey feedKey(std::string_view key) {
+      if (key == "version") {
+        return FeedKey::Version;
+      }
+      if (key == "title") {
+        return FeedKey::Title;
+      }
+      if (key == "description") {
+        return FeedKey::Description;
+      }
+      if (key == "home_page_url") {
+        return FeedKey::HomePageUrl;
+      }
+      if (key == "items") {
+        return FeedKey::Items;
+      }
+      return FeedKey::Other;
+    }
+
+    ItemKey itemKey(std::string_view key) {
+      static constexpr std::pair<std::string_view, ItemKey> keys[] = {
+          {"title", ItemKey::Title},
+          {"url", ItemKey::Url},
+          {"external_url", ItemKey::ExternalUrl},
+          {"summary", ItemKey::Summary},
+          {"content_text", ItemKey::ContentText},
+          {"content_html", ItemKey::ContentHtml},
+          {"image", ItemKey::Image},
+          {"banner_image", ItemKey::BannerImage},
+          {"date_published", ItemKey::DatePublished},
+          {"date_modified", ItemKey::DateModified},
+          {"attachments", ItemKey::Attachments},
+      };
+      for (const auto &[name, value] : keys) {
+        if (key == name) {
+          return value;
+        }
+      }
+      return ItemKey::Other;
+    }
+
+    // Raw values of one item; the text that is kept as it is goes straight to the arena
+    struct JsonItemFields {
+      std::string_view title;
+      std::string_view url;
+      std::string_view externalUrl;
+      std::string_view image;
+      std::string_view bannerImage;
+      std::string_view datePublished;
+      std::string_view dateModified;
+      std::string summary;
+      std::string contentText;
+      std::string contentHtml;
+      bool hasAttachment{false};
+      std::string_view attachmentUrl;
+      std::string_view attachmentType;
+    };
+
+    void setImage(RSSItem &item, std::string_view url) {
+      item.rssMedia.url = item.arena->store(url);
+      item.rssMedia.type = "image/";
+    }
+
+    void buildJsonItem(JsonItemFields &fields, RSSItem &item) {
+      item.title = fields.title;
+      item.url = fields.url.empty() ? fields.externalUrl : fields.url;
+      if (!fields.summary.empty()) {
+        item.description = item.arena->store(fields.summary);
+      } else if (!fields.contentText.empty()) {
+        item.description = item.arena->store(fields.contentText);
+      } else if (!fields.contentHtml.empty()) {
+        // Same treatment as an Atom <content>: decode, strip tags, pick the first image
+        HtmlText html = extractHtmlText(decodeHtmlEntities(fields.contentHtml), true);
+        if (!html.imageSrc.empty()) {
+          setImage(item, html.imageSrc);
+        }
+        item.description = item.arena->store(html.text);
+      }
+
+      // Later sources override earlier ones: description image, the first attachment,
+      // then the item's image / banner_image
+      if (fields.hasAttachment) {
+        item.rssMedia.url = fields.attachmentUrl;
+        item.rssMedia.type = fields.attachmentType;
+      }
+      if (!fields.image.empty()) {
+        item.rssMedia.url = fields.image;
+        item.rssMedia.type = "image/";
+      } else if (!fields.bannerImage.empty()) {
+        item.rssMedia.url = fields.bannerImage;
+        item.rssMedia.type = "image/";
+      }
+
+      item.pubDate = fields.datePublished.empty() ? fields.dateModified : fields.datePublished;
+    }
+
+    // nlohmann SAX consumer. Final, so sax_parse's calls through the base are devirtualized.
+    class JsonFeedSax final : public nlohmann::json_sax<nlohmann::json> {
+    public:
+      JsonFeedSax(RSSFeed &feed, const FeedItemHandler &onItem)
+          : feed_(feed), onItem_(onItem), arena_(feed.arena) {}
+
+      bool null() override { return scalar(); }
+      bool boolean(bool /*val*/) override { return scalar(); }
+      bool number_integer(number_integer_t /*val*/) override { return scalar(); }
+      bool number_unsigned(number_unsigned_t /*val*/) override { return scalar(); }
+      bool number_float(number_float_t /*val*/, const string_t & /*s*/) override {
+        return scalar();
+      }
+      bool binary(binary_t & /*val*/) override { return scalar(); }
+
+      bool string(string_t &val) override {
+        if (depth_ == FEED_DEPTH) {
+          switch (feedKey_) {
+          case FeedKey::Version: isJsonFeed_ = val.starts_with(VERSION_PREFIX); break;
+          case FeedKey::Title: feed_.headTitle = std::move(val); break;
+          case FeedKey::Description: feed_.headDescription = std::move(val); break;
+          case FeedKey::HomePageUrl: feed_.headLink = std::move(val); break;
+          default: break;
+          }
+        } else if (depth_ == ITEM_DEPTH && inItems_) {
+          readItemString(val);
+        } else if (depth_ == ATTACHMENT_DEPTH && inAttachments_ && firstAttachment_) {
+          if (attachmentKey_ == "url") {
+            item_.attachmentUrl = arena_->store(val);
+          } else if (attachmentKey_ == "mime_type") {
+            item_.attachmentType = arena_->store(val);
+          }
+        }
+        return true;
+      }
+
+      bool start_object(std::size_t /*elements*/) override {
+        depth_++;
+        if (depth_ == FEED_DEPTH) {
+          isObject_ = true;
+        } else if (depth_ == ITEM_DEPTH && inItems_) {
+          item_ = JsonItemFields{};
+        } else if (depth_ == ATTACHMENT_DEPTH && inAttachments_) {
+          firstAttachment_ = !item_.hasAttachment;
+          item_.hasAttachment = true;
+        }
+        return true;
+      }
+
+      bool key(string_t &val) override {
+        if (depth_ == FEED_DEPTH) {
+          feedKey_ = feedKey(val);
+        } else if (depth_ == ITEM_DEPTH && inItems_) {
+          itemKey_ = itemKey(val);
+        } else if (depth_ == ATTACHMENT_DEPTH && inAttachments_) {
+          attachmentKey_ = std::move(val);
+        }
+        return true;
+      }
+
+      bool end_object() override {
+        const bool itemEnded = depth_ == ITEM_DEPTH && inItems_;
+        depth_--;
+        if (itemEnded) {
+          return emitItem();
+        }
+        return true;
+      }
+
+      bool start_array(std::size_t /*elements*/) override {
+        depth_++;
+        if (depth_ == ITEMS_DEPTH && feedKey_ == FeedKey::Items) {
+          inItems_ = true;
+        } else if (depth_ == ATTACHMENTS_DEPTH && inItems_ && itemKey_ == ItemKey::Attachments) {
+          inAttachments_ = true;
+        }
+        return true;
+      }
+
+      bool end_array() override {
+        if (depth_ == ITEMS_DEPTH) {
+          inItems_ = false;
+        } else if (depth_ == ATTACHMENTS_DEPTH) {
+          inAttachments_ = false;
+        }
+        depth_--;
+        return true;
+      }
+
+      bool parse_error(std::size_t /*position*/, const std::string & /*last_token*/,
+                       const nlohmann::detail::exception &ex) override {
+        error_ = ex.what();
+        return false;
+      }
+
+      [[nodiscard]] bool stopped() const { return stopped_; }
+      [[nodiscard]] bool isJsonFeed() const { return isObject_ && isJsonFeed_; }
+      [[nodiscard]] const std::string &error() const { return error_; }
+
+    private:
+      // A scalar where a container was expected, e.g. a top-level number, is not a feed
+      bool scalar() {
+        if (depth_ == 0) {
+          isObject_ = false;
+        }
+        return true;
+      }
+
+      void readItemString(string_t &val) {
+        switch (itemKey_) {
+        case ItemKey::Title: item_.title = arena_->store(val); break;
+        case ItemKey::Url: item_.url = arena_->store(val); break;
+        case ItemKey::ExternalUrl: item_.externalUrl = arena_->store(val); break;
+        case ItemKey::Summary: item_.summary = std::move(val); break;
+        case ItemKey::ContentText: item_.contentText = std::move(val); break;
+        case ItemKey::ContentHtml: item_.contentHtml = std::move(val); break;
+        case ItemKey::Image: item_.image = arena_->store(val); break;
+        case ItemKey::BannerImage: item_.bannerImage = arena_->store(val); break;
+        case ItemKey::DatePublished: item_.datePublished = arena_->store(val); break;
+        case ItemKey::DateModified: item_.dateModified = arena_->store(val); break;
+        default: break;
+        }
+      }
+
+      bool emitItem() {
+        RSSItem item;
+        item.arena = arena_;
+        buildJsonItem(item_, item);
+        if (onItem_ && !onItem_(std::move(item))) {
+          stopped_ = true;
+          return false;
+        }
+        return true;
+      }
+
+      RSSFeed &feed_;
+      const FeedItemHandler &onItem_;
+      std::shared_ptr<ItemArena> arena_;
+
+      size_t depth_{0};
+      bool isObject_{false};
+      bool isJsonFeed_{false};
+      bool inItems_{false};
+      bool inAttachments_{false};
+      bool firstAttachment_{false};
+      FeedKey feedKey_{FeedKey::Other};
+      ItemKey itemKey_{ItemKey::Other};
+      std::string attachmentKey_;
+      JsonItemFields item_;
+
+      bool stopped_{false};
+      std::string error_;
+    };
+
+  } // namespace
+
+  bool readJsonFeed(std::string_view json, RSSFeed &feed, const FeedItemHandler &onItem,
+                    std::string &error) {
+    if (!feed.arena) {
+      feed.arena = std::make_shared<ItemArena>();
+    }
+    JsonFeedSax sax(feed, onItem);
+    const bool complete = nlohmann::json::sax_parse(json.begin(), json.end(), &sax);
+    if (sax.stopped()) {
+      return true;
+    }
+    if (!complete) {
+      error = "JSON Feed is not well-formed: " + sax.error();
+      return false;
+    }
+    if (!sax.isJsonFeed()) {
+      error = "No valid JSON Feed found (missing https://jsonfeed.org/version/ object).";
+      return false;
+    }
+    return true;
+  }
+
+} // namespace dotnamebot::rss
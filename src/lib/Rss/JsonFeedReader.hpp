@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Rss/FeedReader.hpp>
+#include <Rss/RSSFeed.hpp>
+
+#include <string>
+#include <string_view>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Read a JSON Feed 1.0 / 1.1 document (https://jsonfeed.org/version/1.1) with a SAX
+   * walk, without building a JSON tree.
+   *
+   * Header: title, description and home_page_url. Items: title, url (else external_url),
+   * summary, content_text or content_html as the description, date_published (else
+   * date_modified), and media from the description's first image, the first attachment, then
+   * image / banner_image, later sources winning as they do for RSS.
+   *
+   * @param json UTF-8 document
+   * @param feed Receives the header fields. Item text goes to feed.arena, which is created
+   * when null.
+   * @param onItem Called for every item when its object ends; may be empty. Returning false
+   * stops reading.
+   * @param error Receives the reason when the document is rejected
+   * @return true for a well-formed (or stopped) feed, otherwise false
+   */
+  bool readJsonFeed(std::string_view json, RSSFeed &feed, const FeedItemHandler &onItem,
+                    std::string &error);
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,52 @@
+#include "KnownItems.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+
+namespace dotnamebot::rss {
+
+  void KnownItems::update(const std::vector<uint64_t> &hashes,
+                          const std::vector<time_t> &publishTimes, bool complete) {
+    bool ordered = std::is_sorted(publishTimes.begin(), publishTimes.end(), std::greater<>());
+    if (order_.empty()) {
+      ordered = ordered && publishTimes.size() >= 2;
+    } else {
+      // Once a known item has come, every later one must be known as well
+      const auto firstKnown = std::find_if(hashes.begin(), hashes.end(),
+                                           [this](uint64_t h) { return contains(h); });
+      ordered = ordered && std::all_of(firstKnown, hashes.end(),
+                                       [this](uint64_t h) { return contains(h); });
+    }
+    newestFirst_ = ordered;
+
+    std::vector<uint64_t> order(hashes.begin(), hashes.end());
+    if (!complete) {
+      // The document is assumed to go on with the previous list below the cut-off
+      const std::unordered_set<uint64_t> parsed(hashes.begin(), hashes.end());
+      const size_t length = std::max(order_.size(), hashes.size());
+      for (const uint64_t hash : order_) {
+        if (order.size() >= length) {
+          break;
+        }
+        if (!parsed.contains(hash)) {
+          order.push_back(hash);
+        }
+      }
+    }
+    order_ = std::move(order);
+    hashes_ = std::unordered_set<uint64_t>(order_.begin(), order_.end());
+  }
+
+  KnownItemsCutoff::KnownItemsCutoff(const KnownItems *known, size_t stopAfter)
+      : known_(known), stopAfter_(stopAfter) {}
+
+  bool KnownItemsCutoff::reached(uint64_t hash) {
+    if (!isActive()) {
+      return false;
+    }
+    run_ = known_->contains(hash) ? run_ + 1 : 0;
+    return run_ >= stopAfter_;
+  }
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <unordered_set>
+#include <vector>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Item hashes of a feed's last parse in document order, and whether the feed
+   * lists its items newest first.
+   *
+   * A refetch of a newest-first feed is a few new items followed by what the previous
+   * parse already returned. For such a feed, parsing may stop once it has met enough known
+   * items in a row (see KnownItemsCutoff); the rest of the document is assumed to be the
+   * older part of the previous one.
+   */
+  class KnownItems {
+  public:
+    [[nodiscard]] bool empty() const { return order_.empty(); }
+    [[nodiscard]] size_t size() const { return order_.size(); }
+    [[nodiscard]] bool contains(uint64_t hash) const { return hashes_.contains(hash); }
+    // Item hashes in document order
+    [[nodiscard]] const std::vector<uint64_t> &items() const { return order_; }
+    // Learned from the last update(); false until a parse showed the order
+    [[nodiscard]] bool isNewestFirst() const { return newestFirst_; }
+
+    /**
+     * @brief Take over the result of a parse and learn the feed's order from it
+     *
+     * The feed counts as newest first when the dated items never get newer further down
+     * and, if an earlier parse is known, the items new to this list all come before the
+     * known ones. A first parse needs at least two dates to tell.
+     *
+     * @param hashes Item hashes in document order
+     * @param publishTimes Dates of the dated items in document order
+     * @param complete false when parsing stopped early: the older part of the previous list
+     * is kept after hashes, up to the previous length
+     */
+    void update(const std::vector<uint64_t> &hashes,
+                const std::vector<time_t> &publishTimes, bool complete);
+
+  private:
+    std::vector<uint64_t> order_;
+    std::unordered_set<uint64_t> hashes_;
+    bool newestFirst_{false};
+  };
+
+  /**
+   * @brief Counts known items in a row while a document is parsed.
+   *
+   */
+  class KnownItemsCutoff {
+  public:
+    // Never stops
+    KnownItemsCutoff() = default;
+    /**
+     * @brief Construct a new Known Items Cutoff object
+     *
+     * @param known Items of the previous parse; must outlive the cutoff. nullptr never stops.
+     * @param stopAfter Known items in a row that end the parse; 0 never stops
+     */
+    KnownItemsCutoff(const KnownItems *known, size_t stopAfter);
+
+    [[nodiscard]] bool isActive() const { return known_ != nullptr && stopAfter_ > 0; }
+
+    /**
+     * @brief Record the next item of the document
+     *
+     * @param hash Item hash
+     * @return true once stopAfter known items in a row have been recorded
+     */
+    bool reached(uint64_t hash);
+
+    // Whether the parse has stopped here
+    [[nodiscard]] bool isReached() const { return isActive() && run_ >= stopAfter_; }
+
+  private:
+    const KnownItems *known_{nullptr};
+    size_t stopAfter_{0};
+    size_t run_{0};
+  };
+
+} // namespace dotnamebot::rss
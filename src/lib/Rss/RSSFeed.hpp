@@ -1,6 +1,11 @@
 #pragma once
+#include <Rss/ItemArena.hpp>
 #include <Rss/RSSItem.hpp>
+#include <cstdint>
+#include <ctime>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace dotnamebot::rss {
@@ -14,7 +19,18 @@ namespace dotnamebot::rss {
     std::string headDescription;
     std::string headLink;
     std::vector<RSSItem> items;
+    // Publish time of every dated item in the document, seen ones included
+    std::vector<time_t> publishTimes;
+    // Hash of every item with a title and a link in document order, seen ones included
+    std::vector<uint64_t> itemHashes;
+    // Holds the text of the parsed items
+    std::shared_ptr<ItemArena> arena;
+    // Parsing stopped at already-known items; later items and header fields are missing
+    bool truncated{false};
+    // Minimum refresh period advertised by <ttl> or sy:updatePeriod, 0 when absent
+    long updateHintSeconds{0};
     void addItem(const RSSItem &item) { items.push_back(item); };
+    void addItem(RSSItem &&item) { items.push_back(std::move(item)); };
     [[nodiscard]] size_t size() const { return items.size(); }
     void clear() { items.clear(); };
   };
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Per-feed fetch state persisted in rssFeedState.json, keyed by RSSUrl::url.
+   *
+   */
+  struct RSSFeedState {
+    // HTTP validators of the last full response, sent back as a conditional GET
+    std::string etag;
+    std::string lastModified;
+    // BodyHash::hex() of the last parsed body; a byte-identical body is not parsed again
+    std::string bodyHash;
+    // Adaptive polling: smoothed publish rate (items per hour, negative while unknown),
+    // the interval last chosen for the feed and the publisher's ttl / sy:update hint
+    double publishRate{-1.0};
+    long pollSeconds{0};
+    long updateHintSeconds{0};
+    // Health: consecutive failed polls, the last error and, once the circuit is open, the
+    // earliest time (unix seconds) the feed is tried again
+    int consecutiveFailures{0};
+    std::string lastError;
+    int64_t retryAt{0};
+    int64_t lastSuccessAt{0};
+    // The last download was aborted because the body exceeded the size limit
+    bool oversized{false};
+  };
+
+} // namespace dotnamebot::rss
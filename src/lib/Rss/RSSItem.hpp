@@ -1,8 +1,13 @@
 #pragma once
+#include <Rss/ItemArena.hpp>
+#include <Rss/ItemFingerprint.hpp>
 #include <Rss/RSSMedia.hpp>
 #include <cstdint>
 #include <dpp/dpp.h>
+#include <functional>
+#include <memory>
 #include <string>
+#include <string_view>
 
 namespace dotnamebot::rss {
 
@@ -15,61 +20,73 @@ namespace dotnamebot::rss {
   /**
    * @brief Represents a single RSS item.
    *
+   * The text fields are views into the arena the item was parsed into; the item keeps that
+   * arena alive, so copies of an item are cheap and stay valid on their own.
    */
   struct RSSItem {
-    std::string title;
-    std::string url;
-    std::string description;
-    std::string pubDate;
-    std::string hash;
-    std::string feedLabel;
+    std::string_view title;
+    std::string_view url;
+    std::string_view description;
+    std::string_view pubDate;
+    std::string_view feedLabel;
+    std::string_view feedUrl; // RSSUrl::url of the source feed
     RSSMedia rssMedia;
     EmbeddedType embeddedType;
     uint64_t discordChannelId;
+    // ItemFingerprint of title, url and description as read from the feed
+    uint64_t hash{0};
+    // std::hash value seenHashes.json stored before fingerprints; only set by
+    // generateLegacyHash() while such entries are still being migrated
+    uint64_t legacyHash{0};
+    // Owns the text behind the views above
+    std::shared_ptr<ItemArena> arena;
 
     RSSItem()
-        : rssMedia(std::string(), std::string()), embeddedType(EmbeddedType::EMBEDDED_NONE),
-          discordChannelId(0) {
-      // Default constructor - std:string members are default-initialized
+        : rssMedia(std::string_view(), std::string_view()),
+          embeddedType(EmbeddedType::EMBEDDED_NONE), discordChannelId(0) {
+      // Default constructor - all views empty, no arena
     }
-    RSSItem(std::string &title, std::string &url, std::string &description, RSSMedia &rssMedia,
-            std::string &pubDate, EmbeddedType embeddedType, uint64_t discordChannelId)
-        : title(std::move(title)), url(std::move(url)), description(std::move(description)),
-          pubDate(std::move(pubDate)), rssMedia(std::move(rssMedia)), embeddedType(embeddedType),
-          discordChannelId(discordChannelId) {
 
-      // Generate the hash for the RSS item
-      generateHash();
-    }
+    void generateHash() { hash = ItemFingerprint().add(title).add(url).add(description).value(); }
 
-    void generateHash() {
-      std::hash<std::string> hasher;
-      hash = std::to_string(hasher(title + url + description));
+    void generateLegacyHash() {
+      thread_local std::string key;
+      key.assign(title).append(url).append(description);
+      legacyHash = std::hash<std::string_view>{}(key);
     }
 
-    [[nodiscard]] std::string toMarkdownLink() const { return "[" + title + "](" + url + ")"; }
+    [[nodiscard]] std::string toMarkdownLink() const {
+      return "[" + std::string(title) + "](" + std::string(url) + ")";
+    }
 
     [[nodiscard]] std::string toDebug() const {
-      return "Title: " + title + "\nURL: " + url + "\nDescription: " + description +
-             "\nPublication Date: " + pubDate +
-             "\nEmbeddedType: " + std::to_string(static_cast<int>(embeddedType)) +
-             "\nDiscord Channel ID: " + std::to_string(discordChannelId) + "\nHash: " + hash +
-             "\nMedia URL: " + rssMedia.url + "\nMedia Type: " + rssMedia.type;
+      std::string out;
+      out.append("Title: ").append(title);
+      out.append("\nURL: ").append(url);
+      out.append("\nDescription: ").append(description);
+      out.append("\nPublication Date: ").append(pubDate);
+      out.append("\nEmbeddedType: ").append(std::to_string(static_cast<int>(embeddedType)));
+      out.append("\nDiscord Channel ID: ").append(std::to_string(discordChannelId));
+      out.append("\nHash: ").append(fingerprintToHex(hash));
+      out.append("\nMedia URL: ").append(rssMedia.url);
+      out.append("\nMedia Type: ").append(rssMedia.type);
+      return out;
     }
 
     [[nodiscard]] dpp::embed toEmbed() const {
       dpp::embed e;
-      e.set_title(title);
-      e.set_url(url);
-      e.set_description(description);
+      e.set_title(std::string(title));
+      e.set_url(std::string(url));
+      e.set_description(std::string(description));
       if (!pubDate.empty()) {
-        e.add_field("Published", pubDate, false);
+        e.add_field("Published", std::string(pubDate), false);
       }
       if (!rssMedia.url.empty()) {
-        if (rssMedia.type.find("image/") == 0) {
-          e.set_image(rssMedia.url);
+        const std::string mediaUrl(rssMedia.url);
+        if (rssMedia.type.starts_with("image/")) {
+          e.set_image(mediaUrl);
         } else {
-          e.add_field("Media", "[" + rssMedia.url + "](" + rssMedia.url + ")", false);
+          e.add_field("Media", "[" + mediaUrl + "](" + mediaUrl + ")", false);
         }
       }
       return e;
@@ -1,17 +1,18 @@
 #pragma once
-#include <string>
+#include <string_view>
 
 namespace dotnamebot::rss {
 
   /**
    * @brief Represents an media content from a RSS feed item.
    *
+   * Views into the item's ItemArena (or string literals), like the other RSSItem fields.
    */
   struct RSSMedia {
-    std::string url;
-    std::string type;
+    std::string_view url;
+    std::string_view type;
 
-    RSSMedia(std::string u, std::string t) : url(std::move(u)), type(std::move(t)) {}
+    RSSMedia(std::string_view u, std::string_view t) : url(u), type(t) {}
   };
 
 } // namespace dotnamebot::rss
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -13,6 +14,14 @@ namespace dotnamebot::rss {
     std::string label;
     long embeddedType;
     uint64_t discordChannelId;
+    // Per-feed polling bounds in seconds; 0 falls back to RssOptions
+    long minPollSeconds{0};
+    long maxPollSeconds{0};
+    // Per-feed body size limit in bytes; 0 falls back to RssOptions::maxFeedBytes
+    size_t maxBytes{0};
+    // Stop parsing after this many already-known items in a row, once the feed is known to
+    // list newest items first; 0 falls back to RssOptions::stopAfterSeenItems
+    size_t stopAfterSeenItems{0};
     RSSUrl() : embeddedType(0), discordChannelId(0) {}
     RSSUrl(std::string u, long e = 0, uint64_t dChId = 0, std::string lbl = "")
         : url(std::move(u)), label(std::move(lbl)), embeddedType(e), discordChannelId(dChId) {}
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Counters and timings of one feed refresh, for logs and benchmarks.
+   *
+   */
+  struct RefreshStats {
+    // Feeds downloaded in this refresh (suspended and not-due feeds are not counted)
+    size_t feeds{0};
+    size_t failedFeeds{0};
+    // 304 responses and bodies identical to the previous one
+    size_t unchangedFeeds{0};
+    int newItems{0};
+    // Feeds whose parse stopped at already-known items (stopAfterSeenItems)
+    size_t stoppedFeeds{0};
+    // Decoded body bytes received over all feeds
+    uint64_t bodyBytes{0};
+    // Wall time until the last download finished (parsing and merging overlap it), and of
+    // the whole refresh
+    double downloadSeconds{0.0};
+    double totalSeconds{0.0};
+    // Transfer time of every feed, in the order the feeds were merged
+    std::vector<double> feedSeconds;
+  };
+
+} // namespace dotnamebot::rss
@@ -1,13 +1,31 @@
 
 #include "RssManager.hpp"
 
+#include <Http/HttpClient.hpp>
+#include <Rss/FeedDate.hpp>
+#include <Rss/FeedEncoding.hpp>
+#include <Rss/FeedReader.hpp>
+#include <Rss/FeedStreamParser.hpp>
+#include <Rss/HtmlEntities.hpp>
+#include <Rss/HtmlText.hpp>
+#include <Rss/ItemArena.hpp>
+#include <Rss/ItemFingerprint.hpp>
+#include <Utils/Concurrency/BoundedQueue.hpp>
+
 #include <algorithm>
-#include <curl/curl.h>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
 #include <fstream>
-#include <iconv.h>
+#include <memory>
+#include <optional>
 #include <random>
-#include <regex>
+#include <semaphore>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
 
 static std::string extractDomain(const std::string &url) {
@@ -25,13 +43,75 @@ static std::string extractDomain(const std::string &url) {
 
 namespace dotnamebot::rss {
 
+  namespace {
+
+    // Body chunks (at most 16 KiB each from curl) waiting for their feed's parser; when
+    // parsing falls this far behind, the downloads wait for it
+    constexpr std::ptrdiff_t MAX_QUEUED_CHUNKS = 1024;
+    // Parsed feeds waiting for the merger
+    constexpr size_t MERGE_QUEUE_CAPACITY = 64;
+    // seenHashes.json layout next to a seenHashes.index
+    constexpr int SEEN_HASHES_VERSION = 3;
+    // Seen items kept in memory and in seenHashes.journal before they are folded into
+    // seenHashes.index
+    constexpr size_t MAX_SEEN_DELTA = 4096;
+    // Below this history the index (16 bytes per item) stays in L2 anyway and a Bloom filter
+    // in front of it would only add a lookup
+    constexpr size_t MIN_FILTERED_HISTORY = 65536;
+
+    SeenDay currentDay() {
+      const auto now = std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now());
+      return static_cast<SeenDay>(now.time_since_epoch().count());
+    }
+
+    // Parser of a streamed feed and the strand its chunks are parsed on
+    struct FeedStream {
+      explicit FeedStream(utils::WorkerPool &pool) : strand(pool) {}
+
+      std::unique_ptr<FeedStreamParser> parser;
+      utils::Strand strand;
+      // Set by the strand once the parser failed, read by the write callback
+      std::atomic<bool> rejected{false};
+      // The raw body, only collected when it is to be cached
+      std::string body;
+    };
+
+    // A finished download on its way to the merger
+    struct FeedJob {
+      // Index of a job that only fills the slot of a feed the refresh gave up on
+      static constexpr size_t NO_FEED = static_cast<size_t>(-1);
+
+      FeedJob(size_t index, FeedResponse &&response)
+          : index(index), response(std::move(response)) {}
+
+      size_t index{0};
+      FeedResponse response;
+      // The body is byte-identical to the last merged one and was not parsed
+      bool identical{false};
+      // parsedFeeds[index] holds the parse result
+      bool parsed{false};
+      std::string parseError;
+    };
+
+  } // namespace
+
   RssManager::RssManager(std::shared_ptr<dotnamebot::logging::ILogger> logger,
-                         std::shared_ptr<dotnamebot::assets::IAssetManager> assetManager)
-      : logger_(std::move(logger)), assetManager_(std::move(assetManager)) {
+                         std::shared_ptr<dotnamebot::assets::IAssetManager> assetManager,
+                         std::shared_ptr<dotnamebot::http::IHttpClient> httpClient)
+      : logger_(std::move(logger)), assetManager_(std::move(assetManager)),
+        httpClient_(httpClient ? std::move(httpClient)
+                               : std::make_shared<dotnamebot::http::HttpClient>()),
+        fetcher_(logger_, httpClient_, options_.maxParallelFetches), scheduler_(options_) {
 
     rng_.seed(std::random_device{}());
+    setOptions(options_);
     urlsPath_ = assetManager_->getAssetsPath() / "rssUrls.json";
     hashesPath_ = assetManager_->getAssetsPath() / "seenHashes.json";
+    indexPath_ = assetManager_->getAssetsPath() / "seenHashes.index";
+    journal_.setPath(assetManager_->getAssetsPath() / "seenHashes.journal");
+    optionsPath_ = assetManager_->getAssetsPath() / "rssOptions.json";
+    feedStatePath_ = assetManager_->getAssetsPath() / "rssFeedState.json";
+    feedCache_.setDirectory(assetManager_->getAssetsPath() / "feedCache");
 
     if (!isInitialized_) {
       isInitialized_ = this->Initialize();
@@ -62,12 +142,12 @@ namespace dotnamebot::rss {
     }
 
     if (!std::filesystem::exists(hashesPath_)) {
-      nlohmann::json defaultHashes = nlohmann::json::array();
-      std::ofstream file(hashesPath_);
-      if (!file.is_open()) {
+      // An index and a journal without the JSON file still list what was posted
+      seenIndex_.open(indexPath_);
+      journal_.replay(seenHashes_);
+      if (!saveAllSeenHashes()) {
         return false;
       }
-      file << defaultHashes.dump(4);
       logger_->infoStream() << "Created default seen hashes file at: " << hashesPath_;
     }
 
@@ -79,28 +159,531 @@ namespace dotnamebot::rss {
       hashesLastModified_ = std::filesystem::last_write_time(hashesPath_);
     }
 
-    return loadUrls() && loadSeenHashes();
+    loadOptions();
+    loadFeedStates();
+    if (!loadUrls() || !loadSeenHashes()) {
+      return false;
+    }
+    if (options_.cacheFeedBodies) {
+      loadCachedFeeds();
+    }
+    return true;
+  }
+
+  void RssManager::setOptions(const RssOptions &options) {
+    options_ = options;
+    fetcher_.setMaxParallel(options_.maxParallelFetches);
+    fetcher_.setHostLimits(
+        {options_.maxFetchesPerHost, options_.hostRequestsPerSecond, options_.hostBurst});
+    fetcher_.setRespectRetryAfter(options_.respectRetryAfter);
+    scheduler_.setOptions(options_);
   }
 
-  int RssManager::refetchRssFeeds() {
-    if (!hasFilesChanged()) {
-      logger_->infoStream() << "Files changed, reloading URLs and seen hashes.";
+  bool RssManager::loadOptions() {
+    if (!std::filesystem::exists(optionsPath_)) {
+      return false;
+    }
+
+    std::ifstream file(optionsPath_);
+    if (!file.is_open()) {
+      return false;
     }
 
-    feed_.clear();
-    int totalItems = 0;
+    try {
+      nlohmann::json jsonData;
+      file >> jsonData;
+      setOptions(RssOptions::fromJson(jsonData));
+    } catch (const std::exception &e) {
+      logger_->errorStream() << "RSS options file corrupted: " << e.what() << ". Using defaults.";
+      return false;
+    }
+
+    logger_->infoStream() << "Loaded RSS options (max parallel fetches: "
+                          << options_.maxParallelFetches << ", polling every "
+                          << options_.minPollSeconds << "-" << options_.maxPollSeconds << " s)";
+    return true;
+  }
+
+  bool RssManager::loadFeedStates() {
+    if (!std::filesystem::exists(feedStatePath_)) {
+      return false;
+    }
+
+    std::ifstream file(feedStatePath_);
+    if (!file.is_open()) {
+      return false;
+    }
+
+    nlohmann::json jsonData;
+    try {
+      file >> jsonData;
+    } catch (const std::exception &e) {
+      logger_->errorStream() << "Feed state file corrupted: " << e.what() << ". Ignoring it.";
+      return false;
+    }
+
+    feedStates_.clear();
+    if (!jsonData.is_object()) {
+      return false;
+    }
+    for (const auto &[url, entry] : jsonData.items()) {
+      if (!entry.is_object()) {
+        continue;
+      }
+      RSSFeedState state;
+      if (entry.contains("etag") && entry["etag"].is_string()) {
+        state.etag = entry["etag"].get<std::string>();
+      }
+      if (entry.contains("lastModified") && entry["lastModified"].is_string()) {
+        state.lastModified = entry["lastModified"].get<std::string>();
+      }
+      if (entry.contains("bodyHash") && entry["bodyHash"].is_string()) {
+        state.bodyHash = entry["bodyHash"].get<std::string>();
+      }
+      if (entry.contains("publishRate") && entry["publishRate"].is_number()) {
+        state.publishRate = entry["publishRate"].get<double>();
+      }
+      if (entry.contains("pollSeconds") && entry["pollSeconds"].is_number_integer()) {
+        state.pollSeconds = entry["pollSeconds"].get<long>();
+      }
+      if (entry.contains("updateHintSeconds") && entry["updateHintSeconds"].is_number_integer()) {
+        state.updateHintSeconds = entry["updateHintSeconds"].get<long>();
+      }
+      if (entry.contains("failures") && entry["failures"].is_number_integer()) {
+        state.consecutiveFailures = entry["failures"].get<int>();
+      }
+      if (entry.contains("lastError") && entry["lastError"].is_string()) {
+        state.lastError = entry["lastError"].get<std::string>();
+      }
+      if (entry.contains("retryAt") && entry["retryAt"].is_number_integer()) {
+        state.retryAt = entry["retryAt"].get<int64_t>();
+      }
+      if (entry.contains("lastSuccessAt") && entry["lastSuccessAt"].is_number_integer()) {
+        state.lastSuccessAt = entry["lastSuccessAt"].get<int64_t>();
+      }
+      if (entry.contains("oversized") && entry["oversized"].is_boolean()) {
+        state.oversized = entry["oversized"].get<bool>();
+      }
+      feedStates_[url] = std::move(state);
+    }
+
+    // Feeds whose circuit was open at shutdown stay suspended until their retry time
+    size_t suspended = 0;
+    const auto now = FeedScheduler::Clock::now();
+    for (const auto &[url, state] : feedStates_) {
+      scheduler_.restore(url, state, now);
+      if (scheduler_.isSuspended(state, now)) {
+        suspended++;
+      }
+    }
+
+    logger_->infoStream() << "Loaded fetch state for " << feedStates_.size() << " feeds ("
+                          << suspended << " suspended).";
+    return true;
+  }
+
+  bool RssManager::saveFeedStates() {
+    nlohmann::json jsonData = nlohmann::json::object();
     for (const auto &rssUrl : urls_) {
-      int items = fetchUrlSource(rssUrl.url, rssUrl.embeddedType, rssUrl.discordChannelId);
-      if (items > 0) {
-        totalItems += items;
+      auto it = feedStates_.find(rssUrl.url);
+      if (it == feedStates_.end()) {
+        continue;
+      }
+      const RSSFeedState &state = it->second;
+      nlohmann::json entry = nlohmann::json::object();
+      if (!state.etag.empty()) {
+        entry["etag"] = state.etag;
+      }
+      if (!state.lastModified.empty()) {
+        entry["lastModified"] = state.lastModified;
+      }
+      if (!state.bodyHash.empty()) {
+        entry["bodyHash"] = state.bodyHash;
+      }
+      if (state.publishRate >= 0.0) {
+        entry["publishRate"] = state.publishRate;
+      }
+      if (state.pollSeconds > 0) {
+        entry["pollSeconds"] = state.pollSeconds;
+      }
+      if (state.updateHintSeconds > 0) {
+        entry["updateHintSeconds"] = state.updateHintSeconds;
       }
+      if (state.consecutiveFailures > 0) {
+        entry["failures"] = state.consecutiveFailures;
+        entry["lastError"] = state.lastError;
+      }
+      if (state.retryAt > 0) {
+        entry["retryAt"] = state.retryAt;
+      }
+      if (state.lastSuccessAt > 0) {
+        entry["lastSuccessAt"] = state.lastSuccessAt;
+      }
+      if (state.oversized) {
+        entry["oversized"] = true;
+      }
+      jsonData[rssUrl.url] = entry;
+    }
+
+    std::ofstream file(feedStatePath_);
+    if (!file.is_open()) {
+      return false;
     }
+    file << jsonData.dump(4);
+    return true;
+  }
+
+  int RssManager::refetchRssFeeds() { return refetchFeeds(false); }
+
+  int RssManager::refetchDueRssFeeds() { return refetchFeeds(true); }
+
+  std::chrono::seconds RssManager::timeUntilNextFetch() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return scheduler_.timeUntilNextDue(urls_, FeedScheduler::Clock::now());
+  }
+
+  RefreshStats RssManager::getLastRefreshStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lastRefreshStats_;
+  }
+
+  int RssManager::refetchFeeds(bool onlyDue) {
+    std::lock_guard<std::mutex> refreshLock(refreshMutex_);
+    const auto refreshStartedAt = std::chrono::steady_clock::now();
+    std::vector<RSSUrl> sources;
+    std::vector<FeedRequest> requests;
+    // Copies of knownItems_ for feeds that may stop parsing early, and the run that stops them
+    std::vector<KnownItems> knownItems;
+    std::vector<size_t> stopAfter;
+    // Body hash of the last merged body, for feeds that may skip an identical one
+    std::vector<std::string> lastBodyHashes;
+    std::shared_ptr<utils::WorkerPool> workers;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (hasFilesChanged()) {
+        logger_->infoStream() << "Files changed, reloading URLs and seen hashes.";
+      }
+      // The first refresh of each day writes the index anew, which stores the refreshed
+      // last-seen days and sweeps out what no feed has listed for seenHistoryDays
+      if (seenIndexDay_ != currentDay() && !saveAllSeenHashes()) {
+        logger_->error("Failed to save seen hashes");
+      }
+
+      // Drop buffered items and schedules of feeds that are no longer configured
+      std::erase_if(feed_.items, [this](const RSSItem &item) {
+        return std::none_of(urls_.begin(), urls_.end(),
+                            [&item](const RSSUrl &rssUrl) { return rssUrl.url == item.feedUrl; });
+      });
+      scheduler_.prune(urls_);
+      feedCache_.prune(urls_);
+      std::erase_if(knownItems_, [this](const auto &entry) {
+        return std::none_of(urls_.begin(), urls_.end(),
+                            [&entry](const RSSUrl &rssUrl) { return rssUrl.url == entry.first; });
+      });
+
+      // Work on a snapshot so slash commands editing urls_ cannot shift indices mid-refresh
+      const auto now = FeedScheduler::Clock::now();
+      size_t suspended = 0;
+      for (const auto &rssUrl : urls_) {
+        if (onlyDue && !scheduler_.isDue(rssUrl.url, now)) {
+          continue;
+        }
+        // An open circuit is respected even on a manual refetch; modUrl closes it
+        auto stateIt = feedStates_.find(rssUrl.url);
+        if (stateIt != feedStates_.end() && scheduler_.isSuspended(stateIt->second, now)) {
+          suspended++;
+          continue;
+        }
+        sources.push_back(rssUrl);
+        FeedRequest request{rssUrl.url, extractDomain(rssUrl.url), {}, {}, nullptr,
+                            rssUrl.maxBytes > 0 ? rssUrl.maxBytes : options_.maxFeedBytes};
+        auto it = feedStates_.find(rssUrl.url);
+        if (it != feedStates_.end() && primedFeeds_.contains(rssUrl.url)) {
+          request.etag = it->second.etag;
+          request.lastModified = it->second.lastModified;
+          lastBodyHashes.push_back(it->second.bodyHash);
+        } else {
+          lastBodyHashes.emplace_back();
+        }
+        requests.push_back(std::move(request));
+
+        // Only feeds whose last parse showed them newest first may stop at known items
+        const size_t run = rssUrl.stopAfterSeenItems > 0 ? rssUrl.stopAfterSeenItems
+                                                         : options_.stopAfterSeenItems;
+        auto knownIt = knownItems_.find(rssUrl.url);
+        if (run > 0 && knownIt != knownItems_.end() && knownIt->second.isNewestFirst()) {
+          knownItems.push_back(knownIt->second);
+          stopAfter.push_back(run);
+        } else {
+          knownItems.emplace_back();
+          stopAfter.push_back(0);
+        }
+      }
+      if (suspended > 0) {
+        logger_->infoStream() << "Skipping " << suspended << " suspended feeds.";
+      }
+      if (!requests.empty() && (!workers_ || (options_.parseThreads > 0 &&
+                                              workers_->size() != options_.parseThreads))) {
+        // A refresh still running keeps its own reference to a replaced pool
+        workers_ = std::make_shared<utils::WorkerPool>(options_.parseThreads);
+      }
+      workers = workers_;
+    }
+    if (requests.empty()) {
+      return 0;
+    }
+
+    // Stages of the refresh: the calling thread drives all downloads on the curl event loop,
+    // the worker pool transcodes and parses the bodies, and a single merger thread commits
+    // the results into feed_ under the lock. Bounded hand-offs keep a slow stage from piling
+    // up work in front of it.
+    std::vector<RSSFeed> parsedFeeds(sources.size());
+    std::vector<KnownItemsCutoff> cutoffs;
+    cutoffs.reserve(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+      cutoffs.emplace_back(&knownItems[i], stopAfter[i]);
+    }
+
+    // In streaming mode every feed gets its own parser. Body chunks are copied off the curl
+    // write callback and parsed on the feed's strand, so items are read while the rest of
+    // the body is still in flight, the body itself is never held in memory, and a slow
+    // parse does not stall the other downloads. The seen-hash check needs the lock and is
+    // left to mergeFeed.
+    std::vector<std::unique_ptr<FeedStream>> streams(sources.size());
+    std::counting_semaphore<> chunkSlots(MAX_QUEUED_CHUNKS);
+    if (options_.streamingParse) {
+      for (size_t i = 0; i < sources.size(); ++i) {
+        RSSFeed &parsed = parsedFeeds[i];
+        const RSSUrl &rssUrl = sources[i];
+        streams[i] = std::make_unique<FeedStream>(*workers);
+        streams[i]->parser = std::make_unique<FeedStreamParser>(
+            [&parsed](RSSFeed &&header, FeedFormat) { parsed = std::move(header); },
+            [&parsed, &rssUrl, &cutoff = cutoffs[i],
+             legacyHash = migratingLegacyHashes_.load()](RSSItem &&rssItem) {
+              rssItem.embeddedType = static_cast<EmbeddedType>(rssUrl.embeddedType);
+              rssItem.discordChannelId = rssUrl.discordChannelId;
+              if (!prepareItem(rssItem, parsed, legacyHash)) {
+                return true;
+              }
+              parsed.truncated = cutoff.reached(rssItem.hash);
+              parsed.addItem(std::move(rssItem));
+              return !parsed.truncated;
+            });
+        requests[i].onData = [stream = streams[i].get(), &chunkSlots,
+                              keep = options_.cacheFeedBodies](std::string_view chunk) {
+          // Streamed bodies are only collected when they are to be cached
+          if (keep) {
+            stream->body.append(chunk);
+          }
+          if (stream->rejected) {
+            // The parser gave up on an earlier chunk: abort the transfer
+            return false;
+          }
+          chunkSlots.acquire();
+          stream->strand.post([stream, &chunkSlots, data = std::string(chunk)]() {
+            if (!stream->parser->write(data)) {
+              stream->rejected = true;
+            }
+            chunkSlots.release();
+          });
+          return true;
+        };
+      }
+    }
+
+    RefreshStats stats;
+    int totalItems = 0;
+    int notModifiedFeeds = 0;
+    int identicalFeeds = 0;
+
+    // A feed that answers 304 or sends the same bytes still lists what it listed before, so
+    // those items stay in the seen history
+    auto refreshUnchangedFeed = [this](const std::string &url) {
+      if (auto known = knownItems_.find(url); known != knownItems_.end()) {
+        refreshSeenItems(known->second.items());
+      }
+    };
+
+    // Runs on the merger thread, with the lock held
+    auto commit = [&](FeedJob &job) {
+      const size_t i = job.index;
+      FeedResponse &response = job.response;
+      const auto polledAt = FeedScheduler::Clock::now();
+      RSSFeedState &state = feedStates_[response.url];
+      FeedPollResult poll;
+      poll.fetched = response.ok();
+      poll.retryAfterSeconds = response.retryAfterSeconds;
+      poll.error = response.error;
+      if (response.oversized) {
+        state.oversized = true;
+      } else if (response.ok()) {
+        state.oversized = false;
+      }
+
+      if (response.oversized) {
+        // Never parsed; the circuit breaker keeps such a feed from being downloaded often
+        logger_->warningStream() << "Feed '" << response.url << "' is oversized: "
+                                 << response.error << ". Not parsed.";
+      } else if (!response.ok()) {
+        if (streams[i] && !streams[i]->parser->error().empty()) {
+          // The stream parser rejected the body and aborted the download
+          logger_->errorStream() << "Failed to parse feed '" << response.url
+                                 << "': " << streams[i]->parser->error();
+        } else {
+          logger_->errorStream() << "CURL error for URL '" << response.url
+                                 << "': " << response.error;
+        }
+      } else if (response.notModified()) {
+        // Buffered items of this feed are still current; no transcode, parse or hashing
+        refreshUnchangedFeed(response.url);
+        notModifiedFeeds++;
+      } else if (job.identical) {
+        // The server ignored the conditional GET but sent the same bytes again: the buffer
+        // is still current, so skip transcoding, the merge and the seen-hash lookups
+        state.etag = response.etag;
+        state.lastModified = response.lastModified;
+        refreshUnchangedFeed(response.url);
+        identicalFeeds++;
+      } else {
+        if (!job.parseError.empty()) {
+          // The buffer keeps the feed's items, and neither validators nor the body are
+          // remembered, so the next poll downloads the body again instead of skipping it
+          logger_->errorStream() << "Failed to parse feed '" << response.url
+                                 << "': " << job.parseError;
+          poll.fetched = false;
+          poll.error = job.parseError;
+        } else {
+          state.etag = response.etag;
+          state.lastModified = response.lastModified;
+          state.bodyHash = response.bodyHash;
+          if (options_.cacheFeedBodies &&
+              !feedCache_.store(response.url, streams[i] ? streams[i]->body : response.body)) {
+            logger_->warningStream() << "Failed to cache the body of '" << response.url << "'";
+          }
+          if (job.parsed) {
+            totalItems += mergeFeed(sources[i], parsedFeeds[i], 0, poll);
+            primedFeeds_.insert(response.url);
+          }
+        }
+        if (cutoffs[i].isReached()) {
+          stats.stoppedFeeds++;
+        }
+      }
+
+      long interval = scheduler_.recordPoll(sources[i], state, poll, polledAt);
+      if (scheduler_.isSuspended(state, polledAt)) {
+        logger_->warningStream() << "Feed '" << response.url << "' failed "
+                                 << state.consecutiveFailures << " times in a row, suspended for "
+                                 << (state.retryAt - FeedScheduler::Clock::to_time_t(polledAt))
+                                 << " s. Last error: " << state.lastError;
+      } else {
+        logger_->debugStream() << "Next poll of '" << response.url << "' in ~" << interval
+                               << " s (publish rate: " << state.publishRate << " items/h)";
+      }
+
+      stats.bodyBytes += response.bodyBytes;
+      stats.feedSeconds.push_back(response.elapsedSeconds);
+      if (!poll.fetched) {
+        stats.failedFeeds++;
+      }
+    };
+
+    utils::BoundedQueue<FeedJob> mergeQueue(MERGE_QUEUE_CAPACITY);
+    std::thread merger([&]() {
+      for (size_t done = 0; done < sources.size(); ++done) {
+        FeedJob job = mergeQueue.pop();
+        if (job.index == FeedJob::NO_FEED) {
+          continue;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        try {
+          commit(job);
+        } catch (const std::exception &e) {
+          logger_->errorStream() << "Failed to merge feed '" << job.response.url
+                                 << "': " << e.what();
+        }
+      }
+    });
+
+    // Every response goes on to the merger exactly once: streamed ones behind their last
+    // chunk on the feed's strand, buffered ones through a parse task when there is a new
+    // body, the rest directly
+    auto startedAt = std::chrono::steady_clock::now();
+    size_t handedOver = 0;
+    try {
+      fetcher_.fetchEach(requests, [&](size_t i, FeedResponse &&response) {
+        FeedJob job{i, std::move(response)};
+        const bool changed = job.response.ok() && !job.response.notModified();
+        job.identical = changed && !job.response.bodyHash.empty() &&
+                        job.response.bodyHash == lastBodyHashes[i];
+        if (streams[i]) {
+          streams[i]->strand.post([&, i, job = std::move(job)]() mutable {
+            if (job.response.ok() && !job.response.notModified() && !job.identical) {
+              job.parsed = streams[i]->parser->finish();
+              if (!job.parsed) {
+                job.parseError = streams[i]->parser->error();
+              }
+            }
+            mergeQueue.push(std::move(job));
+          });
+        } else if (changed && !job.identical && !job.response.body.empty()) {
+          workers->submit([&, i, job = std::move(job)]() mutable {
+            try {
+              std::string utf8;
+              const std::string_view body = convertToUtf8(job.response.body, utf8);
+              job.parsed = readFeed(body, sources[i].embeddedType, sources[i].discordChannelId,
+                                    parsedFeeds[i], job.parseError, &cutoffs[i],
+                                    detectFeedFormat(job.response.contentType, body));
+            } catch (const std::exception &e) {
+              job.parseError = e.what();
+            }
+            mergeQueue.push(std::move(job));
+          });
+        } else {
+          mergeQueue.push(std::move(job));
+        }
+        handedOver++;
+      });
+      stats.downloadSeconds =
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - startedAt).count();
+      auto downloadMs = static_cast<long long>(stats.downloadSeconds * 1000.0);
+      logger_->infoStream() << "Downloaded " << sources.size() << " feeds in " << downloadMs
+                            << " ms (max parallel: " << fetcher_.getMaxParallel() << ", "
+                            << workers->size() << " parse workers)";
+    } catch (...) {
+      // Parse tasks, chunks on the strands and the merger all use this frame: fill the slots
+      // of the feeds never handed over, and let everything finish before it unwinds
+      for (; handedOver < sources.size(); ++handedOver) {
+        mergeQueue.push(FeedJob(FeedJob::NO_FEED, FeedResponse{}));
+      }
+      workers->wait();
+      merger.join();
+      throw;
+    }
+    merger.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!saveFeedStates()) {
+      logger_->error("Failed to save RSS feed state");
+    }
+    logger_->infoStream() << notModifiedFeeds << " feeds not modified since the last fetch, "
+                          << identicalFeeds << " sent an identical body, " << stats.stoppedFeeds
+                          << " stopped parsing at known items.";
     logger_->infoStream() << "Total fetched items: " << totalItems
                           << " (total in buffer: " << feed_.items.size() << ")";
+
+    stats.feeds = sources.size();
+    stats.unchangedFeeds = static_cast<size_t>(notModifiedFeeds + identicalFeeds);
+    stats.newItems = totalItems;
+    stats.totalSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - refreshStartedAt)
+            .count();
+    lastRefreshStats_ = std::move(stats);
     return totalItems;
   }
 
   bool RssManager::addUrl(const std::string &url, long embedded, uint64_t discordChannelId) {
+    std::lock_guard<std::mutex> lock(mutex_);
     for (const auto &existingUrl : urls_) {
       if (existingUrl.url == url) {
         logger_->warningStream() << "URL already exists: " << url;
@@ -112,10 +695,13 @@ namespace dotnamebot::rss {
   }
 
   bool RssManager::modUrl(const std::string &url, long embeddedType, uint64_t discordChannelId) {
+    std::lock_guard<std::mutex> lock(mutex_);
     for (auto &existingUrl : urls_) {
       if (existingUrl.url == url) {
         existingUrl.embeddedType = embeddedType;
         existingUrl.discordChannelId = discordChannelId;
+        // Editing a feed is the way to retry it right away
+        scheduler_.reset(url, feedStates_[url]);
         return saveUrls();
       }
     }
@@ -124,6 +710,7 @@ namespace dotnamebot::rss {
   }
 
   bool RssManager::remUrl(const std::string &url) {
+    std::lock_guard<std::mutex> lock(mutex_);
     auto it = std::remove_if(urls_.begin(), urls_.end(),
                              [&url](const RSSUrl &rssUrl) { return rssUrl.url == url; });
     if (it != urls_.end()) {
@@ -143,6 +730,18 @@ namespace dotnamebot::rss {
       if (!url.label.empty()) {
         entry["label"] = url.label;
       }
+      if (url.minPollSeconds > 0) {
+        entry["minPollSeconds"] = url.minPollSeconds;
+      }
+      if (url.maxPollSeconds > 0) {
+        entry["maxPollSeconds"] = url.maxPollSeconds;
+      }
+      if (url.maxBytes > 0) {
+        entry["maxBytes"] = url.maxBytes;
+      }
+      if (url.stopAfterSeenItems > 0) {
+        entry["stopAfterSeenItems"] = url.stopAfterSeenItems;
+      }
       jsonData.push_back(entry);
     }
     std::ofstream file(urlsPath_);
@@ -154,6 +753,7 @@ namespace dotnamebot::rss {
   }
 
   std::string RssManager::listUrlsAsString() {
+    std::lock_guard<std::mutex> lock(mutex_);
     std::string sourcesList;
     sourcesList = "";
     for (const auto &url : urls_) {
@@ -161,22 +761,48 @@ namespace dotnamebot::rss {
       if (url.discordChannelId != 0) {
         sourcesList += " [Channel: " + std::to_string(url.discordChannelId) + "]";
       }
+      sourcesList += feedHealthAsString(url.url);
       sourcesList += "\n";
     }
     return sourcesList.empty() ? "No RSS sources available." : sourcesList;
   }
 
   std::string RssManager::listChannelUrlsAsString(uint64_t discordChannelId) {
+    std::lock_guard<std::mutex> lock(mutex_);
     std::string sourcesList;
     for (const auto &url : urls_) {
       if (url.discordChannelId == discordChannelId) {
-        sourcesList +=
-            "- " + url.url + " with embeddedType " + std::to_string(url.embeddedType) + "\n";
+        sourcesList += "- " + url.url + " with embeddedType " + std::to_string(url.embeddedType) +
+                       feedHealthAsString(url.url) + "\n";
       }
     }
     return sourcesList.empty() ? "No RSS sources available for this channel." : sourcesList;
   }
 
+  std::string RssManager::feedHealthAsString(const std::string &url) const {
+    auto it = feedStates_.find(url);
+    if (it == feedStates_.end() || it->second.consecutiveFailures == 0) {
+      return "";
+    }
+    const RSSFeedState &state = it->second;
+    std::string health = " [";
+    if (state.oversized) {
+      health += "Oversized, ";
+    }
+    const auto now = FeedScheduler::Clock::now();
+    if (scheduler_.isSuspended(state, now)) {
+      const auto minutes = (state.retryAt - FeedScheduler::Clock::to_time_t(now) + 59) / 60;
+      health += "Suspended, retry in " + std::to_string(minutes) + " min";
+    } else {
+      health += "Failing";
+    }
+    health += " after " + std::to_string(state.consecutiveFailures) + " failures";
+    if (!state.lastError.empty()) {
+      health += ": " + state.lastError;
+    }
+    return health + "]";
+  }
+
   bool RssManager::loadUrls() {
     std::ifstream file(urlsPath_);
     if (!file.is_open()) {
@@ -199,7 +825,20 @@ namespace dotnamebot::rss {
         if (item.contains("label") && item["label"].is_string()) {
           label = item["label"].get<std::string>();
         }
-        urls_.emplace_back(url, embedded, discordChannelId, label);
+        RSSUrl &rssUrl = urls_.emplace_back(url, embedded, discordChannelId, label);
+        if (item.contains("minPollSeconds") && item["minPollSeconds"].is_number_integer()) {
+          rssUrl.minPollSeconds = item["minPollSeconds"].get<long>();
+        }
+        if (item.contains("maxPollSeconds") && item["maxPollSeconds"].is_number_integer()) {
+          rssUrl.maxPollSeconds = item["maxPollSeconds"].get<long>();
+        }
+        if (item.contains("maxBytes") && item["maxBytes"].is_number_unsigned()) {
+          rssUrl.maxBytes = item["maxBytes"].get<size_t>();
+        }
+        if (item.contains("stopAfterSeenItems") &&
+            item["stopAfterSeenItems"].is_number_unsigned()) {
+          rssUrl.stopAfterSeenItems = item["stopAfterSeenItems"].get<size_t>();
+        }
       } else if (item.is_string()) {
         // Backwards compatibility - treat strings as non-embedded
         urls_.emplace_back(item.get<std::string>(), 0);
@@ -221,461 +860,335 @@ namespace dotnamebot::rss {
       file >> jsonData;
     } catch (const std::exception &e) {
       logger_->errorStream() << "Hashes file corrupted: " << e.what() << ". Creating new file.";
-      // std::endl;
+      seenIndex_.open(indexPath_);
       seenHashes_.clear();
-      std::ofstream outFile(hashesPath_);
-      if (!outFile.is_open()) {
-        return false;
-      }
-      outFile << nlohmann::json::array().dump(4);
-      return true;
+      legacySeenHashes_.clear();
+      legacyPendingFeeds_.clear();
+      migratingLegacyHashes_ = false;
+      // What was posted since the index was last written is still known
+      journal_.replay(seenHashes_);
+      return saveAllSeenHashes();
+    }
+
+    // {"version": 3, "indexed": n, "legacy": [decimal...]}, the fingerprints themselves being
+    // in seenHashes.index. Version 2 listed them as "fingerprints": [hex...], and a plain
+    // array is the file from before fingerprints and holds only std::hash values in decimal.
+    const bool isLegacyFile = jsonData.is_array();
+    const nlohmann::json empty = nlohmann::json::array();
+    const nlohmann::json &fingerprints =
+        isLegacyFile || !jsonData.contains("fingerprints") ? empty : jsonData["fingerprints"];
+    const nlohmann::json &legacy = isLegacyFile                   ? jsonData
+                                   : jsonData.contains("legacy") ? jsonData["legacy"]
+                                                                  : empty;
+
+    // Mapping the index costs the same however many items were ever seen
+    if (!seenIndex_.open(indexPath_) && jsonData.is_object() &&
+        jsonData.value("indexed", uint64_t{0}) > 0) {
+      logger_->errorStream() << "Seen hashes index " << indexPath_ << " is missing or damaged; "
+                             << jsonData["indexed"] << " seen items are forgotten.";
     }
+    seenIndexDay_ = jsonData.is_object() ? jsonData.value("written", SeenDay{0}) : 0;
+    seenRefreshes_.clear();
 
     seenHashes_.clear();
-    for (const auto &hash : jsonData) {
-      if (hash.is_string()) {
-        seenHashes_.insert(hash.get<std::string>());
+    seenHashes_.reserve(fingerprints.size());
+    for (const auto &hash : fingerprints) {
+      uint64_t fingerprint = 0;
+      if (hash.is_string() &&
+          fingerprintFromHex(hash.get_ref<const std::string &>(), fingerprint)) {
+        seenHashes_.insert(fingerprint);
+      }
+    }
+    const bool importFingerprints = !seenHashes_.empty();
+    legacySeenHashes_.clear();
+    for (const auto &hash : legacy) {
+      uint64_t value = 0;
+      if (!hash.is_string()) {
+        continue;
+      }
+      const std::string &text = hash.get_ref<const std::string &>();
+      const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+      if (ec == std::errc() && ptr == text.data() + text.size()) {
+        legacySeenHashes_.insert(value);
       }
     }
 
-    logger_->infoStream() << "Loaded " << seenHashes_.size() << " seen hashes.";
+    // Every feed has to be parsed once before the unmatched legacy hashes can go
+    legacyPendingFeeds_.clear();
+    if (!legacySeenHashes_.empty()) {
+      for (const auto &rssUrl : urls_) {
+        legacyPendingFeeds_.insert(rssUrl.url);
+      }
+    }
+    if (legacyPendingFeeds_.empty()) {
+      legacySeenHashes_.clear();
+    }
+    migratingLegacyHashes_ = !legacySeenHashes_.empty();
+    // Items marked as seen after the index was written
+    const size_t journaled = journal_.replay(seenHashes_);
+
+    logger_->infoStream() << "Loaded " << seenIndex_.size() + seenHashes_.size()
+                          << " seen hashes (" << journaled << " from the journal)"
+                          << (legacySeenHashes_.empty()
+                                  ? std::string(".")
+                                  : ", migrating " + std::to_string(legacySeenHashes_.size()) +
+                                        " pre-fingerprint ones.");
+    if (migratingLegacyHashes_) {
+      // They were taken of text decoded with only the five XML entity names
+      logger_->warningStream() << "Items with named HTML entities other than &lt; &gt; &amp; "
+                                  "&quot; &apos; may be posted once more.";
+    }
+    // Hashes listed in the JSON file go into the index once, so later starts skip them
+    if (importFingerprints || !seenIndex_.isOpen()) {
+      return saveAllSeenHashes();
+    }
     return true;
   }
 
-  bool RssManager::saveSeenHash(const std::string &hash) {
-    seenHashes_.insert(hash);
-
-    nlohmann::json jsonData = nlohmann::json::array();
-    for (const auto &h : seenHashes_) {
-      jsonData.push_back(h);
+  bool RssManager::saveSeenHash(uint64_t hash) {
+    if (seenIndex_.contains(hash) || !seenHashes_.insert(hash).second) {
+      return true;
     }
-
-    std::ofstream file(hashesPath_);
-    if (!file.is_open()) {
-      return false;
+    // Fold the delta into a new index now and then, so it and the replay on start stay short
+    if (seenHashes_.size() >= MAX_SEEN_DELTA) {
+      return saveAllSeenHashes();
     }
-    file << jsonData.dump(4);
-    return true;
+    return journal_.append(hash) || saveAllSeenHashes();
   }
 
-  std::string RssManager::downloadFeed(const std::string &url) {
-    std::string buffer;
-    try {
-      CURL *curl = curl_easy_init();
-      if (curl == nullptr) {
-        return "";
+  void RssManager::refreshSeenItems(const std::vector<uint64_t> &hashes) {
+    const SeenDay today = currentDay();
+    for (const uint64_t hash : hashes) {
+      // The delta goes into the index with the day it is written on anyway
+      if (seenHashes_.contains(hash)) {
+        continue;
       }
-
-      // Set HTTP headers
-      struct curl_slist *headers = nullptr;
-      headers =
-          curl_slist_append(headers, "Accept: application/rss+xml, application/xml, text/xml");
-      headers = curl_slist_append(headers, "Cache-Control: no-cache");
-      curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-      curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-      curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, RssManager::WriteCallback);
-      curl_easy_setopt(curl, CURLOPT_WRITEDATA, &buffer);
-      curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-      curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
-      curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
-
-      curl_easy_setopt(
-          curl, CURLOPT_USERAGENT,
-          "DotNameBot RSS Reader by DotName: https://github.com/tomasmark79/DotNameBot");
-
-      curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);
-      curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
-      curl_easy_setopt(curl, CURLOPT_ENCODING, "");
-
-      CURLcode res = curl_easy_perform(curl);
-
-      curl_slist_free_all(headers);
-      curl_easy_cleanup(curl);
-
-      if (res != CURLE_OK) {
-        logger_->errorStream() << "CURL error for URL '" << url << "': " << curl_easy_strerror(res);
-        return "";
+      if (const std::optional<SeenDay> lastSeen = seenIndex_.lastSeen(hash);
+          lastSeen && *lastSeen < today) {
+        seenRefreshes_[hash] = today;
       }
-    } catch (const std::exception &e) {
-      logger_->errorStream() << "Exception during CURL operation: " << e.what();
-      return "";
     }
-
-    return buffer;
   }
 
-  // TODO: Improve parsing robustness and support more RSS/Atom variants
-  RSSFeed RssManager::parseRSS(const std::string &xmlData, long embeddedType,
-                               uint64_t discordChannelId, int &totalDuplicateItems) {
-    RSSFeed feed;
-    tinyxml2::XMLDocument doc;
-    doc.Parse(xmlData.c_str());
-
-    tinyxml2::XMLElement *channel = nullptr;
-    tinyxml2::XMLElement *firstItem = nullptr;
-    bool isAtom = false;
-
-    // Try RSS 2.0 format
-    if (auto *rssElement = doc.FirstChildElement("rss")) {
-      channel = rssElement->FirstChildElement("channel");
-      if (channel != nullptr) {
-        firstItem = channel->FirstChildElement("item");
-      }
+  bool RssManager::isSeen(const RSSItem &item) {
+    if (seenHashes_.contains(item.hash) || seenIndex_.contains(item.hash)) {
+      return true;
     }
-    // Try RSS 1.0 format
-    else if (auto *rdfElement = doc.FirstChildElement("rdf:RDF")) {
-      channel = rdfElement->FirstChildElement("channel");
-      firstItem = rdfElement->FirstChildElement("item");
+    if (legacySeenHashes_.empty() || legacySeenHashes_.erase(item.legacyHash) == 0) {
+      return false;
     }
-    // Try Atom format
-    else if (auto *feedElement = doc.FirstChildElement("feed")) {
-      channel = feedElement;
-      firstItem = feedElement->FirstChildElement("entry");
-      isAtom = true;
+    seenHashes_.insert(item.hash);
+    return true;
+  }
+
+  void RssManager::advanceLegacyMigration(const std::string &url) {
+    legacyPendingFeeds_.erase(url);
+    // Feeds removed from the list meanwhile will not be parsed any more
+    std::erase_if(legacyPendingFeeds_, [this](const std::string &pending) {
+      return std::none_of(urls_.begin(), urls_.end(),
+                          [&pending](const RSSUrl &rssUrl) { return rssUrl.url == pending; });
+    });
+    if (!legacyPendingFeeds_.empty()) {
+      return;
     }
+    logger_->infoStream() << "Seen hashes migrated to item fingerprints; dropping "
+                          << legacySeenHashes_.size() << " old hashes no feed lists any more.";
+    legacySeenHashes_.clear();
+    migratingLegacyHashes_ = false;
+    saveAllSeenHashes();
+  }
 
-    if (channel == nullptr) {
-      logger_->errorStream() << "No valid RSS/Atom channel found.";
+  // TODO: Improve parsing robustness and support more RSS/Atom variants
+  RSSFeed RssManager::parseRSS(std::string_view xmlData, long embeddedType,
+                               uint64_t discordChannelId, int &totalDuplicateItems,
+                               KnownItemsCutoff *cutoff) {
+    RSSFeed feed;
+    std::string error;
+    if (!readFeed(xmlData, embeddedType, discordChannelId, feed, error, cutoff)) {
+      logger_->errorStream() << error;
       return feed;
     }
-
-    // Parse Feed Header
-    if (isAtom) {
-      // Atom
-      if (auto *titleEl = channel->FirstChildElement("title")) {
-        feed.headTitle = (titleEl->GetText() != nullptr) ? titleEl->GetText() : "";
-      }
-      if (auto *subtitleEl = channel->FirstChildElement("subtitle")) {
-        feed.headDescription = (subtitleEl->GetText() != nullptr) ? subtitleEl->GetText() : "";
-      }
-      if (auto *linkEl = channel->FirstChildElement("link")) {
-        const char *href = linkEl->Attribute("href");
-        feed.headLink = (href != nullptr) ? href : "";
-      }
-    } else {
-      // Rss
-      if (auto *titleEl = channel->FirstChildElement("title")) {
-        feed.headTitle = (titleEl->GetText() != nullptr) ? titleEl->GetText() : "";
-      }
-      if (auto *descEl = channel->FirstChildElement("description")) {
-        feed.headDescription = (descEl->GetText() != nullptr) ? descEl->GetText() : "";
-      }
-      if (auto *linkEl = channel->FirstChildElement("link")) {
-        feed.headLink = (linkEl->GetText() != nullptr) ? linkEl->GetText() : "";
+    // Skip if already seen
+    std::erase_if(feed.items, [&](const RSSItem &rssItem) {
+      if (!isSeen(rssItem)) {
+        return false;
       }
-    }
-
-    // Parse Feed Items
-    [[maybe_unused]]
-    int newItems = 0;
-    const char *itemTag = isAtom ? "entry" : "item";
+      totalDuplicateItems++;
+      return true;
+    });
+    return feed;
+  }
 
-    for (auto *item = firstItem; item != nullptr; item = item->NextSiblingElement(itemTag)) {
-      RSSItem rssItem;
-      // rssItem.embedded = embedded;
+  bool RssManager::readFeed(std::string_view xmlData, long embeddedType, uint64_t discordChannelId,
+                            RSSFeed &feed, std::string &error, KnownItemsCutoff *cutoff,
+                            FeedFormat format) const {
+    feed = RSSFeed{};
+    std::vector<RSSItem> items;
+    // Items are hashed as they are read, so the cutoff can end the parse at known items
+    const bool legacyHash = migratingLegacyHashes_;
+    auto onItem = [&](RSSItem &&rssItem) {
       rssItem.embeddedType = static_cast<EmbeddedType>(embeddedType);
       rssItem.discordChannelId = discordChannelId;
+      if (!prepareItem(rssItem, feed, legacyHash)) {
+        return true;
+      }
+      feed.truncated = cutoff != nullptr && cutoff->reached(rssItem.hash);
+      items.push_back(std::move(rssItem));
+      return !feed.truncated;
+    };
+    // Items are only kept once the whole document turned out to be well-formed
+    if (!readFeedDocument(xmlData, feed, onItem, error, format)) {
+      feed = RSSFeed{};
+      return false;
+    }
 
-      if (isAtom) {
-        // Atom
-        if (auto *titleEl = item->FirstChildElement("title")) {
-          const char *text = titleEl->GetText();
-          if (text != nullptr) {
-            rssItem.title = text;
-          } else {
-            // Fallback: get text from child node (handles CDATA)
-            auto *textNode = titleEl->FirstChild();
-            if ((textNode != nullptr) && (textNode->ToText() != nullptr)) {
-              rssItem.title = (textNode->Value() != nullptr) ? textNode->Value() : "";
-            }
-          }
-          // Strip any residual HTML tags from title (e.g. type="html")
-          std::regex htmlTagRegexTitle("<[^>]*>");
-          rssItem.title = std::regex_replace(rssItem.title, htmlTagRegexTitle, "");
-          rssItem.title = decodeHtmlEntities(rssItem.title);
-        }
-        // Prefer link with rel="alternate"; fall back to first link with href
-        {
-          const tinyxml2::XMLElement *chosenLinkEl = nullptr;
-          for (auto *linkEl = item->FirstChildElement("link"); linkEl != nullptr;
-               linkEl = linkEl->NextSiblingElement("link")) {
-            const char *rel = linkEl->Attribute("rel");
-            if (rel != nullptr && std::string(rel) == "alternate") {
-              chosenLinkEl = linkEl;
-              break;
-            }
-            if (chosenLinkEl == nullptr && linkEl->Attribute("href") != nullptr) {
-              chosenLinkEl = linkEl; // first link with href as fallback
-            }
-          }
-          if (chosenLinkEl != nullptr) {
-            const char *href = chosenLinkEl->Attribute("href");
-            rssItem.url = (href != nullptr) ? href : "";
-          }
-        }
-        // Parse summary or content, strip HTML tags and extract image
-        // Helper lambda to get raw text of an XML element (handles CDATA)
-        auto getRawText = [](const tinyxml2::XMLElement *el) -> std::string {
-          if (el == nullptr) {
-            return {};
-          }
-          const char *text = el->GetText();
-          if (text != nullptr) {
-            return text;
-          }
-          const auto *textNode = el->FirstChild();
-          if ((textNode != nullptr) && (textNode->ToText() != nullptr) &&
-              (textNode->Value() != nullptr)) {
-            return textNode->Value();
-          }
-          return {};
-        };
-
-        {
-          // Use <summary> for description text; fall back to <content> if missing
-          const tinyxml2::XMLElement *descEl = item->FirstChildElement("summary");
-          const tinyxml2::XMLElement *contentEl = item->FirstChildElement("content");
-          if (descEl == nullptr) {
-            descEl = contentEl;
-          }
-
-          if (descEl != nullptr) {
-            std::string descValue = getRawText(descEl);
-
-            if (!descValue.empty()) {
-              // Decode HTML entities first
-              descValue = decodeHtmlEntities(descValue);
-
-              // Extract image if present
-              std::smatch imgMatch;
-              std::regex imgRegex(R"(<img[^>]+src=["']([^"']+)["'][^>]*>)");
-              if (std::regex_search(descValue, imgMatch, imgRegex) && imgMatch.size() > 1) {
-                rssItem.rssMedia.url = imgMatch[1].str();
-                rssItem.rssMedia.type = "image/";
-              }
-
-              // Remove all HTML tags
-              std::regex htmlTagRegex("<[^>]*>");
-              descValue = std::regex_replace(descValue, htmlTagRegex, "");
-
-              // Trim whitespace
-              descValue.erase(0, descValue.find_first_not_of(" \t\n\r"));
-              if (!descValue.empty()) {
-                descValue.erase(descValue.find_last_not_of(" \t\n\r") + 1);
-              }
-
-              rssItem.description = descValue;
-            }
-          }
-
-          // If no image found yet, also scan <content> (e.g. when description came from <summary>)
-          if (rssItem.rssMedia.url.empty() && contentEl != nullptr && contentEl != descEl) {
-            std::string contentValue = getRawText(contentEl);
-            if (!contentValue.empty()) {
-              contentValue = decodeHtmlEntities(contentValue);
-              std::smatch imgMatch;
-              std::regex imgRegex(R"(<img[^>]+src=["']([^"']+)["'][^>]*>)");
-              if (std::regex_search(contentValue, imgMatch, imgRegex) && imgMatch.size() > 1) {
-                rssItem.rssMedia.url = imgMatch[1].str();
-                rssItem.rssMedia.type = "image/";
-              }
-            }
-          }
-        }
-
-        // <image>
-        // <title>iSport.cz</title>
-        // <url>https://picture.png</url>
-        // <link>https://isport.blesk.cz</link>
-        // </image>
-
-        if (auto *imageEl = item->FirstChildElement("image")) {
-          if (auto *imgUrlEl = imageEl->FirstChildElement("url")) {
-            rssItem.rssMedia.url = (imgUrlEl->GetText() != nullptr) ? imgUrlEl->GetText() : "";
-          }
-          // Type is not usually provided in Atom <image>, set as empty
-          rssItem.rssMedia.type = "";
-        }
-
-        if (auto *updatedEl = item->FirstChildElement("updated")) {
-          rssItem.pubDate = (updatedEl->GetText() != nullptr) ? updatedEl->GetText() : "";
-        } else if (auto *publishedEl = item->FirstChildElement("published")) {
-          rssItem.pubDate = (publishedEl->GetText() != nullptr) ? publishedEl->GetText() : "";
-        }
-
-      } else {
-        // Rss
-        if (auto *titleEl = item->FirstChildElement("title")) {
-          // Handle CDATA sections properly by getting all text content
-          const char *text = titleEl->GetText();
-          if (text != nullptr) {
-            rssItem.title = text;
-          } else {
-            // If GetText() returns null, try to get text from child nodes (including CDATA)
-            auto *textNode = titleEl->FirstChild();
-            if ((textNode != nullptr) && (textNode->ToText() != nullptr)) {
-              rssItem.title = (textNode->Value() != nullptr) ? textNode->Value() : "";
-            }
-          }
-          std::regex htmlTagRegexTitle("<[^>]*>");
-          rssItem.title = std::regex_replace(rssItem.title, htmlTagRegexTitle, "");
-          rssItem.title = decodeHtmlEntities(rssItem.title);
-        }
-        if (auto *linkEl = item->FirstChildElement("link")) {
-          rssItem.url = (linkEl->GetText() != nullptr) ? linkEl->GetText() : "";
-        }
-
-        if (auto *descEl = item->FirstChildElement("description")) {
-          auto *textNode = descEl->FirstChild();
-          if (textNode != nullptr && textNode->Value() != nullptr) {
-            std::string descValue = textNode->Value();
-
-            // Decode HTML entities first
-            descValue = decodeHtmlEntities(descValue);
-
-            // Now extract CDATA content if present
-            std::regex cdataRegex(R"(<!\[CDATA\[(.*?)\]\]>)");
-            std::smatch cdataMatch;
-            if (std::regex_search(descValue, cdataMatch, cdataRegex) && cdataMatch.size() > 1) {
-              descValue = cdataMatch[1].str();
-            }
-
-            // Extract image if present
-            std::smatch imgMatch;
-            std::regex imgRegex(R"(<img[^>]+src=["']([^"']+)["'][^>]*>)");
-            if (std::regex_search(descValue, imgMatch, imgRegex) && imgMatch.size() > 1) {
-              rssItem.rssMedia.url = imgMatch[1].str();
-              rssItem.rssMedia.type = "image/";
-            }
-
-            // Remove all HTML tags
-            std::regex htmlTagRegex("<[^>]*>");
-            std::string cleanDesc = std::regex_replace(descValue, htmlTagRegex, "");
-
-            // Trim whitespace
-            cleanDesc.erase(0, cleanDesc.find_first_not_of(" \t\n\r"));
-            cleanDesc.erase(cleanDesc.find_last_not_of(" \t\n\r") + 1);
-
-            rssItem.description = cleanDesc;
-          }
-        }
-
-        // <media:content
-        // url="https://picture.jpg"
-        // type="image/jpeg"/>
-
-        // <media:content
-        // url="https://picture.png"
-        // medium="image"/>
-
-        if (auto *mediaContentEl = item->FirstChildElement("media:content")) {
-          const char *mediaUrl = mediaContentEl->Attribute("url");
-          rssItem.rssMedia.url = (mediaUrl != nullptr) ? mediaUrl : "";
-
-          const char *mediaType = mediaContentEl->Attribute("type");
-          rssItem.rssMedia.type = (mediaType != nullptr) ? mediaType : "";
-          if (rssItem.rssMedia.type.empty()) {
-            const char *mediaMedium = mediaContentEl->Attribute("medium");
-            if (mediaMedium != nullptr && std::string(mediaMedium) == "image") {
-              rssItem.rssMedia.type = "image/";
-            }
-          }
-        }
-
-        // <enclosure url="https://picture.jpg" length="78026"
-        // type="image/jpeg"/>
-        if (auto *enclosureEl = item->FirstChildElement("enclosure")) {
-          const char *encUrl = enclosureEl->Attribute("url");
-          rssItem.rssMedia.url = (encUrl != nullptr) ? encUrl : "";
-          const char *encType = enclosureEl->Attribute("type");
-          rssItem.rssMedia.type = (encType != nullptr) ? encType : "";
-        }
+    feed.items = std::move(items);
+    return true;
+  }
 
-        if (auto *dateEl = item->FirstChildElement("pubDate")) {
-          rssItem.pubDate = (dateEl->GetText() != nullptr) ? dateEl->GetText() : "";
-        }
+  bool RssManager::prepareItem(RSSItem &rssItem, RSSFeed &feed, bool legacyHash) {
+    if (time_t published = parseFeedDate(rssItem.pubDate); published != 0) {
+      feed.publishTimes.push_back(published);
+    }
 
-        // <szn:image>
-        // <szn:url>https://picture.jpg</szn:url>
-        // </szn:image>
-        if (auto *sznImageEl = item->FirstChildElement("szn:image")) {
-          if (auto *sznUrlEl = sznImageEl->FirstChildElement("szn:url")) {
-            rssItem.rssMedia.url = (sznUrlEl->GetText() != nullptr) ? sznUrlEl->GetText() : "";
-          }
-          rssItem.rssMedia.type = "image/"; // Type is not usually provided, set as image
-        }
-      } // End RSS vs Atom parsing
+    if (rssItem.title.empty() || rssItem.url.empty()) {
+      return false;
+    }
 
-      if (rssItem.title.empty() || rssItem.url.empty()) {
-        continue;
-      };
+    rssItem.generateHash(); // Generate hash from original, unprocessed data
+    if (legacyHash) {
+      rssItem.generateLegacyHash();
+    }
+    feed.itemHashes.push_back(rssItem.hash);
+    if (!feed.arena) {
+      feed.arena = rssItem.arena;
+    }
 
-      rssItem.generateHash(); // Generate hash from original, unprocessed data
+    // Clean up description for display AFTER hash generation (both RSS and Atom):
+    // collapse whitespace runs to one space and trim. The text never grows, so it is
+    // rewritten where it lies in the arena.
+    rssItem.description = collapseWhitespace(ItemArena::edit(rssItem.description));
+    return true;
+  }
 
-      // Skip if already seen
-      if (seenHashes_.contains(rssItem.hash)) {
-        totalDuplicateItems++;
+  int RssManager::loadCachedFeeds() {
+    int restoredItems = 0;
+    size_t restoredFeeds = 0;
+    for (const auto &rssUrl : urls_) {
+      auto stateIt = feedStates_.find(rssUrl.url);
+      std::string body;
+      if (stateIt == feedStates_.end() || stateIt->second.bodyHash.empty() ||
+          !feedCache_.load(rssUrl.url, body)) {
         continue;
       }
-
-      // Clean up description for display AFTER hash generation (both RSS and Atom)
-      if (!rssItem.description.empty()) {
-        std::string &desc = rssItem.description;
-
-        // Replace multiple whitespace characters with single space
-        std::regex ws_re("\\s+");
-        desc = std::regex_replace(desc, ws_re, " ");
-
-        // Trim leading/trailing whitespace
-        desc = std::regex_replace(desc, std::regex("^\\s+|\\s+$"), "");
+      BodyHash hash;
+      hash.update(body);
+      if (hash.hex() != stateIt->second.bodyHash) {
+        logger_->debugStream() << "Cached body of '" << rssUrl.url << "' is stale, ignoring it.";
+        continue;
       }
-
-      feed.addItem(rssItem);
-      newItems++;
+      FeedPollResult poll;
+      restoredItems += ingestFeed(rssUrl, body, poll);
+      primedFeeds_.insert(rssUrl.url);
+      restoredFeeds++;
     }
-
-    return feed;
+    logger_->infoStream() << "Restored " << restoredItems << " items from " << restoredFeeds
+                          << " cached feeds.";
+    return restoredItems;
   }
 
-  int RssManager::fetchUrlSource(const std::string &url, long embeddedType,
-                                 uint64_t discordChannelId) {
-    std::string xmlData = downloadFeed(url);
-    if (xmlData.empty()) {
-      return -1;
+  int RssManager::ingestFeed(const RSSUrl &rssUrl, std::string_view xmlData,
+                              FeedPollResult &poll, KnownItemsCutoff *cutoff) {
+    std::string utf8;
+    RSSFeed newFeed;
+    std::string error;
+    if (!readFeed(convertToUtf8(xmlData, utf8), rssUrl.embeddedType, rssUrl.discordChannelId,
+                  newFeed, error, cutoff)) {
+      // The buffered items and known items of the feed stay as they are
+      logger_->errorStream() << "Failed to parse feed '" << rssUrl.url << "': " << error;
+      poll.fetched = false;
+      poll.error = error;
+      return 0;
     }
+    // Seen items are counted by mergeFeed
+    return mergeFeed(rssUrl, newFeed, 0, poll);
+  }
 
-    xmlData = convertToUtf8(xmlData);
+  int RssManager::mergeFeed(const RSSUrl &rssUrl, RSSFeed &newFeed, int totalDuplicateItems,
+                            FeedPollResult &poll) {
+    const std::string &url = rssUrl.url;
+    const long embeddedType = rssUrl.embeddedType;
+
+    // Resolve label for this feed source; the items share one copy in their arena
+    std::string_view feedLabel;
+    std::string_view feedUrl;
+    if (!newFeed.items.empty()) {
+      feedLabel = newFeed.arena->store(rssUrl.label.empty() ? extractDomain(url) : rssUrl.label);
+      feedUrl = newFeed.arena->store(url);
+    }
 
-    int totalDuplicateItems = 0;
-    RSSFeed newFeed = parseRSS(xmlData, embeddedType, discordChannelId, totalDuplicateItems);
+    poll.publishTimes = std::move(newFeed.publishTimes);
+    if (!newFeed.truncated) {
+      // A stopped parse may not have reached ttl / sy:update after the items
+      feedStates_[url].updateHintSeconds = newFeed.updateHintSeconds;
+    }
 
-    // Resolve label for this feed source
-    std::string feedLabel;
-    for (const auto &rssUrl : urls_) {
-      if (rssUrl.url == url) {
-        feedLabel = rssUrl.label.empty() ? extractDomain(url) : rssUrl.label;
-        break;
-      }
+    // Learn whether the feed lists newest items first and remember what it listed
+    KnownItems &known = knownItems_[url];
+    known.update(newFeed.itemHashes, poll.publishTimes, !newFeed.truncated);
+    // What the feed lists, also below where a stopped parse left off, stays in the history
+    if (!newFeed.itemHashes.empty()) {
+      refreshSeenItems(known.items());
     }
-    if (feedLabel.empty()) {
-      feedLabel = extractDomain(url);
+
+    // The fresh parse supersedes whatever this feed had in the buffer, except for items
+    // below the point where a stopped parse left off
+    std::unordered_set<uint64_t> parsedHashes;
+    if (newFeed.truncated) {
+      parsedHashes.insert(newFeed.itemHashes.begin(), newFeed.itemHashes.end());
     }
+    std::unordered_set<uint64_t> bufferedHashes;
+    std::erase_if(feed_.items, [&](const RSSItem &item) {
+      if (item.feedUrl != url) {
+        return false;
+      }
+      if (newFeed.truncated && !parsedHashes.contains(item.hash) && known.contains(item.hash)) {
+        return false;
+      }
+      bufferedHashes.insert(item.hash);
+      return true;
+    });
 
     int addedItems = 0;
-    for (auto item : newFeed.items) {
+    for (auto &item : newFeed.items) {
+      // Refreshed feeds are parsed without the lock and have not been checked yet
+      if (isSeen(item)) {
+        totalDuplicateItems++;
+        continue;
+      }
+      if (!bufferedHashes.contains(item.hash)) {
+        poll.newItems++;
+      }
       item.feedLabel = feedLabel;
-      feed_.addItem(item);
+      item.feedUrl = feedUrl;
+      feed_.addItem(std::move(item));
       addedItems++;
     }
+    // A feed that lists no items has not shown which of the migrated hashes it still lists
+    if (!legacyPendingFeeds_.empty() && !newFeed.itemHashes.empty()) {
+      advanceLegacyMigration(url);
+    }
 
     logger_->infoStream() << "New " << addedItems << " items added to the feed buffer."
-                          << " Found " << totalDuplicateItems << " seen items."
+                          << " Found " << totalDuplicateItems << " seen items"
+                          << (newFeed.truncated ? ", stopped at known items." : ".")
                           << " url: " << url << " (embeddedType: " << embeddedType << ")"
                           << " (Buffer size: " << feed_.items.size() << ")";
     return addedItems;
   }
 
   RSSItem RssManager::getRandomItem() {
+    std::lock_guard<std::mutex> lock(mutex_);
     if (feed_.items.empty()) {
       return RSSItem{};
     }
@@ -695,17 +1208,85 @@ namespace dotnamebot::rss {
   }
 
   bool RssManager::saveAllSeenHashes() {
-    nlohmann::json jsonData = nlohmann::json::array();
-    for (const auto &h : seenHashes_) {
-      jsonData.push_back(h);
+    // The index is only rewritten when there is something to fold in, and once a day for the
+    // last-seen days; rewriting takes time proportional to the history, which the journal
+    // spreads over MAX_SEEN_DELTA posts
+    const SeenDay today = currentDay();
+    if (!seenHashes_.empty() || !seenRefreshes_.empty() || !seenIndex_.isOpen() ||
+        seenIndexDay_ != today) {
+      std::vector<SeenEntry> entries;
+      entries.reserve(seenIndex_.size() + seenHashes_.size());
+      seenIndex_.collect(entries);
+      for (SeenEntry &entry : entries) {
+        if (const auto refreshed = seenRefreshes_.find(entry.fingerprint);
+            refreshed != seenRefreshes_.end()) {
+          entry.lastSeen = refreshed->second;
+        } else if (entry.lastSeen == 0) {
+          // Indexed before last-seen days were kept: the history window starts now
+          entry.lastSeen = today;
+        }
+      }
+      const long keepDays = options_.seenHistoryDays;
+      const SeenDay oldest =
+          keepDays > 0 && today > keepDays ? static_cast<SeenDay>(today - keepDays) : 0;
+      const size_t evicted = std::erase_if(
+          entries, [oldest](const SeenEntry &entry) { return entry.lastSeen < oldest; });
+      for (const uint64_t hash : seenHashes_) {
+        entries.push_back({hash, today});
+      }
+
+      const double falsePositiveRate = entries.size() >= MIN_FILTERED_HISTORY
+                                           ? options_.seenFilterFalsePositiveRate
+                                           : 0.0;
+      if (!SeenHashIndex::write(indexPath_, entries, falsePositiveRate)) {
+        return false;
+      }
+      if (!seenIndex_.open(indexPath_)) {
+        logger_->errorStream() << "Failed to map the seen hashes index " << indexPath_;
+        return false;
+      }
+      seenHashes_.clear();
+      seenRefreshes_.clear();
+      seenIndexDay_ = today;
+      if (evicted > 0) {
+        logger_->infoStream() << "Dropped " << evicted << " seen hashes no feed has listed for "
+                              << keepDays << " days.";
+      }
     }
 
-    std::ofstream file(hashesPath_);
-    if (!file.is_open()) {
+    nlohmann::json jsonData = {{"version", SEEN_HASHES_VERSION},
+                               {"indexed", seenIndex_.size()},
+                               {"written", seenIndexDay_}};
+    if (!legacySeenHashes_.empty()) {
+      nlohmann::json legacy = nlohmann::json::array();
+      for (const uint64_t hash : legacySeenHashes_) {
+        legacy.push_back(std::to_string(hash));
+      }
+      jsonData["legacy"] = std::move(legacy);
+    }
+
+    // Write next to the JSON file and rename, so a crash leaves either the old or the new one;
+    // the journal is only emptied once the new index holds its entries
+    std::filesystem::path temporary = hashesPath_;
+    temporary += ".tmp";
+    {
+      std::ofstream file(temporary, std::ios::trunc);
+      if (!file.is_open()) {
+        return false;
+      }
+      file << jsonData.dump(4);
+      if (!file) {
+        return false;
+      }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporary, hashesPath_, ec);
+    if (ec) {
       return false;
     }
-    file << jsonData.dump(4);
-    return true;
+    // Our own write is not a change to reload
+    hashesLastModified_ = std::filesystem::last_write_time(hashesPath_, ec);
+    return journal_.clear();
   }
 
   bool RssManager::hasFileChanged(const std::filesystem::path &path,
@@ -738,12 +1319,13 @@ namespace dotnamebot::rss {
     return (urlsChanged || hashesChanged);
   }
 
-  size_t RssManager::WriteCallback(void *contents, size_t size, size_t nmemb, void *userp) {
-    ((std::string *)userp)->append((char *)contents, size * nmemb);
-    return size * nmemb;
+  size_t RssManager::getItemCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return feed_.items.size();
   }
 
   bool RssManager::generateHtmlFeed() {
+    std::lock_guard<std::mutex> lock(mutex_);
     const auto outputPath = assetManager_->getAssetsPath() / "feeder.html";
 
     if (!HtmlFeedWriter::write(feed_.items, outputPath)) {
@@ -759,159 +1341,41 @@ namespace dotnamebot::rss {
   std::string RssManager::getItemAsMarkdown(const RSSItem &item) { return item.toMarkdownLink(); }
   void RssManager::clearFeedBuffer() { feed_.clear(); }
 
-  std::string RssManager::convertToUtf8(const std::string &xmlData) const {
-    // Extract encoding from XML declaration, e.g. <?xml version="1.0" encoding="windows-1250" ?>
-    std::regex encodingRegex(R"(encoding\s*=\s*["']([^"']+)["'])", std::regex::icase);
-    std::smatch match;
-    if (!std::regex_search(xmlData, match, encodingRegex)) {
-      return xmlData; // No encoding declaration — assume UTF-8
-    }
-
-    std::string declaredEncoding = match[1].str();
-
-    // Normalise to upper-case for comparison
-    std::string upperEncoding = declaredEncoding;
-    std::transform(upperEncoding.begin(), upperEncoding.end(), upperEncoding.begin(), ::toupper);
-
-    if (upperEncoding == "UTF-8" || upperEncoding == "UTF8" || upperEncoding == "US-ASCII" ||
-        upperEncoding == "ASCII") {
-      return xmlData; // Already UTF-8 compatible, nothing to do
+  std::string_view RssManager::convertToUtf8(std::string_view xmlData,
+                                             std::string &buffer) const {
+    // Only the BOM and the XML declaration are looked at,
+    // e.g. <?xml version="1.0" encoding="windows-1250" ?>
+    const XmlProlog prolog = scanXmlProlog(xmlData);
+    if (isUtf8Compatible(prolog.encoding)) {
+      return xmlData; // Undeclared or already UTF-8 compatible, nothing to do
     }
 
-    // Use iconv to transcode to UTF-8
-    iconv_t cd = iconv_open("UTF-8", declaredEncoding.c_str());
-    if (cd == (iconv_t)-1) {
+    const iconv_t converter = cachedUtf8Converter(prolog.encoding);
+    if (converter == reinterpret_cast<iconv_t>(-1)) {
       logger_->warningStream() << "convertToUtf8: iconv_open failed for encoding '"
-                               << declaredEncoding << "' — returning raw data";
+                               << prolog.encoding << "' — returning raw data";
       return xmlData;
     }
 
-    // Allocate output buffer (UTF-8 is at most 4 bytes per character)
-    std::string output(xmlData.size() * 4, '\0');
-    const char *inPtr = xmlData.data();
-    size_t inLeft = xmlData.size();
-    char *outPtr = output.data();
-    size_t outLeft = output.size();
-
-    size_t rc = iconv(cd, const_cast<char **>(&inPtr), &inLeft, &outPtr, &outLeft);
-    iconv_close(cd);
-
-    if (rc == (size_t)-1) {
+    // The declaration is ASCII: copy it up to the encoding name, declare UTF-8 instead so
+    // the XML reader treats the data as such, and transcode only what follows the name
+    const size_t nameEnd = prolog.encodingAt + prolog.encoding.size();
+    buffer.clear();
+    buffer.append(xmlData.substr(prolog.bomSize, prolog.encodingAt - prolog.bomSize));
+    buffer.append("UTF-8");
+    if (!appendAsUtf8(converter, xmlData.substr(nameEnd), buffer)) {
       logger_->warningStream() << "convertToUtf8: iconv conversion failed for encoding '"
-                               << declaredEncoding << "' — returning raw data";
+                               << prolog.encoding << "' — returning raw data";
       return xmlData;
     }
 
-    output.resize(output.size() - outLeft);
-
-    // Update the encoding declaration so tinyxml2 treats the data as UTF-8
-    std::regex replaceEncoding(R"(encoding\s*=\s*["'][^"']+["'])", std::regex::icase);
-    output = std::regex_replace(output, replaceEncoding, "encoding=\"UTF-8\"");
-
-    logger_->infoStream() << "convertToUtf8: transcoded from '" << declaredEncoding << "' to UTF-8";
-    return output;
-  }
-
-  // Helper function to convert Unicode code point to UTF-8 bytes
-  static std::string codePointToUtf8(uint32_t codePoint) {
-    std::string utf8;
-    if (codePoint <= 0x7F) {
-      // 1 byte (ASCII)
-      utf8 += static_cast<char>(codePoint);
-    } else if (codePoint <= 0x7FF) {
-      // 2 bytes
-      utf8 += static_cast<char>(0xC0 | (codePoint >> 6));
-      utf8 += static_cast<char>(0x80 | (codePoint & 0x3F));
-    } else if (codePoint <= 0xFFFF) {
-      // 3 bytes
-      utf8 += static_cast<char>(0xE0 | (codePoint >> 12));
-      utf8 += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
-      utf8 += static_cast<char>(0x80 | (codePoint & 0x3F));
-    } else if (codePoint <= 0x10FFFF) {
-      // 4 bytes
-      utf8 += static_cast<char>(0xF0 | (codePoint >> 18));
-      utf8 += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
-      utf8 += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
-      utf8 += static_cast<char>(0x80 | (codePoint & 0x3F));
-    }
-    return utf8;
+    logger_->infoStream() << "convertToUtf8: transcoded from '" << prolog.encoding
+                          << "' to UTF-8";
+    return buffer;
   }
 
   std::string RssManager::decodeHtmlEntities(const std::string &str) {
-    std::string result = str;
-
-    // Some feeds nest entities (for example &amp;#353;), so decode until stable.
-    bool changed = false;
-    do {
-      changed = false;
-
-      // Decode numeric character references: &#353; (decimal) and &#x0161; (hexadecimal)
-      std::regex numericEntityRegex(R"(&#(?:([0-9]+)|[xX]([0-9a-fA-F]+));)");
-      std::smatch match;
-      std::string::const_iterator searchStart(result.cbegin());
-      std::string decodedResult;
-
-      while (std::regex_search(searchStart, result.cend(), match, numericEntityRegex)) {
-        changed = true;
-
-        // Append text before the match
-        decodedResult.append(match.prefix().first, match.prefix().second);
-
-        uint32_t codePoint = 0;
-        if (match[1].matched) {
-          // Decimal entity: &#353;
-          codePoint = static_cast<uint32_t>(std::stoul(match[1].str()));
-        } else if (match[2].matched) {
-          // Hexadecimal entity: &#x0161;
-          codePoint = static_cast<uint32_t>(std::stoul(match[2].str(), nullptr, 16));
-        }
-
-        // Convert to UTF-8 and append
-        if (codePoint <= 0x10FFFF) {
-          decodedResult += codePointToUtf8(codePoint);
-        }
-
-        searchStart = match.suffix().first;
-      }
-
-      if (changed) {
-        decodedResult.append(searchStart, result.cend());
-        result = decodedResult;
-      }
-
-      size_t pos = 0;
-      while ((pos = result.find("&lt;", pos)) != std::string::npos) {
-        result.replace(pos, 4, "<");
-        pos += 1;
-        changed = true;
-      }
-      pos = 0;
-      while ((pos = result.find("&gt;", pos)) != std::string::npos) {
-        result.replace(pos, 4, ">");
-        pos += 1;
-        changed = true;
-      }
-      pos = 0;
-      while ((pos = result.find("&amp;", pos)) != std::string::npos) {
-        result.replace(pos, 5, "&");
-        pos += 1;
-        changed = true;
-      }
-      pos = 0;
-      while ((pos = result.find("&quot;", pos)) != std::string::npos) {
-        result.replace(pos, 6, "\"");
-        pos += 1;
-        changed = true;
-      }
-      pos = 0;
-      while ((pos = result.find("&apos;", pos)) != std::string::npos) {
-        result.replace(pos, 6, "'");
-        pos += 1;
-        changed = true;
-      }
-    } while (changed);
-
-    return result;
+    return rss::decodeHtmlEntities(str);
   }
 
 } // namespace dotnamebot::rss
\ No newline at end of file
@@ -1,20 +1,37 @@
 #pragma once
 
+#include <Http/IHttpClient.hpp>
+#include <Rss/FeedCache.hpp>
+#include <Rss/FeedFetcher.hpp>
+#include <Rss/FeedFormat.hpp>
+#include <Rss/FeedScheduler.hpp>
 #include <Rss/HtmlFeedWriter.hpp>
 #include <Rss/IRssService.hpp>
+#include <Rss/KnownItems.hpp>
 #include <Rss/RSSFeed.hpp>
+#include <Rss/RSSFeedState.hpp>
 #include <Rss/RSSItem.hpp>
 #include <Rss/RSSMedia.hpp>
 #include <Rss/RSSUrl.hpp>
+#include <Rss/RefreshStats.hpp>
+#include <Rss/RssOptions.hpp>
+#include <Rss/SeenHashIndex.hpp>
+#include <Rss/SeenHashJournal.hpp>
 
+#include <Utils/Concurrency/WorkerPool.hpp>
 #include <Utils/UtilsFactory.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <random>
 #include <string>
-#include <tinyxml2.h>
+#include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -23,44 +40,95 @@ namespace dotnamebot::rss {
   class RssManager : public IRssService {
 
   public:
+    /**
+     * @brief Construct a new Rss Manager object
+     *
+     * @param logger Logger
+     * @param assetManager Locates rssUrls.json and the other data files
+     * @param httpClient Shared HTTP client; a private one is created when null
+     */
     RssManager(std::shared_ptr<dotnamebot::logging::ILogger> logger,
-               std::shared_ptr<dotnamebot::assets::IAssetManager> assetManager);
+               std::shared_ptr<dotnamebot::assets::IAssetManager> assetManager,
+               std::shared_ptr<dotnamebot::http::IHttpClient> httpClient = nullptr);
 
     ~RssManager() override;
 
     // Public interface implementations
     bool Initialize() override;
     int refetchRssFeeds() override;
+    int refetchDueRssFeeds() override;
+    [[nodiscard]] std::chrono::seconds timeUntilNextFetch() const override;
     bool addUrl(const std::string &url, long embeddedType, uint64_t discordChannelId = 0) override;
     bool modUrl(const std::string &url, long embeddedType, uint64_t discordChannelId = 0) override;
     bool remUrl(const std::string &url) override;
     [[nodiscard]] std::string listUrlsAsString() override;
     [[nodiscard]] std::string listChannelUrlsAsString(uint64_t discordChannelId) override;
     [[nodiscard]] RSSItem getRandomItem() override;
-    [[nodiscard]] size_t getItemCount() const override { return feed_.items.size(); }
+    [[nodiscard]] size_t getItemCount() const override;
 
     bool generateHtmlFeed() override;
 
     /**
-     * @brief Decodes HTML entities in a string
+     * @brief Decodes HTML entities in a string, see rss::decodeHtmlEntities
      *
      * @param str The input string containing HTML entities
      * @return std::string The decoded string
      */
     static std::string decodeHtmlEntities(const std::string &str);
 
+    /**
+     * @brief Replace the fetch tunables (e.g. the parallel download limit)
+     *
+     * @param options The new options
+     */
+    void setOptions(const RssOptions &options);
+    [[nodiscard]] const RssOptions &getOptions() const { return options_; }
+
+    /**
+     * @brief Counters and timings of the last refresh that downloaded anything
+     *
+     * @return RefreshStats
+     */
+    [[nodiscard]] RefreshStats getLastRefreshStats() const;
+
   private:
     // Private helpers
     /**
-     * @brief Fetches the source of a URL
+     * @brief Downloads the given feeds, or only those the scheduler reports as due. A refresh
+     * started while another one runs waits for it to finish.
      *
-     * @param url The URL to fetch
-     * @param embeddedType Whether the items should be marked as embedded
-     * @param discordChannelId The Discord channel ID associated with the feed
-     * @return int Returns added items count on success, -1 on failure
+     * @param onlyDue When true, feeds that are not due yet are skipped
+     * @return int Returns the number of new items fetched
+     */
+    int refetchFeeds(bool onlyDue);
+
+    /**
+     * @brief Parses a downloaded feed body and merges its new items into the feed buffer
+     *
+     * @param rssUrl The feed source the body was downloaded from
+     * @param xmlData The raw body as downloaded
+     * @param poll Receives the new item count and item dates for the scheduler; a body that
+     * is not well-formed is recorded as a failed poll and leaves the buffer alone
+     * @param cutoff Stops parsing at already-known items; nullptr parses the whole body
+     * @return int Returns added items count
      */
-    int fetchUrlSource(const std::string &url, long embeddedType = 0,
-                       uint64_t discordChannelId = 0);
+    int ingestFeed(const RSSUrl &rssUrl, std::string_view xmlData, FeedPollResult &poll,
+                   KnownItemsCutoff *cutoff = nullptr);
+
+    /**
+     * @brief Merges a parsed feed into the feed buffer, skipping items already served
+     *
+     * Also remembers the feed's items and order for stopAfterSeenItems. After a parse that
+     * stopped early, buffered items below the cut-off stay in the buffer.
+     *
+     * @param rssUrl The feed source the items came from
+     * @param newFeed Parsed feed; its items are consumed
+     * @param totalDuplicateItems Seen items already dropped while parsing, for the log
+     * @param poll Receives the new item count and item dates for the scheduler
+     * @return int Returns added items count
+     */
+    int mergeFeed(const RSSUrl &rssUrl, RSSFeed &newFeed, int totalDuplicateItems,
+                  FeedPollResult &poll);
 
     /**
      * @brief Get the Item As Markdown object
@@ -76,17 +144,6 @@ namespace dotnamebot::rss {
      */
     void clearFeedBuffer();
 
-    /**
-     * @brief CURL write callback function
-     *
-     * @param contents Pointer to the delivered data
-     * @param size Size of each data element
-     * @param nmemb Number of data elements
-     * @param userp Pointer to the user data (string buffer)
-     * @return size_t
-     */
-    static size_t WriteCallback(void *contents, size_t size, size_t nmemb, void *userp);
-
     /**
      * @brief Checks if a file has changed since the last check.
      *
@@ -105,6 +162,24 @@ namespace dotnamebot::rss {
      */
     bool hasFilesChanged();
 
+    /**
+     * @brief Describe a feed's health for the URL listings
+     *
+     * @param url RSSUrl::url of the feed
+     * @return std::string Empty for a healthy feed, otherwise e.g. " [Suspended, ...]"
+     */
+    [[nodiscard]] std::string feedHealthAsString(const std::string &url) const;
+
+    /**
+     * @brief Refill the item buffer from the cached feed bodies (cacheFeedBodies)
+     *
+     * Only bodies matching the feed's stored body hash are used, so the restored items
+     * and the validators sent with the next conditional GET belong to the same response.
+     *
+     * @return int Returns the number of items restored
+     */
+    int loadCachedFeeds();
+
     /**
      * @brief Load RSS URLs from the JSON file
      *
@@ -113,12 +188,34 @@ namespace dotnamebot::rss {
     bool loadUrls();
 
     /**
-     * @brief Load seen hashes from the JSON file
+     * @brief Map seenHashes.index, read the migration state from the JSON file, then replay
+     * the journal written since
      *
      * @return true on success, false on failure
      */
     bool loadSeenHashes();
 
+    /**
+     * @brief Load optional fetch tunables from rssOptions.json
+     *
+     * @return true if the file was found and applied, otherwise false
+     */
+    bool loadOptions();
+
+    /**
+     * @brief Load per-feed fetch state (HTTP validators) from rssFeedState.json
+     *
+     * @return true on success, false on failure
+     */
+    bool loadFeedStates();
+
+    /**
+     * @brief Save per-feed fetch state for all current URLs to rssFeedState.json
+     *
+     * @return true on success, false on failure
+     */
+    bool saveFeedStates();
+
     /**
      * @brief Save RSS URLs to the JSON file
      *
@@ -127,20 +224,48 @@ namespace dotnamebot::rss {
     bool saveUrls();
 
     /**
-     * @brief
+     * @brief Mark an item as seen and append it to the journal; every MAX_SEEN_DELTA items
+     * the journal is folded into a new index instead
      *
-     * @param hash
+     * @param hash RSSItem::hash of the item
      * @return bool
      */
-    bool saveSeenHash(const std::string &hash);
+    bool saveSeenHash(uint64_t hash);
 
     /**
-     * @brief Save all seen hashes to the JSON file
+     * @brief Fold the seen items of the journal into a new seenHashes.index, rewrite
+     * seenHashes.json and empty the journal. The new index takes the refreshed last-seen
+     * days and leaves out items no feed has listed for seenHistoryDays.
      *
      * @return bool
      */
     bool saveAllSeenHashes();
 
+    /**
+     * @brief Whether an item was already served. An item matching a pre-fingerprint hash
+     * of seenHashes.json counts as seen and is recorded under its fingerprint from then on.
+     *
+     * @param item Item from prepareItem
+     * @return true if the item is seen
+     */
+    bool isSeen(const RSSItem &item);
+
+    /**
+     * @brief Record that feeds still list these items, so the next rewrite of the index
+     * keeps them for another seenHistoryDays
+     *
+     * @param hashes RSSItem::hash of the listed items; those never seen are ignored
+     */
+    void refreshSeenItems(const std::vector<uint64_t> &hashes);
+
+    /**
+     * @brief Note that a feed was parsed while pre-fingerprint hashes are being migrated;
+     * once every feed was, the hashes nothing matched are dropped and the file is rewritten
+     *
+     * @param url RSSUrl::url of the parsed feed
+     */
+    void advanceLegacyMigration(const std::string &url);
+
     /**
      * @brief Parses RSS feed XML data into an RSSFeed object
      *
@@ -148,28 +273,51 @@ namespace dotnamebot::rss {
      * @param embeddedType Whether the items should be marked as embedded
      * @param discordChannelId The Discord channel ID associated with the feed
      * @param totalDuplicateItems Reference to an integer to count duplicate items
+     * @param cutoff Stops parsing at already-known items; nullptr parses the whole body
      * @return RSSFeed The parsed RSS feed
      */
-    RSSFeed parseRSS(const std::string &xmlData, long embeddedType, uint64_t discordChannelId,
-                     int &totalDuplicateItems);
+    RSSFeed parseRSS(std::string_view xmlData, long embeddedType, uint64_t discordChannelId,
+                     int &totalDuplicateItems, KnownItemsCutoff *cutoff = nullptr);
+
+    /**
+     * @brief Parses RSS feed XML data like parseRSS, but keeps already-seen items; needs no
+     * lock, so the refresh runs it on the worker pool
+     *
+     * @param xmlData The UTF-8 XML data of the feed
+     * @param embeddedType Whether the items should be marked as embedded
+     * @param discordChannelId The Discord channel ID associated with the feed
+     * @param feed Receives the parsed feed; left empty when the document is not well-formed
+     * @param error Receives the reason when the document is rejected
+     * @param cutoff Stops parsing at already-known items; nullptr parses the whole body
+     * @param format Format from detectFeedFormat(); Unknown sniffs the document
+     * @return true if the document was read, false if it is not well-formed
+     */
+    bool readFeed(std::string_view xmlData, long embeddedType, uint64_t discordChannelId,
+                  RSSFeed &feed, std::string &error, KnownItemsCutoff *cutoff = nullptr,
+                  FeedFormat format = FeedFormat::Unknown) const;
 
     /**
-     * @brief Downloads the RSS feed data from the given URL
+     * @brief Records the item date, hashes the item and tidies its description
      *
-     * @param url The URL of the RSS feed to download
-     * @return std::string The raw XML data of the RSS feed
+     * @param rssItem Item from readFeedItem
+     * @param feed Feed whose publishTimes and itemHashes receive the item date and hash
+     * @param legacyHash Also compute RSSItem::legacyHash, while seenHashes.json still holds
+     * pre-fingerprint hashes
+     * @return true if the item has a title and a link, otherwise false
      */
-    std::string downloadFeed(const std::string &url);
+    static bool prepareItem(RSSItem &rssItem, RSSFeed &feed, bool legacyHash = false);
 
     /**
      * @brief Converts XML data from its declared encoding to UTF-8.
      *        If the XML declaration specifies a non-UTF-8 encoding (e.g. windows-1250),
      *        iconv is used to transcode the bytes and the declaration is updated to UTF-8.
+     *        Only the prolog is inspected, so UTF-8 documents are neither scanned nor copied.
      *
      * @param xmlData Raw XML bytes as downloaded
-     * @return std::string UTF-8 encoded XML string
+     * @param buffer Receives the transcoded document when one is needed
+     * @return std::string_view UTF-8 encoded XML: xmlData itself or the text in buffer
      */
-    std::string convertToUtf8(const std::string &xmlData) const;
+    std::string_view convertToUtf8(std::string_view xmlData, std::string &buffer) const;
 
     // Data members
     bool isInitialized_{false};
@@ -179,12 +327,52 @@ namespace dotnamebot::rss {
 
     std::filesystem::path hashesPath_;
     std::filesystem::file_time_type hashesLastModified_;
+    std::filesystem::path indexPath_;
+
+    std::filesystem::path optionsPath_;
+    std::filesystem::path feedStatePath_;
 
     std::mt19937 rng_;
     std::shared_ptr<dotnamebot::logging::ILogger> logger_;
     std::shared_ptr<dotnamebot::assets::IAssetManager> assetManager_;
+    std::shared_ptr<dotnamebot::http::IHttpClient> httpClient_;
+    RssOptions options_;
+    FeedFetcher fetcher_;
+    FeedScheduler scheduler_;
+    FeedCache feedCache_;
+    // Transcodes and parses downloaded feeds; created by the first refresh
+    std::shared_ptr<utils::WorkerPool> workers_;
+    // Serializes refreshes: the fetch timer and /refetch share fetcher_, its per-host limiter,
+    // feedCache_ and workers_. Taken before mutex_, never while holding it.
+    std::mutex refreshMutex_;
+    // Guards the buffer, URLs, hashes and feed state; the fetch timer, the post timer and
+    // slash commands run on different threads. Not held while downloading.
+    mutable std::mutex mutex_;
     RSSFeed feed_;
     std::vector<RSSUrl> urls_;
-    std::unordered_set<std::string> seenHashes_;
+    // Seen items written out in seenHashes.index, mapped rather than loaded
+    SeenHashIndex seenIndex_;
+    // Seen items not yet in seenIndex_; journal_ keeps them across restarts
+    std::unordered_set<uint64_t> seenHashes_;
+    SeenHashJournal journal_;
+    // Items of seenIndex_ that feeds listed again since it was written, and the day they did
+    std::unordered_map<uint64_t, SeenDay> seenRefreshes_;
+    // Day seenIndex_ was last written; the first refresh of another day writes it again
+    SeenDay seenIndexDay_{0};
+    // std::hash values from a seenHashes.json written before item fingerprints. Matching
+    // items are recorded under their fingerprint; what is left once every feed has been
+    // parsed belongs to items no feed lists any more.
+    std::unordered_set<uint64_t> legacySeenHashes_;
+    // Feeds not parsed since legacySeenHashes_ was loaded
+    std::unordered_set<std::string> legacyPendingFeeds_;
+    // Whether parses compute RSSItem::legacyHash; read by the workers without the lock
+    std::atomic<bool> migratingLegacyHashes_{false};
+    std::unordered_map<std::string, RSSFeedState> feedStates_;
+    // Feeds whose items were merged into feed_ during this run; only these may be
+    // revalidated with a conditional GET, since the buffer itself is not persisted
+    std::unordered_set<std::string> primedFeeds_;
+    // Items of every feed's last parse, for stopping at known items on the next one
+    std::unordered_map<std::string, KnownItems> knownItems_;
+    RefreshStats lastRefreshStats_;
   };
 } // namespace dotnamebot::rss
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include <utility>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Tunables for RSS fetching.
+   *
+   * Defaults are compiled in; any key present in the optional rssOptions.json
+   * (next to rssUrls.json) overrides the matching field.
+   */
+  struct RssOptions {
+    size_t maxParallelFetches{16};
+    // Circuit breaker: after this many failures in a row a feed is suspended with exponential
+    // backoff (jittered), up to circuitMaxBackoffSeconds between attempts
+    int circuitFailureThreshold{3};
+    long circuitMaxBackoffSeconds{24 * 3600};
+    // Per-host politeness: concurrent transfers, sustained rate and burst (token bucket)
+    size_t maxFetchesPerHost{2};
+    double hostRequestsPerSecond{1.0};
+    double hostBurst{4.0};
+    // Pause a host that answers 429 / 503 for the duration of its Retry-After
+    bool respectRetryAfter{true};
+    // Largest feed body accepted (decoded bytes); bigger downloads are aborted and the feed
+    // is marked oversized. A feed in rssUrls.json may set its own maxBytes.
+    size_t maxFeedBytes{8 * 1024 * 1024};
+    // Keep the last body of every feed in feedCache/ and parse those on startup, so the item
+    // buffer is refilled before the first download (identical bodies are detected by hash
+    // either way)
+    bool cacheFeedBodies{false};
+    // Parse feeds while they download instead of buffering the whole body first
+    bool streamingParse{true};
+    // Threads that transcode and parse downloaded feeds; 0 uses one per CPU core
+    size_t parseThreads{0};
+    // Stop parsing a feed that lists newest items first after this many items in a row
+    // that its previous parse already returned; 0 parses every item. Opt-in, and a feed in
+    // rssUrls.json may set its own stopAfterSeenItems.
+    size_t stopAfterSeenItems{0};
+    // Adaptive polling: a feed's interval starts at defaultPollSeconds and is then derived
+    // from its publish rate, clamped to [minPollSeconds, maxPollSeconds] unless the feed
+    // in rssUrls.json sets its own bounds
+    long defaultPollSeconds{3600};
+    long minPollSeconds{300};
+    long maxPollSeconds{6 * 3600};
+    // False-positive rate the Bloom filter in front of seenHashes.index is sized for; it is
+    // rebuilt with the index, so a change applies from the next compaction. 0 writes none.
+    double seenFilterFalsePositiveRate{0.01};
+    // Seen items no feed has listed for this many days are dropped from the history; their
+    // last-seen day is refreshed whenever a parsed feed still lists them. 0 keeps everything.
+    long seenHistoryDays{90};
+
+    static RssOptions fromJson(const nlohmann::json &json) {
+      RssOptions options;
+      if (!json.is_object()) {
+        return options;
+      }
+      if (json.contains("maxParallelFetches") && json["maxParallelFetches"].is_number_unsigned()) {
+        options.maxParallelFetches = json["maxParallelFetches"].get<size_t>();
+      }
+      if (json.contains("circuitFailureThreshold") &&
+          json["circuitFailureThreshold"].is_number_integer() &&
+          json["circuitFailureThreshold"].get<int>() > 0) {
+        options.circuitFailureThreshold = json["circuitFailureThreshold"].get<int>();
+      }
+      if (json.contains("circuitMaxBackoffSeconds") &&
+          json["circuitMaxBackoffSeconds"].is_number_integer() &&
+          json["circuitMaxBackoffSeconds"].get<long>() > 0) {
+        options.circuitMaxBackoffSeconds = json["circuitMaxBackoffSeconds"].get<long>();
+      }
+      if (json.contains("maxFetchesPerHost") && json["maxFetchesPerHost"].is_number_unsigned()) {
+        options.maxFetchesPerHost = json["maxFetchesPerHost"].get<size_t>();
+      }
+      if (json.contains("hostRequestsPerSecond") && json["hostRequestsPerSecond"].is_number() &&
+          json["hostRequestsPerSecond"].get<double>() > 0.0) {
+        options.hostRequestsPerSecond = json["hostRequestsPerSecond"].get<double>();
+      }
+      if (json.contains("hostBurst") && json["hostBurst"].is_number() &&
+          json["hostBurst"].get<double>() >= 1.0) {
+        options.hostBurst = json["hostBurst"].get<double>();
+      }
+      if (json.contains("respectRetryAfter") && json["respectRetryAfter"].is_boolean()) {
+        options.respectRetryAfter = json["respectRetryAfter"].get<bool>();
+      }
+      if (json.contains("maxFeedBytes") && json["maxFeedBytes"].is_number_unsigned() &&
+          json["maxFeedBytes"].get<size_t>() > 0) {
+        options.maxFeedBytes = json["maxFeedBytes"].get<size_t>();
+      }
+      if (json.contains("cacheFeedBodies") && json["cacheFeedBodies"].is_boolean()) {
+        options.cacheFeedBodies = json["cacheFeedBodies"].get<bool>();
+      }
+      if (json.contains("streamingParse") && json["streamingParse"].is_boolean()) {
+        options.streamingParse = json["streamingParse"].get<bool>();
+      }
+      if (json.contains("parseThreads") && json["parseThreads"].is_number_unsigned()) {
+        options.parseThreads = json["parseThreads"].get<size_t>();
+      }
+      if (json.contains("stopAfterSeenItems") && json["stopAfterSeenItems"].is_number_unsigned()) {
+        options.stopAfterSeenItems = json["stopAfterSeenItems"].get<size_t>();
+      }
+      if (json.contains("seenFilterFalsePositiveRate") &&
+          json["seenFilterFalsePositiveRate"].is_number() &&
+          json["seenFilterFalsePositiveRate"].get<double>() >= 0.0 &&
+          json["seenFilterFalsePositiveRate"].get<double>() < 1.0) {
+        options.seenFilterFalsePositiveRate = json["seenFilterFalsePositiveRate"].get<double>();
+      }
+      if (json.contains("seenHistoryDays") && json["seenHistoryDays"].is_number_integer() &&
+          json["seenHistoryDays"].get<long>() >= 0) {
+        options.seenHistoryDays = json["seenHistoryDays"].get<long>();
+      }
+      for (auto [key, field] : {std::pair{"defaultPollSeconds", &options.defaultPollSeconds},
+                                std::pair{"minPollSeconds", &options.minPollSeconds},
+                                std::pair{"maxPollSeconds", &options.maxPollSeconds}}) {
+        if (json.contains(key) && json[key].is_number_integer() && json[key].get<long>() > 0) {
+          *field = json[key].get<long>();
+        }
+      }
+      if (options.maxPollSeconds < options.minPollSeconds) {
+        options.maxPollSeconds = options.minPollSeconds;
+      }
+      return options;
+    }
+  };
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,414 @@
+#include "SeenHashIndex.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <system_error>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    constexpr std::string_view MAGIC{"DNBSIDX\x01", 8};
+    // Header: magic, capacity, count, flags; every field a little-endian uint64_t
+    constexpr size_t HEADER_SIZE = 32;
+    constexpr size_t SLOT_SIZE = 8;
+    constexpr uint64_t FLAG_CONTAINS_ZERO = 1;
+    // Then the filter header (block count, block size), and the blocks from the next 64-byte
+    // boundary of the file
+    constexpr uint64_t FLAG_HAS_FILTER = 2;
+    // The slots are followed by the last-seen days, padded to 8 bytes
+    constexpr uint64_t FLAG_HAS_LAST_SEEN = 4;
+    constexpr size_t DAY_SIZE = 4;
+    constexpr size_t MIN_CAPACITY = 16;
+    // 2^64 / golden ratio; spreads sequential values as well as random ones
+    constexpr uint64_t FIBONACCI = 0x9e3779b97f4a7c15ULL;
+
+    // Split block Bloom filter, the layout of Parquet's: a fingerprint sets one bit in each
+    // of the eight 32-bit lanes of its block, so a lookup is a fixed, branchless sequence
+    constexpr size_t FILTER_HEADER_SIZE = 16;
+    constexpr size_t BLOCK_SIZE = 32;
+    constexpr unsigned BLOCK_LANES = 8;
+    constexpr unsigned LANE_BITS = 32;
+    constexpr size_t FILTER_ALIGNMENT = 64;
+
+    void putLittleEndian(unsigned char *out, uint64_t value) {
+      for (size_t i = 0; i < 8; ++i) {
+        out[i] = static_cast<unsigned char>((value >> (8 * i)) & 0xFF);
+      }
+    }
+
+    void putLittleEndian32(unsigned char *out, uint32_t value) {
+      for (size_t i = 0; i < 4; ++i) {
+        out[i] = static_cast<unsigned char>((value >> (8 * i)) & 0xFF);
+      }
+    }
+
+    uint32_t getLittleEndian32(const unsigned char *in) {
+      uint32_t value = 0;
+      for (size_t i = 0; i < 4; ++i) {
+        value |= static_cast<uint32_t>(in[i]) << (8 * i);
+      }
+      return value;
+    }
+
+    uint64_t getLittleEndian(const unsigned char *in) {
+      uint64_t value = 0;
+      std::memcpy(&value, in, sizeof(value));
+      if constexpr (std::endian::native == std::endian::big) {
+        uint64_t swapped = 0;
+        for (size_t i = 0; i < 8; ++i) {
+          swapped = (swapped << 8) | ((value >> (8 * i)) & 0xFF);
+        }
+        value = swapped;
+      }
+      return value;
+    }
+
+    size_t home(uint64_t fingerprint, unsigned shift) {
+      return static_cast<size_t>((fingerprint * FIBONACCI) >> shift);
+    }
+
+    // Finaliser of MurmurHash3, so the filter does not share the table's hash
+    uint64_t filterHash(uint64_t fingerprint) {
+      fingerprint ^= fingerprint >> 33;
+      fingerprint *= 0xff51afd7ed558ccdULL;
+      fingerprint ^= fingerprint >> 33;
+      fingerprint *= 0xc4ceb9fe1a85ec53ULL;
+      fingerprint ^= fingerprint >> 33;
+      return fingerprint;
+    }
+
+    // Odd multipliers, one per lane, as in Parquet
+    constexpr uint32_t SALTS[BLOCK_LANES] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                             0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                             0x9efc4947U, 0x5c6bfb31U};
+
+    // The high half of the hash picks the block, as a fraction of the block count
+    size_t filterBlock(uint64_t hash, size_t blocks) {
+      return static_cast<size_t>(((hash >> 32) * blocks) >> 32);
+    }
+
+    // The bits of lanes 2 * word and 2 * word + 1, as in the little-endian word holding both:
+    // the top 5 bits of the low half of the hash times the lane's salt
+    uint64_t filterMask(uint64_t hash, unsigned word) {
+      const auto low = static_cast<uint32_t>(hash);
+      return (uint64_t{1} << ((low * SALTS[2 * word]) >> 27)) |
+             (uint64_t{1} << (LANE_BITS + ((low * SALTS[2 * word + 1]) >> 27)));
+    }
+
+    // Expected false-positive rate: the fingerprints per block follow a Poisson distribution,
+    // and a crowded block answers yes far more often than an average one
+    double splitBlockFalsePositiveRate(double perBlock) {
+      double rate = 0.0;
+      double probability = std::exp(-perBlock);
+      const auto last = static_cast<unsigned>(perBlock + 10.0 * std::sqrt(perBlock) + 10.0);
+      for (unsigned fingerprints = 0; fingerprints <= last; ++fingerprints) {
+        const double laneSet = 1.0 - std::pow(1.0 - 1.0 / LANE_BITS, fingerprints);
+        rate += probability * std::pow(laneSet, BLOCK_LANES);
+        probability *= perBlock / (fingerprints + 1);
+      }
+      return rate;
+    }
+
+    // Bits per fingerprint reaching the rate: the classic Bloom filter sizing, grown until
+    // the split block layout reaches it too
+    double filterBitsPerFingerprint(double falsePositiveRate) {
+      const double ln2 = std::log(2.0);
+      double bitsPerFingerprint = -std::log(falsePositiveRate) / (ln2 * ln2);
+      for (int attempt = 0; attempt < 64; ++attempt, bitsPerFingerprint *= 1.03) {
+        if (splitBlockFalsePositiveRate(BLOCK_SIZE * 8 / bitsPerFingerprint) <=
+            falsePositiveRate) {
+          break;
+        }
+      }
+      return bitsPerFingerprint;
+    }
+
+    size_t alignUp(size_t offset, size_t alignment) {
+      return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    // Where the optional sections start for a table of capacity slots
+    struct Layout {
+      Layout(size_t capacity, bool withDays)
+          : slotsEnd(HEADER_SIZE + capacity * SLOT_SIZE),
+            filterHeader(withDays ? alignUp(slotsEnd + (capacity + 1) * DAY_SIZE, 8) : slotsEnd),
+            blocks(alignUp(filterHeader + FILTER_HEADER_SIZE, FILTER_ALIGNMENT)) {}
+
+      size_t slotsEnd;
+      size_t filterHeader;
+      size_t blocks;
+    };
+
+  } // namespace
+
+  SeenHashIndex::~SeenHashIndex() { close(); }
+
+  bool SeenHashIndex::open(const std::filesystem::path &path) {
+    close();
+
+    const unsigned char *data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    // No mapping here: the file is read, so it can still be renamed over later
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+      return false;
+    }
+    buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data = buffer_.data();
+    size = buffer_.size();
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat status{};
+    if (::fstat(fd, &status) == 0 && status.st_size >= static_cast<off_t>(HEADER_SIZE)) {
+      size = static_cast<size_t>(status.st_size);
+      void *mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+      if (mapping != MAP_FAILED) {
+        mapping_ = mapping;
+        mappingSize_ = size;
+        data = static_cast<const unsigned char *>(mapping);
+        // Lookups land on random slots; read-ahead would only evict other pages
+        ::madvise(mapping, size, MADV_RANDOM);
+      }
+    }
+    ::close(fd);
+#endif
+    if (data == nullptr || size < HEADER_SIZE ||
+        std::string_view(reinterpret_cast<const char *>(data), MAGIC.size()) != MAGIC) {
+      close();
+      return false;
+    }
+
+    const uint64_t capacity = getLittleEndian(data + 8);
+    const uint64_t count = getLittleEndian(data + 16);
+    const uint64_t flags = getLittleEndian(data + 24);
+    if (capacity < MIN_CAPACITY || !std::has_single_bit(capacity) ||
+        capacity > (size - HEADER_SIZE) / SLOT_SIZE || count > capacity) {
+      close();
+      return false;
+    }
+    const bool withDays = (flags & FLAG_HAS_LAST_SEEN) != 0;
+    const Layout layout(static_cast<size_t>(capacity), withDays);
+    if ((flags & FLAG_HAS_FILTER) == 0) {
+      if (size != layout.filterHeader) {
+        close();
+        return false;
+      }
+    } else {
+      const bool fits = size >= layout.blocks;
+      const uint64_t blocks = fits ? getLittleEndian(data + layout.filterHeader) : 0;
+      const uint64_t blockSize = fits ? getLittleEndian(data + layout.filterHeader + 8) : 0;
+      if (blocks == 0 || blocks > 0xffffffffULL ||
+          blocks > (size - layout.blocks) / BLOCK_SIZE ||
+          size != layout.blocks + blocks * BLOCK_SIZE || blockSize != BLOCK_SIZE) {
+        close();
+        return false;
+      }
+      filter_ = data + layout.blocks;
+      filterBlocks_ = static_cast<size_t>(blocks);
+    }
+    days_ = withDays ? data + layout.slotsEnd : nullptr;
+
+    slots_ = data + HEADER_SIZE;
+    capacity_ = static_cast<size_t>(capacity);
+    count_ = static_cast<size_t>(count);
+    containsZero_ = (flags & FLAG_CONTAINS_ZERO) != 0;
+    shift_ = 64 - static_cast<unsigned>(std::countr_zero(capacity));
+    return true;
+  }
+
+  void SeenHashIndex::close() {
+#ifndef _WIN32
+    if (mapping_ != nullptr) {
+      ::munmap(mapping_, mappingSize_);
+    }
+#endif
+    mapping_ = nullptr;
+    mappingSize_ = 0;
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+    slots_ = nullptr;
+    capacity_ = 0;
+    count_ = 0;
+    containsZero_ = false;
+    shift_ = 64;
+    days_ = nullptr;
+    filter_ = nullptr;
+    filterBlocks_ = 0;
+  }
+
+  bool SeenHashIndex::mayContain(uint64_t fingerprint) const {
+    if (filter_ == nullptr) {
+      return true;
+    }
+    const uint64_t hash = filterHash(fingerprint);
+    const unsigned char *block = filter_ + filterBlock(hash, filterBlocks_) * BLOCK_SIZE;
+    // No early exit: a hit checks every lane anyway
+    uint64_t missing = 0;
+    for (unsigned word = 0; word < BLOCK_LANES / 2; ++word) {
+      const uint64_t mask = filterMask(hash, word);
+      missing |= mask & ~getLittleEndian(block + word * 8);
+    }
+    return missing == 0;
+  }
+
+  bool SeenHashIndex::contains(uint64_t fingerprint) const {
+    return find(fingerprint) != NOT_FOUND;
+  }
+
+  std::optional<SeenDay> SeenHashIndex::lastSeen(uint64_t fingerprint) const {
+    const size_t index = find(fingerprint);
+    if (index == NOT_FOUND) {
+      return std::nullopt;
+    }
+    return days_ != nullptr ? getLittleEndian32(days_ + index * DAY_SIZE) : SeenDay{0};
+  }
+
+  void SeenHashIndex::collect(std::vector<SeenEntry> &out) const {
+    out.reserve(out.size() + count_);
+    const auto day = [this](size_t index) {
+      return days_ != nullptr ? getLittleEndian32(days_ + index * DAY_SIZE) : SeenDay{0};
+    };
+    if (containsZero_) {
+      out.push_back({0, day(capacity_)});
+    }
+    for (size_t index = 0; index < capacity_; ++index) {
+      if (const uint64_t value = slot(index); value != 0) {
+        out.push_back({value, day(index)});
+      }
+    }
+  }
+
+  bool SeenHashIndex::write(const std::filesystem::path &path,
+                            const std::vector<SeenEntry> &entries, double falsePositiveRate) {
+    const size_t capacity = std::max(MIN_CAPACITY, std::bit_ceil(entries.size() * 2));
+    const unsigned shift = 64 - static_cast<unsigned>(std::countr_zero(capacity));
+    const size_t mask = capacity - 1;
+
+    std::vector<uint64_t> table(capacity, 0);
+    std::vector<SeenDay> days(capacity + 1, 0);
+    size_t count = 0;
+    bool containsZero = false;
+    for (const SeenEntry &entry : entries) {
+      size_t index = capacity;
+      if (entry.fingerprint == 0) {
+        count += containsZero ? 0 : 1;
+        containsZero = true;
+      } else {
+        index = home(entry.fingerprint, shift);
+        while (table[index] != 0 && table[index] != entry.fingerprint) {
+          index = (index + 1) & mask;
+        }
+        if (table[index] == 0) {
+          table[index] = entry.fingerprint;
+          count++;
+        }
+      }
+      days[index] = std::max(days[index], entry.lastSeen);
+    }
+
+    const bool withFilter = falsePositiveRate > 0.0 && falsePositiveRate < 1.0;
+    const double bitsPerFingerprint = withFilter ? filterBitsPerFingerprint(falsePositiveRate) : 0;
+    const size_t blocks = std::clamp<size_t>(
+        static_cast<size_t>(std::ceil(static_cast<double>(count) * bitsPerFingerprint /
+                                      (BLOCK_SIZE * 8))),
+        1, 0xffffffffULL);
+
+    const Layout layout(capacity, true);
+    std::vector<unsigned char> bytes(withFilter ? layout.blocks + blocks * BLOCK_SIZE
+                                                : layout.filterHeader);
+    std::memcpy(bytes.data(), MAGIC.data(), MAGIC.size());
+    putLittleEndian(bytes.data() + 8, capacity);
+    putLittleEndian(bytes.data() + 16, count);
+    putLittleEndian(bytes.data() + 24, (containsZero ? FLAG_CONTAINS_ZERO : 0) |
+                                           (withFilter ? FLAG_HAS_FILTER : 0) |
+                                           FLAG_HAS_LAST_SEEN);
+    for (size_t index = 0; index < capacity; ++index) {
+      putLittleEndian(bytes.data() + HEADER_SIZE + index * SLOT_SIZE, table[index]);
+    }
+    for (size_t index = 0; index <= capacity; ++index) {
+      putLittleEndian32(bytes.data() + layout.slotsEnd + index * DAY_SIZE, days[index]);
+    }
+    if (withFilter) {
+      putLittleEndian(bytes.data() + layout.filterHeader, blocks);
+      putLittleEndian(bytes.data() + layout.filterHeader + 8, BLOCK_SIZE);
+      std::vector<uint64_t> words(blocks * (BLOCK_SIZE / 8), 0);
+      for (const uint64_t fingerprint : table) {
+        if (fingerprint == 0) {
+          continue;
+        }
+        const uint64_t hash = filterHash(fingerprint);
+        uint64_t *block = words.data() + filterBlock(hash, blocks) * (BLOCK_SIZE / 8);
+        for (unsigned word = 0; word < BLOCK_LANES / 2; ++word) {
+          block[word] |= filterMask(hash, word);
+        }
+      }
+      for (size_t word = 0; word < words.size(); ++word) {
+        putLittleEndian(bytes.data() + layout.blocks + word * 8, words[word]);
+      }
+    }
+
+    // A crash leaves either the old index or the new one; mappings of the old file stay valid
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+      std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+      if (!file.is_open()) {
+        return false;
+      }
+      file.write(reinterpret_cast<const char *>(bytes.data()),
+                 static_cast<std::streamsize>(bytes.size()));
+      if (!file) {
+        return false;
+      }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporary, path, ec);
+    return !ec;
+  }
+
+  size_t SeenHashIndex::find(uint64_t fingerprint) const {
+    if (fingerprint == 0) {
+      return containsZero_ ? capacity_ : NOT_FOUND;
+    }
+    if (capacity_ == 0 || !mayContain(fingerprint)) {
+      return NOT_FOUND;
+    }
+    // The table is at most half full, so a run ends well before capacity_ probes; the bound
+    // only guards against a damaged file
+    const size_t mask = capacity_ - 1;
+    size_t index = home(fingerprint, shift_);
+    for (size_t probes = 0; probes < capacity_; ++probes) {
+      const uint64_t value = slot(index);
+      if (value == fingerprint) {
+        return index;
+      }
+      if (value == 0) {
+        return NOT_FOUND;
+      }
+      index = (index + 1) & mask;
+    }
+    return NOT_FOUND;
+  }
+
+  uint64_t SeenHashIndex::slot(size_t index) const {
+    return getLittleEndian(slots_ + index * SLOT_SIZE);
+  }
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace dotnamebot::rss {
+
+  // Days since the Unix epoch, the resolution of last-seen times; 0 is not recorded
+  using SeenDay = uint32_t;
+
+  struct SeenEntry {
+    uint64_t fingerprint{0};
+    SeenDay lastSeen{0};
+  };
+
+  /**
+   * @brief Read-only hash table of seen item fingerprints, queried in place in its file.
+   *
+   * The file is a fixed header followed by a power-of-two array of little-endian slots,
+   * filled by linear probing and never more than half full; 0 marks an empty slot, and the
+   * fingerprint 0 itself is a header flag. open() maps the file instead of reading it, so it
+   * costs the same whatever the history size, and restarts find the pages in the page cache.
+   * A new table is only ever written whole, next to the old one and renamed over it.
+   *
+   * Each slot has a little-endian uint32_t day after the slot array: when a feed last served
+   * the item, so RssManager can drop what no feed has listed for a while.
+   *
+   * After the slots the file may carry a split block Bloom filter of the same fingerprints:
+   * each fingerprint sets one bit in each 32-bit lane of one 32-byte block. contains() asks
+   * the filter first, so a fingerprint that was never seen is mostly turned away after one
+   * cache line of a filter that is a fraction of the table's size.
+   *
+   * Not thread-safe; RssManager uses it under its lock.
+   */
+  class SeenHashIndex {
+  public:
+    static constexpr double DEFAULT_FALSE_POSITIVE_RATE = 0.01;
+
+    SeenHashIndex() = default;
+    ~SeenHashIndex();
+
+    SeenHashIndex(const SeenHashIndex &) = delete;
+    SeenHashIndex &operator=(const SeenHashIndex &) = delete;
+
+    /**
+     * @brief Map an index file, replacing the one open before
+     *
+     * @param path File written by write()
+     * @return true if the file is a valid index; otherwise the index is left empty
+     */
+    bool open(const std::filesystem::path &path);
+
+    void close();
+
+    // Whether a valid index file is open
+    [[nodiscard]] bool isOpen() const { return slots_ != nullptr; }
+
+    [[nodiscard]] bool contains(uint64_t fingerprint) const;
+
+    // Fingerprints in the index
+    [[nodiscard]] size_t size() const { return count_; }
+
+    // Whether the file carries a Bloom filter
+    [[nodiscard]] bool hasFilter() const { return filter_ != nullptr; }
+
+    /**
+     * @brief Ask only the Bloom filter. false means the fingerprint is not in the index;
+     * true means it may be. Without a filter the answer is always true.
+     */
+    [[nodiscard]] bool mayContain(uint64_t fingerprint) const;
+
+    /**
+     * @brief Day the fingerprint was last seen
+     *
+     * @return std::optional<SeenDay> nullopt if the fingerprint is not in the index; 0 if
+     * the file records no days
+     */
+    [[nodiscard]] std::optional<SeenDay> lastSeen(uint64_t fingerprint) const;
+
+    // Appends every entry in the index to out, in slot order
+    void collect(std::vector<SeenEntry> &out) const;
+
+    /**
+     * @brief Write an index of entries to path, through a temporary file and a rename
+     *
+     * @param path Destination; may be the file currently open
+     * @param entries Entries to store; a fingerprint listed twice is stored once, with the
+     * later of its days
+     * @param falsePositiveRate Rate the Bloom filter is sized for; outside (0, 1) the file
+     * gets no filter
+     * @return true on success, false on failure
+     */
+    static bool write(const std::filesystem::path &path, const std::vector<SeenEntry> &entries,
+                      double falsePositiveRate = DEFAULT_FALSE_POSITIVE_RATE);
+
+  private:
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    // Slot holding the fingerprint, capacity_ for 0, NOT_FOUND if it is not in the index
+    [[nodiscard]] size_t find(uint64_t fingerprint) const;
+    [[nodiscard]] uint64_t slot(size_t index) const;
+
+    // Slot array of the mapped file, or of buffer_ where files are not mapped
+    const unsigned char *slots_{nullptr};
+    size_t capacity_{0};
+    size_t count_{0};
+    bool containsZero_{false};
+    // log2(capacity_) subtracted from 64, for Fibonacci hashing into the slots
+    unsigned shift_{64};
+    // capacity_ + 1 days, the last one for the fingerprint 0; nullptr when the file has none
+    const unsigned char *days_{nullptr};
+
+    // Blocks of the Bloom filter, nullptr when the file has none
+    const unsigned char *filter_{nullptr};
+    size_t filterBlocks_{0};
+
+    void *mapping_{nullptr};
+    size_t mappingSize_{0};
+    std::vector<unsigned char> buffer_;
+  };
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,119 @@
+#include "SeenHashJournal.hpp"
+
+#include <array>
+#include <string_view>
+#include <system_error>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    constexpr std::string_view MAGIC{"DNBSEEN\x01", 8};
+    // Record: fingerprint, then fingerprint ^ CHECK, both little-endian
+    constexpr size_t RECORD_SIZE = 16;
+    constexpr uint64_t CHECK = 0x5a17c0de5ee4a5e5ULL;
+
+    using Record = std::array<char, RECORD_SIZE>;
+
+    void putLittleEndian(char *out, uint64_t value) {
+      for (size_t i = 0; i < 8; ++i) {
+        out[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+      }
+    }
+
+    uint64_t getLittleEndian(const char *in) {
+      uint64_t value = 0;
+      for (size_t i = 0; i < 8; ++i) {
+        value |= static_cast<uint64_t>(static_cast<unsigned char>(in[i])) << (8 * i);
+      }
+      return value;
+    }
+
+  } // namespace
+
+  SeenHashJournal::SeenHashJournal(std::filesystem::path path) : path_(std::move(path)) {}
+
+  void SeenHashJournal::setPath(std::filesystem::path path) {
+    out_.close();
+    path_ = std::move(path);
+    records_ = 0;
+  }
+
+  size_t SeenHashJournal::replay(std::unordered_set<uint64_t> &hashes) {
+    out_.close();
+    records_ = 0;
+    std::ifstream file(path_, std::ios::binary);
+    if (!file.is_open()) {
+      return 0;
+    }
+
+    std::array<char, MAGIC.size()> magic{};
+    size_t intactBytes = 0;
+    if (file.read(magic.data(), magic.size()) &&
+        std::string_view(magic.data(), magic.size()) == MAGIC) {
+      intactBytes = MAGIC.size();
+      Record record;
+      while (file.read(record.data(), record.size())) {
+        const uint64_t fingerprint = getLittleEndian(record.data());
+        if ((fingerprint ^ CHECK) != getLittleEndian(record.data() + 8)) {
+          break;
+        }
+        hashes.insert(fingerprint);
+        records_++;
+        intactBytes += RECORD_SIZE;
+      }
+    }
+    file.close();
+
+    std::error_code ec;
+    if (std::filesystem::file_size(path_, ec) != intactBytes && !ec) {
+      // Torn or foreign bytes at the end; without a valid header nothing is kept
+      if (intactBytes == 0) {
+        clear();
+      } else {
+        std::filesystem::resize_file(path_, intactBytes, ec);
+      }
+    }
+    return records_;
+  }
+
+  bool SeenHashJournal::append(uint64_t fingerprint) {
+    if (!out_.is_open() && !open()) {
+      return false;
+    }
+    Record record;
+    putLittleEndian(record.data(), fingerprint);
+    putLittleEndian(record.data() + 8, fingerprint ^ CHECK);
+    out_.write(record.data(), record.size());
+    out_.flush();
+    if (!out_) {
+      out_.close();
+      return false;
+    }
+    records_++;
+    return true;
+  }
+
+  bool SeenHashJournal::clear() {
+    out_.close();
+    records_ = 0;
+    std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+      return false;
+    }
+    file.write(MAGIC.data(), static_cast<std::streamsize>(MAGIC.size()));
+    return static_cast<bool>(file);
+  }
+
+  bool SeenHashJournal::open() {
+    std::error_code ec;
+    if (std::filesystem::file_size(path_, ec) < MAGIC.size() || ec) {
+      if (!clear()) {
+        return false;
+      }
+    }
+    out_.open(path_, std::ios::binary | std::ios::app);
+    return out_.is_open();
+  }
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <unordered_set>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Append-only file of the item fingerprints marked as seen since seenHashes.index
+   * was last written.
+   *
+   * Marking an item as seen appends one fixed-size record instead of rewriting the whole
+   * history. Every record carries a check word, so a record torn by a crash, or a tail the
+   * file system zero-filled, is recognised on replay and cut off. Once a new index has taken
+   * the entries in, clear() starts the journal over.
+   *
+   * Not thread-safe; RssManager uses it under its lock.
+   */
+  class SeenHashJournal {
+  public:
+    explicit SeenHashJournal(std::filesystem::path path = {});
+
+    SeenHashJournal(const SeenHashJournal &) = delete;
+    SeenHashJournal &operator=(const SeenHashJournal &) = delete;
+
+    void setPath(std::filesystem::path path);
+    [[nodiscard]] const std::filesystem::path &getPath() const { return path_; }
+
+    /**
+     * @brief Read the journal into hashes. A damaged tail is truncated, so later appends
+     * line up with the intact records again.
+     *
+     * @param hashes Receives the fingerprints
+     * @return size_t Number of intact records
+     */
+    size_t replay(std::unordered_set<uint64_t> &hashes);
+
+    /**
+     * @brief Append one fingerprint and flush it to the file
+     *
+     * @param fingerprint ItemFingerprint of the item
+     * @return true on success, false on failure
+     */
+    bool append(uint64_t fingerprint);
+
+    /**
+     * @brief Empty the journal, after a new index has taken its entries in
+     *
+     * @return true on success, false on failure
+     */
+    bool clear();
+
+    // Records in the journal: replayed ones and those appended since
+    [[nodiscard]] size_t size() const { return records_; }
+
+  private:
+    bool open();
+
+    std::filesystem::path path_;
+    std::ofstream out_;
+    size_t records_{0};
+  };
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,446 @@
+#include "XmlPullParser.hpp"
+
+#include <Utils/String/TextKernels.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace dotnamebot::rss {
+
+  namespace {
+
+    constexpr std::string_view BOM = "\xEF\xBB\xBF";
+    constexpr std::string_view CDATA_OPEN = "<![CDATA[";
+    constexpr std::string_view COMMENT_OPEN = "<!--";
+    constexpr utils::ByteSet TEXT_SPECIALS{"&\r\n"};
+
+    struct XmlEntity {
+      std::string_view name;
+      char value;
+    };
+    constexpr std::array<XmlEntity, 5> XML_ENTITIES = {{
+        {"quot", '"'},
+        {"amp", '&'},
+        {"apos", '\''},
+        {"lt", '<'},
+        {"gt", '>'},
+    }};
+    // tinyxml2 encodes up to 21 bits and writes nothing for larger references
+    constexpr uint32_t MAX_ENCODABLE = 0x1FFFFF;
+
+    // isspace() for ASCII, like tinyxml2's XMLUtil::IsWhiteSpace
+    bool isWhiteSpace(char c) {
+      return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+    }
+
+    bool isNameStartChar(char c) {
+      const auto u = static_cast<unsigned char>(c);
+      return u >= 0x80 || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == ':' ||
+             c == '_';
+    }
+
+    bool isNameChar(char c) {
+      return isNameStartChar(c) || (c >= '0' && c <= '9') || c == '.' || c == '-';
+    }
+
+    size_t skipWhiteSpace(std::string_view text, size_t pos) {
+      while (pos < text.size() && isWhiteSpace(text[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    size_t skipName(std::string_view text, size_t pos) {
+      if (pos >= text.size() || !isNameStartChar(text[pos])) {
+        return pos;
+      }
+      ++pos;
+      while (pos < text.size() && isNameChar(text[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    void appendUtf8(uint32_t codePoint, std::string &out) {
+      if (codePoint < 0x80) {
+        out += static_cast<char>(codePoint);
+      } else if (codePoint < 0x800) {
+        out += static_cast<char>(0xC0 | (codePoint >> 6));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+      } else if (codePoint < 0x10000) {
+        out += static_cast<char>(0xE0 | (codePoint >> 12));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+      } else {
+        out += static_cast<char>(0xF0 | (codePoint >> 18));
+        out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+      }
+    }
+
+    // Numeric reference at the start of text ("&#353;" or "&#x161;", only a lowercase x as
+    // in tinyxml2). Returns its length, 0 when it is not a valid reference.
+    size_t decodeCharacterRef(std::string_view text, std::string &out) {
+      const bool hex = text.size() > 2 && text[2] == 'x';
+      const size_t digitsStart = hex ? 3 : 2;
+      size_t end = digitsStart;
+      uint32_t codePoint = 0;
+      bool tooLarge = false;
+      for (; end < text.size() && text[end] != ';'; ++end) {
+        const char c = text[end];
+        uint32_t digit = 0;
+        if (c >= '0' && c <= '9') {
+          digit = static_cast<uint32_t>(c - '0');
+        } else if (hex && c >= 'a' && c <= 'f') {
+          digit = static_cast<uint32_t>(c - 'a' + 10);
+        } else if (hex && c >= 'A' && c <= 'F') {
+          digit = static_cast<uint32_t>(c - 'A' + 10);
+        } else {
+          return 0;
+        }
+        if (!tooLarge) {
+          codePoint = codePoint * (hex ? 16 : 10) + digit;
+          tooLarge = codePoint > MAX_ENCODABLE;
+        }
+      }
+      // &#; and &#0; would put a NUL into tinyxml2's C string, treat them as text instead
+      if (end == text.size() || end == digitsStart || codePoint == 0) {
+        return 0;
+      }
+      if (!tooLarge) {
+        appendUtf8(codePoint, out);
+      }
+      return end + 1;
+    }
+
+    // Append raw text with line breaks normalized (\r\n, \n\r and \r become \n) and, when
+    // entities is set, XML entities and numeric references decoded
+    void appendXmlText(std::string_view raw, bool entities, std::string &out) {
+      out.reserve(out.size() + raw.size());
+      size_t pos = 0;
+      while (pos < raw.size()) {
+        const size_t special = utils::findFirstOf(raw, TEXT_SPECIALS, pos);
+        if (special == std::string_view::npos) {
+          out.append(raw.substr(pos));
+          return;
+        }
+        out.append(raw.substr(pos, special - pos));
+        pos = special;
+        const char c = raw[pos];
+        if (c == '\r' || c == '\n') {
+          const char pair = c == '\r' ? '\n' : '\r';
+          pos += (pos + 1 < raw.size() && raw[pos + 1] == pair) ? 2 : 1;
+          out += '\n';
+          continue;
+        }
+        if (!entities) {
+          out += c;
+          ++pos;
+          continue;
+        }
+
+        const std::string_view rest = raw.substr(pos);
+        size_t length = 0;
+        if (rest.size() > 1 && rest[1] == '#') {
+          length = decodeCharacterRef(rest, out);
+        } else {
+          for (const XmlEntity &entity : XML_ENTITIES) {
+            if (rest.size() > entity.name.size() + 1 &&
+                rest.substr(1, entity.name.size()) == entity.name &&
+                rest[entity.name.size() + 1] == ';') {
+              out += entity.value;
+              length = entity.name.size() + 2;
+              break;
+            }
+          }
+        }
+        if (length == 0) {
+          // Unknown entity: keep the '&' as text
+          out += '&';
+          length = 1;
+        }
+        pos += length;
+      }
+    }
+
+  } // namespace
+
+  XmlPullParser::XmlPullParser(std::string_view xml) : xml_(xml) {
+    if (xml_.starts_with(BOM)) {
+      pos_ = BOM.size();
+    }
+  }
+
+  XmlPullParser::Event XmlPullParser::next() {
+    if (event_ == Event::EndDocument || event_ == Event::Error) {
+      return event_;
+    }
+    emptyElement_ = false;
+    if (pendingEnd_) {
+      pendingEnd_ = false;
+      open_.pop_back();
+      return event_ = Event::EndElement;
+    }
+
+    while (true) {
+      if (pos_ >= xml_.size()) {
+        if (!open_.empty()) {
+          return fail("<" + std::string(open_.back()) + "> is not closed");
+        }
+        if (!started_) {
+          return fail("document is empty");
+        }
+        return event_ = Event::EndDocument;
+      }
+
+      if (xml_[pos_] != '<') {
+        const size_t lt = std::min(xml_.find('<', pos_), xml_.size());
+        const std::string_view run = xml_.substr(pos_, lt - pos_);
+        pos_ = lt;
+        // Whitespace-only runs are not text nodes; elsewhere the leading blanks stay
+        if (skipWhiteSpace(run, 0) == run.size()) {
+          continue;
+        }
+        declarationsAllowed_ = false;
+        if (atTopLevel()) {
+          continue;
+        }
+        raw_ = run;
+        return event_ = Event::Text;
+      }
+
+      const Event markup = readMarkup();
+      if (markup != Event::None) {
+        return event_ = markup;
+      }
+    }
+  }
+
+  XmlPullParser::Event XmlPullParser::readMarkup() {
+    const std::string_view rest = xml_.substr(pos_);
+    auto section = [&](std::string_view open, std::string_view close, Event kind) -> Event {
+      const size_t end = xml_.find(close, pos_ + open.size());
+      if (end == std::string_view::npos) {
+        return fail("unterminated " + std::string(open));
+      }
+      raw_ = xml_.substr(pos_ + open.size(), end - pos_ - open.size());
+      pos_ = end + close.size();
+      declarationsAllowed_ = false;
+      return atTopLevel() ? Event::None : kind;
+    };
+
+    if (rest.starts_with("<?")) {
+      if (!declarationsAllowed_) {
+        return fail("declaration after the start of the document");
+      }
+      const size_t end = xml_.find("?>", pos_ + 2);
+      if (end == std::string_view::npos) {
+        return fail("unterminated declaration");
+      }
+      pos_ = end + 2;
+      return Event::None;
+    }
+    if (rest.starts_with(COMMENT_OPEN)) {
+      return section(COMMENT_OPEN, "-->", Event::Comment);
+    }
+    if (rest.starts_with(CDATA_OPEN)) {
+      return section(CDATA_OPEN, "]]>", Event::Cdata);
+    }
+    if (rest.starts_with("<!")) {
+      // <!DOCTYPE ...> and similar, skipped up to the first '>' like tinyxml2 does
+      const size_t end = xml_.find('>', pos_ + 2);
+      if (end == std::string_view::npos) {
+        return fail("unterminated <!");
+      }
+      pos_ = end + 1;
+      declarationsAllowed_ = false;
+      return Event::None;
+    }
+    declarationsAllowed_ = false;
+    const size_t afterLt = skipWhiteSpace(xml_, pos_ + 1);
+    if (afterLt < xml_.size() && xml_[afterLt] == '/') {
+      return readEndTag();
+    }
+    return readStartTag();
+  }
+
+  XmlPullParser::Event XmlPullParser::readStartTag() {
+    const size_t nameStart = skipWhiteSpace(xml_, pos_ + 1);
+    const size_t nameEnd = skipName(xml_, nameStart);
+    if (nameEnd == nameStart) {
+      return fail("invalid element name");
+    }
+    name_ = xml_.substr(nameStart, nameEnd - nameStart);
+    attributes_.clear();
+
+    size_t at = nameEnd;
+    while (true) {
+      at = skipWhiteSpace(xml_, at);
+      if (at >= xml_.size()) {
+        return fail("unterminated <" + std::string(name_) + ">");
+      }
+      const char c = xml_[at];
+      if (c == '>') {
+        ++at;
+        break;
+      }
+      if (c == '/' && at + 1 < xml_.size() && xml_[at + 1] == '>') {
+        at += 2;
+        emptyElement_ = true;
+        break;
+      }
+      const size_t attributeEnd = skipName(xml_, at);
+      if (attributeEnd == at) {
+        return fail("invalid attribute in <" + std::string(name_) + ">");
+      }
+      const std::string_view attributeName = xml_.substr(at, attributeEnd - at);
+      at = skipWhiteSpace(xml_, attributeEnd);
+      if (at >= xml_.size() || xml_[at] != '=') {
+        return fail("attribute without value in <" + std::string(name_) + ">");
+      }
+      at = skipWhiteSpace(xml_, at + 1);
+      if (at >= xml_.size() || (xml_[at] != '"' && xml_[at] != '\'')) {
+        return fail("unquoted attribute in <" + std::string(name_) + ">");
+      }
+      const size_t close = xml_.find(xml_[at], at + 1);
+      if (close == std::string_view::npos) {
+        return fail("unterminated attribute in <" + std::string(name_) + ">");
+      }
+      for (const auto &[existing, value] : attributes_) {
+        if (existing == attributeName) {
+          return fail("duplicate attribute in <" + std::string(name_) + ">");
+        }
+      }
+      attributes_.emplace_back(attributeName, xml_.substr(at + 1, close - at - 1));
+      at = close + 1;
+    }
+
+    pos_ = at;
+    started_ = true;
+    open_.push_back(name_);
+    pendingEnd_ = emptyElement_;
+    return Event::StartElement;
+  }
+
+  XmlPullParser::Event XmlPullParser::readEndTag() {
+    const size_t nameStart = skipWhiteSpace(xml_, pos_ + 1) + 1;
+    const size_t nameEnd = skipName(xml_, nameStart);
+    const std::string_view name = xml_.substr(nameStart, nameEnd - nameStart);
+    const size_t gt = skipWhiteSpace(xml_, nameEnd);
+    if (gt >= xml_.size() || xml_[gt] != '>') {
+      return fail("malformed end tag </" + std::string(name) + ">");
+    }
+    if (open_.empty() || open_.back() != name) {
+      return fail("mismatched end tag </" + std::string(name) + ">");
+    }
+    name_ = name;
+    open_.pop_back();
+    pos_ = gt + 1;
+    return Event::EndElement;
+  }
+
+  XmlPullParser::Event XmlPullParser::fail(std::string message) {
+    error_ = "XML error at offset " + std::to_string(pos_) + ": " + message;
+    return event_ = Event::Error;
+  }
+
+  std::string XmlPullParser::text() const {
+    std::string out;
+    if (event_ == Event::Text || event_ == Event::Cdata || event_ == Event::Comment) {
+      appendXmlText(raw_, event_ == Event::Text, out);
+    }
+    return out;
+  }
+
+  bool XmlPullParser::attribute(std::string_view name, std::string &value) const {
+    if (event_ != Event::StartElement) {
+      return false;
+    }
+    for (const auto &[attributeName, raw] : attributes_) {
+      if (attributeName == name) {
+        value.clear();
+        appendXmlText(raw, true, value);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool XmlPullParser::nextChild(size_t parentDepth) {
+    while (true) {
+      switch (next()) {
+      case Event::StartElement:
+        if (depth() == parentDepth + 1) {
+          return true;
+        }
+        break;
+      case Event::EndElement:
+        if (depth() < parentDepth) {
+          return false;
+        }
+        break;
+      case Event::EndDocument:
+      case Event::Error: return false;
+      default: break;
+      }
+    }
+  }
+
+  XmlPullParser::FirstChild XmlPullParser::readElement() {
+    FirstChild child;
+    if (event_ != Event::StartElement) {
+      return child;
+    }
+    const size_t elementDepth = depth();
+    switch (next()) {
+    case Event::Text:
+      child.kind = FirstChild::Kind::Text;
+      child.value = text();
+      break;
+    case Event::Cdata:
+      child.kind = FirstChild::Kind::Cdata;
+      child.value = text();
+      break;
+    case Event::Comment:
+      child.kind = FirstChild::Kind::Comment;
+      child.value = text();
+      break;
+    case Event::StartElement:
+      child.kind = FirstChild::Kind::Element;
+      child.value = std::string(name_);
+      break;
+    default: return child; // closed right away, or an error
+    }
+    while (!(event_ == Event::EndElement && depth() < elementDepth)) {
+      if (next() == Event::Error || event_ == Event::EndDocument) {
+        break;
+      }
+    }
+    return child;
+  }
+
+  void XmlPullParser::skipElement() {
+    if (event_ != Event::StartElement) {
+      return;
+    }
+    const size_t elementDepth = depth();
+    while (true) {
+      const Event event = next();
+      if ((event == Event::EndElement && depth() < elementDepth) || event == Event::Error ||
+          event == Event::EndDocument) {
+        return;
+      }
+    }
+  }
+
+  bool XmlPullParser::finish() {
+    while (next() != Event::EndDocument) {
+      if (event_ == Event::Error) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+} // namespace dotnamebot::rss
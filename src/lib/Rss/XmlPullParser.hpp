@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dotnamebot::rss {
+
+  /**
+   * @brief Non-validating pull reader over a complete UTF-8 XML document or fragment.
+   *
+   * Reports tags, text, CDATA sections and comments in document order without building a
+   * tree, so a caller can walk the children of an element exactly once. The rules follow
+   * tinyxml2, which the feed code used before and the persisted item hashes depend on:
+   * whitespace-only text between tags is dropped, other text is kept verbatim; text and
+   * attribute values get the five XML entities and numeric references decoded and line
+   * breaks normalized to '\n'; mismatched or unclosed tags are an error for the whole
+   * document.
+   */
+  class XmlPullParser {
+  public:
+    enum class Event : std::uint8_t {
+      None, // before the first next()
+      StartElement,
+      EndElement,
+      Text,
+      Cdata,
+      Comment,
+      EndDocument,
+      Error
+    };
+
+    /**
+     * @brief First child node of an element, the node tinyxml2's FirstChild() returns
+     *
+     */
+    struct FirstChild {
+      enum class Kind : std::uint8_t { None, Text, Cdata, Element, Comment };
+
+      Kind kind{Kind::None};
+      // Decoded text, CDATA or comment content, or the name of a child element
+      std::string value;
+
+      // What XMLElement::GetText() would return: text or CDATA, otherwise nothing
+      [[nodiscard]] bool isText() const { return kind == Kind::Text || kind == Kind::Cdata; }
+      [[nodiscard]] std::string text() const { return isText() ? value : std::string(); }
+    };
+
+    explicit XmlPullParser(std::string_view xml);
+
+    /**
+     * @brief Advance to the next event. An empty element (<a/>) reports StartElement and
+     * then EndElement. EndDocument and Error are final.
+     *
+     * @return Event The new current event
+     */
+    Event next();
+
+    [[nodiscard]] Event event() const { return event_; }
+    // Tag name for StartElement and EndElement
+    [[nodiscard]] std::string_view name() const { return name_; }
+    // StartElement written as <name/>
+    [[nodiscard]] bool isEmptyElement() const { return emptyElement_; }
+    // Open elements; a start tag counts itself, an end tag no longer does
+    [[nodiscard]] size_t depth() const { return open_.size(); }
+    [[nodiscard]] const std::string &error() const { return error_; }
+
+    /**
+     * @brief Content of the current Text, Cdata or Comment event
+     *
+     * @return std::string Decoded text; CDATA and comments only get line breaks normalized
+     */
+    [[nodiscard]] std::string text() const;
+
+    /**
+     * @brief Decoded value of an attribute of the current StartElement
+     *
+     * @param name Attribute name
+     * @param value Receives the value
+     * @return true if the attribute is present, otherwise false
+     */
+    bool attribute(std::string_view name, std::string &value) const;
+
+    /**
+     * @brief Move to the next child element of the element opened at parentDepth, skipping
+     * text and the rest of any child the caller did not read
+     *
+     * @param parentDepth depth() on the parent's start tag
+     * @return true on a child's start tag, false once the parent is closed (or on error)
+     */
+    bool nextChild(size_t parentDepth);
+
+    /**
+     * @brief From a start tag, read the element's first child node and skip to its end tag
+     *
+     * @return FirstChild The first child, Kind::None for an empty element
+     */
+    FirstChild readElement();
+
+    /**
+     * @brief From a start tag, skip to the element's end tag
+     *
+     */
+    void skipElement();
+
+    /**
+     * @brief Consume the rest of the document
+     *
+     * @return true if it was well-formed, otherwise false (see error())
+     */
+    bool finish();
+
+  private:
+    Event fail(std::string message);
+    Event readStartTag();
+    Event readEndTag();
+    Event readMarkup();
+    bool atTopLevel() const { return open_.empty(); }
+
+    std::string_view xml_;
+    size_t pos_{0};
+
+    Event event_{Event::None};
+    // Whether the document has an element at all
+    bool started_{false};
+    std::string_view name_;
+    bool emptyElement_{false};
+    bool pendingEnd_{false};
+    // Raw content of the current Text, Cdata or Comment event
+    std::string_view raw_;
+    // Raw attributes of the current start tag
+    std::vector<std::pair<std::string_view, std::string_view>> attributes_;
+    std::vector<std::string_view> open_;
+    // Declarations (<?...?>) may only come before anything else, as in tinyxml2
+    bool declarationsAllowed_{true};
+    std::string error_;
+  };
+
+} // namespace dotnamebot::rss
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace dotnamebot::utils {
+
+  /**
+   * @brief Blocking FIFO with a fixed capacity, to hand work from one pipeline stage to
+   * the next. A full queue makes producers wait, so a slow consumer slows the stages
+   * before it down instead of letting work pile up in memory.
+   */
+  template <typename T>
+  class BoundedQueue {
+  public:
+    explicit BoundedQueue(size_t capacity) : capacity_(capacity > 0 ? capacity : 1) {}
+
+    /**
+     * @brief Append a value, waiting while the queue is full
+     *
+     * @param value Value to hand over
+     */
+    void push(T value) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      notFull_.wait(lock, [this]() { return items_.size() < capacity_; });
+      items_.push_back(std::move(value));
+      // Notified under the lock: the consumer may destroy the queue once it got the value
+      notEmpty_.notify_one();
+    }
+
+    /**
+     * @brief Take the oldest value, waiting while the queue is empty
+     *
+     * @return T The value
+     */
+    T pop() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      notEmpty_.wait(lock, [this]() { return !items_.empty(); });
+      T value = std::move(items_.front());
+      items_.pop_front();
+      notFull_.notify_one();
+      return value;
+    }
+
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+
+  private:
+    const size_t capacity_;
+    std::mutex mutex_;
+    std::condition_variable notFull_;
+    std::condition_variable notEmpty_;
+    std::deque<T> items_;
+  };
+
+} // namespace dotnamebot::utils
@@ -0,0 +1,150 @@
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+
+namespace dotnamebot::utils {
+
+  namespace {
+
+    // Worker running on the current thread, so submit() can use its own deque
+    thread_local const WorkerPool *currentPool = nullptr;
+    thread_local size_t currentWorker = 0;
+
+  } // namespace
+
+  WorkerPool::WorkerPool(size_t threads) {
+    if (threads == 0) {
+      threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    for (size_t i = 0; i < threads; ++i) {
+      queues_.push_back(std::make_unique<Queue>());
+    }
+    threads_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+      threads_.emplace_back([this, i]() { run(i); });
+    }
+  }
+
+  WorkerPool::~WorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void WorkerPool::submit(Task task) {
+    size_t target = 0;
+    if (currentPool == this) {
+      target = currentWorker;
+    } else {
+      target = nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    }
+    {
+      std::lock_guard<std::mutex> lock(idleMutex_);
+      unfinished_++;
+    }
+    {
+      std::lock_guard<std::mutex> lock(queues_[target]->mutex);
+      queues_[target]->tasks.push_back(std::move(task));
+    }
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex_);
+      queued_++;
+    }
+    wake_.notify_one();
+  }
+
+  void WorkerPool::wait() {
+    std::unique_lock<std::mutex> lock(idleMutex_);
+    idle_.wait(lock, [this]() { return unfinished_ == 0; });
+  }
+
+  bool WorkerPool::take(size_t self, Task &task) {
+    // Own deque newest first (its data is likely still in cache), then steal oldest first
+    {
+      Queue &own = *queues_[self];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      if (!own.tasks.empty()) {
+        task = std::move(own.tasks.back());
+        own.tasks.pop_back();
+        return true;
+      }
+    }
+    for (size_t offset = 1; offset < queues_.size(); ++offset) {
+      Queue &victim = *queues_[(self + offset) % queues_.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.tasks.empty()) {
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void WorkerPool::run(size_t self) {
+    currentPool = this;
+    currentWorker = self;
+    Task task;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wake_.wait(lock, [this]() { return queued_ > 0 || stopping_; });
+        if (queued_ == 0) {
+          return; // Stopping and nothing left to run
+        }
+      }
+      if (!take(self, task)) {
+        // Another worker took the task between the wake-up and the lookup
+        std::this_thread::yield();
+        continue;
+      }
+      {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        queued_--;
+      }
+      task();
+      task = nullptr;
+
+      std::lock_guard<std::mutex> lock(idleMutex_);
+      if (--unfinished_ == 0) {
+        idle_.notify_all();
+      }
+    }
+  }
+
+  Strand::Strand(WorkerPool &pool) : pool_(pool), state_(std::make_shared<State>()) {}
+
+  void Strand::post(WorkerPool::Task task) {
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      state_->tasks.push_back(std::move(task));
+      if (state_->scheduled) {
+        return;
+      }
+      state_->scheduled = true;
+    }
+    pool_.submit([state = state_]() { drain(state); });
+  }
+
+  void Strand::drain(const std::shared_ptr<State> &state) {
+    while (true) {
+      WorkerPool::Task task;
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->tasks.empty()) {
+          state->scheduled = false;
+          return;
+        }
+        task = std::move(state->tasks.front());
+        state->tasks.pop_front();
+      }
+      task();
+    }
+  }
+
+} // namespace dotnamebot::utils
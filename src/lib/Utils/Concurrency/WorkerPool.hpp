@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dotnamebot::utils {
+
+  /**
+   * @brief Fixed set of threads running submitted tasks, with work stealing.
+   *
+   * Every worker owns a task deque. A task submitted from a worker goes to that worker's
+   * own deque and is taken back newest first, while idle workers steal the oldest tasks
+   * from the other deques; tasks submitted from outside are spread round robin. Tasks must
+   * not throw.
+   */
+  class WorkerPool {
+  public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Start the workers
+     *
+     * @param threads Number of workers; 0 uses one per hardware thread
+     */
+    explicit WorkerPool(size_t threads = 0);
+
+    /**
+     * @brief Run every task still queued, then join the workers
+     *
+     */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    /**
+     * @brief Queue a task; it runs on one of the workers
+     *
+     * @param task Work to run
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Block until every task submitted so far, and any task they submit, has run
+     *
+     */
+    void wait();
+
+    [[nodiscard]] size_t size() const { return threads_.size(); }
+
+  private:
+    struct Queue {
+      std::mutex mutex;
+      std::deque<Task> tasks;
+    };
+
+    void run(size_t self);
+    bool take(size_t self, Task &task);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> nextQueue_{0};
+
+    // Tasks queued but not taken yet; workers sleep while it is zero
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    size_t queued_{0};
+    bool stopping_{false};
+
+    // Tasks submitted but not finished, for wait()
+    std::mutex idleMutex_;
+    std::condition_variable idle_;
+    size_t unfinished_{0};
+  };
+
+  /**
+   * @brief Runs tasks on a WorkerPool one at a time, in the order they were posted.
+   *
+   * Tasks of one strand never overlap, so state touched only from them needs no lock,
+   * while different strands run in parallel. The strand may be destroyed while its last
+   * task is still running.
+   */
+  class Strand {
+  public:
+    explicit Strand(WorkerPool &pool);
+
+    /**
+     * @brief Queue a task behind the ones already posted to this strand
+     *
+     * @param task Work to run
+     */
+    void post(WorkerPool::Task task);
+
+  private:
+    struct State {
+      std::mutex mutex;
+      std::deque<WorkerPool::Task> tasks;
+      bool scheduled{false};
+    };
+
+    static void drain(const std::shared_ptr<State> &state);
+
+    WorkerPool &pool_;
+    std::shared_ptr<State> state_;
+  };
+
+} // namespace dotnamebot::utils
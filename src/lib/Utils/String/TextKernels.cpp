@@ -0,0 +1,177 @@
+#include "TextKernels.hpp"
+
+#include <atomic>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  #define DOTNAMEBOT_TEXT_KERNELS_X86 1
+  #include <immintrin.h>
+#endif
+
+namespace dotnamebot::utils {
+
+  namespace {
+
+    constexpr size_t NPOS = std::string_view::npos;
+
+    using ScanFn = size_t (*)(const char *, size_t, size_t, const ByteSet &);
+
+    struct Kernels {
+      ScanLevel level;
+      ScanFn findFirstOf;
+      ScanFn findFirstNotOf;
+    };
+
+    // Scalar versions, also used for the tail that does not fill a vector
+    template <bool Member>
+    size_t scanScalar(const char *data, size_t size, size_t pos, const ByteSet &set) {
+      for (; pos < size; ++pos) {
+        if (set.contains(data[pos]) == Member) {
+          return pos;
+        }
+      }
+      return NPOS;
+    }
+
+#ifdef DOTNAMEBOT_TEXT_KERNELS_X86
+
+    // SSE2 is part of x86-64, so this needs no runtime check
+    template <bool Member>
+    size_t scanSse2(const char *data, size_t size, size_t pos, const ByteSet &set) {
+      __m128i needles[ByteSet::MAX_SIZE];
+      for (size_t k = 0; k < set.size(); ++k) {
+        needles[k] = _mm_set1_epi8(set[k]);
+      }
+      for (; pos + 16 <= size; pos += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos));
+        __m128i hits = _mm_setzero_si128();
+        for (size_t k = 0; k < set.size(); ++k) {
+          hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, needles[k]));
+        }
+        auto mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        if constexpr (!Member) {
+          mask = ~mask & 0xFFFFU;
+        }
+        if (mask != 0) {
+          return pos + static_cast<size_t>(__builtin_ctz(mask));
+        }
+      }
+      return scanScalar<Member>(data, size, pos, set);
+    }
+
+    // Everything here is VEX encoded, including the 16-byte step and the scalar tail; a
+    // call into the SSE2 kernel with dirty upper halves would cost a state transition
+    template <bool Member>
+    __attribute__((target("avx2"))) size_t scanAvx2(const char *data, size_t size, size_t pos,
+                                                    const ByteSet &set) {
+      if (size - pos >= 32) {
+        __m256i needles[ByteSet::MAX_SIZE];
+        for (size_t k = 0; k < set.size(); ++k) {
+          needles[k] = _mm256_set1_epi8(set[k]);
+        }
+        for (; pos + 32 <= size; pos += 32) {
+          const __m256i chunk =
+              _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + pos));
+          __m256i hits = _mm256_setzero_si256();
+          for (size_t k = 0; k < set.size(); ++k) {
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(chunk, needles[k]));
+          }
+          auto mask = static_cast<unsigned>(_mm256_movemask_epi8(hits));
+          if constexpr (!Member) {
+            mask = ~mask;
+          }
+          if (mask != 0) {
+            return pos + static_cast<size_t>(__builtin_ctz(mask));
+          }
+        }
+      }
+      if (size - pos >= 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos));
+        __m128i hits = _mm_setzero_si128();
+        for (size_t k = 0; k < set.size(); ++k) {
+          hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(set[k])));
+        }
+        auto mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        if constexpr (!Member) {
+          mask = ~mask & 0xFFFFU;
+        }
+        if (mask != 0) {
+          return pos + static_cast<size_t>(__builtin_ctz(mask));
+        }
+        pos += 16;
+      }
+      for (; pos < size; ++pos) {
+        if (set.contains(data[pos]) == Member) {
+          return pos;
+        }
+      }
+      return NPOS;
+    }
+
+#endif
+
+    constexpr Kernels SCALAR_KERNELS{ScanLevel::Scalar, scanScalar<true>, scanScalar<false>};
+#ifdef DOTNAMEBOT_TEXT_KERNELS_X86
+    constexpr Kernels SSE2_KERNELS{ScanLevel::Sse2, scanSse2<true>, scanSse2<false>};
+    constexpr Kernels AVX2_KERNELS{ScanLevel::Avx2, scanAvx2<true>, scanAvx2<false>};
+#endif
+
+    const Kernels *kernelsFor(ScanLevel level) {
+#ifdef DOTNAMEBOT_TEXT_KERNELS_X86
+      switch (level) {
+      case ScanLevel::Avx2:
+        if (__builtin_cpu_supports("avx2")) {
+          return &AVX2_KERNELS;
+        }
+        return &SSE2_KERNELS;
+      case ScanLevel::Sse2: return &SSE2_KERNELS;
+      case ScanLevel::Scalar: break;
+      }
+#else
+      (void)level;
+#endif
+      return &SCALAR_KERNELS;
+    }
+
+    std::atomic<const Kernels *> &activeKernels() {
+      static std::atomic<const Kernels *> kernels{kernelsFor(ScanLevel::Avx2)};
+      return kernels;
+    }
+
+  } // namespace
+
+  size_t findFirstOf(std::string_view text, const ByteSet &set, size_t pos) {
+    if (pos >= text.size()) {
+      return NPOS;
+    }
+    return activeKernels().load(std::memory_order_relaxed)->findFirstOf(text.data(), text.size(),
+                                                                        pos, set);
+  }
+
+  size_t findFirstNotOf(std::string_view text, const ByteSet &set, size_t pos) {
+    if (pos >= text.size()) {
+      return NPOS;
+    }
+    return activeKernels().load(std::memory_order_relaxed)->findFirstNotOf(
+        text.data(), text.size(), pos, set);
+  }
+
+  ScanLevel scanLevel() { return activeKernels().load(std::memory_order_relaxed)->level; }
+
+  ScanLevel bestScanLevel() { return kernelsFor(ScanLevel::Avx2)->level; }
+
+  const char *scanLevelName(ScanLevel level) {
+    switch (level) {
+    case ScanLevel::Scalar: return "scalar";
+    case ScanLevel::Sse2: return "sse2";
+    case ScanLevel::Avx2: return "avx2";
+    }
+    return "unknown";
+  }
+
+  ScanLevel setScanLevel(ScanLevel level) {
+    const Kernels *kernels = kernelsFor(level);
+    activeKernels().store(kernels, std::memory_order_relaxed);
+    return kernels->level;
+  }
+
+} // namespace dotnamebot::utils
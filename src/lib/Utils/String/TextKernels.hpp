@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+namespace dotnamebot::utils {
+
+  /**
+   * @brief Small set of bytes to scan for, e.g. "&;" or the whitespace characters.
+   *
+   * Holds both the list (for the vector kernels, one compare per byte) and a lookup table
+   * (for the scalar code and the tail of every scan).
+   */
+  class ByteSet {
+  public:
+    static constexpr size_t MAX_SIZE = 8;
+
+    constexpr explicit ByteSet(std::string_view bytes) {
+      for (char c : bytes) {
+        if (contains(c)) {
+          continue;
+        }
+        if (size_ == MAX_SIZE) {
+          // Fails to compile for a constexpr ByteSet
+          throw std::length_error("ByteSet holds at most MAX_SIZE bytes");
+        }
+        bytes_[size_++] = c;
+        table_[static_cast<unsigned char>(c)] = true;
+      }
+    }
+
+    [[nodiscard]] constexpr bool contains(char c) const {
+      return table_[static_cast<unsigned char>(c)];
+    }
+    [[nodiscard]] constexpr size_t size() const { return size_; }
+    [[nodiscard]] constexpr char operator[](size_t index) const { return bytes_[index]; }
+
+  private:
+    std::array<char, MAX_SIZE> bytes_{};
+    size_t size_{0};
+    std::array<bool, 256> table_{};
+  };
+
+  inline constexpr ByteSet WHITESPACE_BYTES{" \t\n\v\f\r"};
+
+  /**
+   * @brief Instruction set used by the scan kernels. Picked once from the CPU at startup.
+   *
+   */
+  enum class ScanLevel : std::uint8_t { Scalar, Sse2, Avx2 };
+
+  /**
+   * @brief Position of the first byte at or after pos that is in set
+   *
+   * @return size_t The position, std::string_view::npos when there is none
+   */
+  size_t findFirstOf(std::string_view text, const ByteSet &set, size_t pos = 0);
+
+  /**
+   * @brief Position of the first byte at or after pos that is not in set
+   *
+   * @return size_t The position, std::string_view::npos when there is none
+   */
+  size_t findFirstNotOf(std::string_view text, const ByteSet &set, size_t pos = 0);
+
+  [[nodiscard]] ScanLevel scanLevel();
+  [[nodiscard]] ScanLevel bestScanLevel();
+  [[nodiscard]] const char *scanLevelName(ScanLevel level);
+
+  /**
+   * @brief Switch the kernels, for tests and benchmarks
+   *
+   * @param level Requested level; anything the CPU lacks falls back to bestScanLevel()
+   * @return ScanLevel The level now in use
+   */
+  ScanLevel setScanLevel(ScanLevel level);
+
+} // namespace dotnamebot::utils
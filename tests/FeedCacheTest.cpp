@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/FeedCache.hpp"
+
+#include <filesystem>
+
+using dotnamebot::rss::BodyHash;
+using dotnamebot::rss::FeedCache;
+using dotnamebot::rss::RSSUrl;
+
+namespace {
+
+  std::filesystem::path freshCacheDir() {
+    auto dir = std::filesystem::temp_directory_path() / "DotNameBotFeedCacheTest";
+    std::filesystem::remove_all(dir);
+    return dir;
+  }
+
+} // namespace
+
+TEST(FeedCacheTest, BodyHashIsIndependentOfChunking) {
+  const std::string body = "<rss><channel><item><title>A</title></item></channel></rss>";
+  BodyHash whole;
+  whole.update(body);
+
+  BodyHash chunked;
+  for (size_t i = 0; i < body.size(); i += 7) {
+    chunked.update(std::string_view(body).substr(i, 7));
+  }
+  EXPECT_EQ(whole.hex(), chunked.hex());
+  EXPECT_EQ(whole.size(), body.size());
+
+  BodyHash other;
+  other.update(body.substr(0, body.size() - 1) + "!");
+  EXPECT_NE(whole.hex(), other.hex());
+  EXPECT_TRUE(BodyHash{}.hex().empty());
+}
+
+TEST(FeedCacheTest, StoreLoadAndPrune) {
+  const auto dir = freshCacheDir();
+  FeedCache cache(dir);
+
+  std::string body;
+  EXPECT_FALSE(cache.load("https://a.example/feed", body));
+
+  ASSERT_TRUE(cache.store("https://a.example/feed", "first"));
+  ASSERT_TRUE(cache.store("https://a.example/feed", "second body"));
+  ASSERT_TRUE(cache.store("https://b.example/feed?x=1&y=/", "other"));
+  ASSERT_TRUE(cache.load("https://a.example/feed", body));
+  EXPECT_EQ(body, "second body");
+  EXPECT_NE(cache.pathFor("https://a.example/feed"), cache.pathFor("https://b.example/feed"));
+
+  EXPECT_EQ(cache.prune({RSSUrl("https://a.example/feed")}), 1U);
+  EXPECT_TRUE(cache.load("https://a.example/feed", body));
+  EXPECT_FALSE(cache.load("https://b.example/feed?x=1&y=/", body));
+
+  std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/FeedEncoding.hpp"
+
+#include <string>
+#include <string_view>
+
+using namespace dotnamebot::rss;
+
+TEST(FeedEncodingTest, ReadsTheEncodingFromTheDeclarationOnly) {
+  const std::string document = "\xEF\xBB\xBF\n<?xml version=\"1.0\" encoding = 'windows-1250' ?>"
+                               "<rss encoding=\"UTF-8\"/>";
+  const XmlProlog prolog = scanXmlProlog(document);
+  EXPECT_EQ(prolog.bomSize, 3);
+  EXPECT_EQ(prolog.encoding, "windows-1250");
+  EXPECT_EQ(document.substr(prolog.encodingAt, prolog.encoding.size()), "windows-1250");
+  EXPECT_FALSE(prolog.incomplete);
+
+  // Only a declaration at the start counts
+  EXPECT_TRUE(scanXmlProlog("<rss><?xml encoding=\"windows-1250\"?></rss>").encoding.empty());
+  EXPECT_TRUE(scanXmlProlog("<?xml version=\"1.0\"?><rss/>").encoding.empty());
+  EXPECT_TRUE(scanXmlProlog("<?xml encoding=windows-1250?>").encoding.empty());
+  // A declaration that does not end within the first kilobyte is ignored
+  EXPECT_TRUE(
+      scanXmlProlog("<?xml " + std::string(2000, ' ') + "encoding=\"windows-1250\"?>")
+          .encoding.empty());
+}
+
+TEST(FeedEncodingTest, WaitsForAPrologSplitAcrossChunks) {
+  EXPECT_TRUE(scanXmlProlog("", false).incomplete);
+  EXPECT_TRUE(scanXmlProlog("\xEF\xBB", false).incomplete);
+  EXPECT_TRUE(scanXmlProlog("<?x", false).incomplete);
+  EXPECT_TRUE(scanXmlProlog("<?xml version=\"1.0\" enc", false).incomplete);
+  EXPECT_FALSE(scanXmlProlog("<rss>", false).incomplete);
+  EXPECT_FALSE(scanXmlProlog("<?x", true).incomplete);
+}
+
+TEST(FeedEncodingTest, RecognisesUtf8CompatibleEncodings) {
+  EXPECT_TRUE(isUtf8Compatible(""));
+  EXPECT_TRUE(isUtf8Compatible("utf-8"));
+  EXPECT_TRUE(isUtf8Compatible("US-ASCII"));
+  EXPECT_FALSE(isUtf8Compatible("windows-1250"));
+  EXPECT_FALSE(isUtf8Compatible("UTF-16"));
+}
+
+TEST(FeedEncodingTest, ReusesConvertersAndGrowsTheOutput) {
+  const iconv_t converter = cachedUtf8Converter("ISO-8859-2");
+  ASSERT_NE(converter, reinterpret_cast<iconv_t>(-1));
+  EXPECT_EQ(cachedUtf8Converter("iso-8859-2"), converter);
+  EXPECT_EQ(cachedUtf8Converter("no-such-encoding"), reinterpret_cast<iconv_t>(-1));
+
+  // Every byte becomes two, more than the initial guess
+  const std::string latin2(5000, '\xB9'); // š
+  std::string out = "prefix:";
+  ASSERT_TRUE(appendAsUtf8(converter, latin2, out));
+  EXPECT_EQ(out.size(), 7 + 10000);
+  EXPECT_EQ(out.substr(7, 4), "šš");
+
+  std::string invalid;
+  // A lone surrogate at the end is a truncated sequence
+  const std::string_view loneSurrogate("\x00\xD8", 2);
+  EXPECT_FALSE(appendAsUtf8(cachedUtf8Converter("UTF-16LE"), loneSurrogate, invalid));
+}
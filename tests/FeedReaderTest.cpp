@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/FeedReader.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace dotnamebot::rss;
+
+namespace {
+
+  struct ReadFeed {
+    bool ok{false};
+    RSSFeed feed;
+    std::vector<RSSItem> items;
+    std::string error;
+  };
+
+  ReadFeed read(std::string_view xml) {
+    ReadFeed result;
+    result.ok = readFeedDocument(
+        xml, result.feed,
+        [&result](RSSItem &&item) {
+          result.items.push_back(std::move(item));
+          return true;
+        },
+        result.error);
+    return result;
+  }
+
+} // namespace
+
+TEST(FeedReaderTest, ReadsRssHeaderAndItems) {
+  const ReadFeed result = read(R"(<?xml version="1.0"?>
+<rss version="2.0" xmlns:media="http://search.yahoo.com/mrss/">
+  <channel>
+    <title>Channel</title>
+    <link>https://example.com/</link>
+    <description>About</description>
+    <ttl>30</ttl>
+    <item>
+      <title><![CDATA[First &amp; <b>best</b>]]></title>
+      <link>https://example.com/1</link>
+      <description>&lt;p&gt;&lt;img src="https://example.com/d.jpg"&gt;Text&lt;/p&gt;</description>
+      <pubDate>Mon, 02 Jan 2006 15:04:05 GMT</pubDate>
+    </item>
+    <item><title>Second</title><link>https://example.com/2</link>
+      <media:content url="https://example.com/m.png" medium="image"/></item>
+    <title>ignored, the first title wins</title>
+  </channel>
+</rss>)");
+  ASSERT_TRUE(result.ok) << result.error;
+  EXPECT_EQ(result.feed.headTitle, "Channel");
+  EXPECT_EQ(result.feed.headLink, "https://example.com/");
+  EXPECT_EQ(result.feed.headDescription, "About");
+  EXPECT_EQ(result.feed.updateHintSeconds, 1800);
+
+  ASSERT_EQ(result.items.size(), 2U);
+  EXPECT_EQ(result.items[0].title, "First & best");
+  EXPECT_EQ(result.items[0].url, "https://example.com/1");
+  EXPECT_EQ(result.items[0].description, "Text");
+  EXPECT_EQ(result.items[0].rssMedia.url, "https://example.com/d.jpg");
+  EXPECT_EQ(result.items[0].rssMedia.type, "image/");
+  EXPECT_EQ(result.items[0].pubDate, "Mon, 02 Jan 2006 15:04:05 GMT");
+  EXPECT_EQ(result.items[1].rssMedia.url, "https://example.com/m.png");
+  EXPECT_EQ(result.items[1].rssMedia.type, "image/");
+}
+
+TEST(FeedReaderTest, LaterMediaSourcesOverrideEarlierOnes) {
+  RSSItem item;
+  ASSERT_TRUE(readFeedItem(R"(<item><title>t</title>
+    <szn:image><szn:url>https://example.com/s.jpg</szn:url></szn:image>
+    <enclosure url="https://example.com/e.mp3" type="audio/mpeg"/>
+    <media:content url="https://example.com/m.jpg" type="image/jpeg"/></item>)",
+                           FeedFormat::Rss, item));
+  // Document order does not matter: media:content, then enclosure, then szn:image
+  EXPECT_EQ(item.rssMedia.url, "https://example.com/s.jpg");
+  EXPECT_EQ(item.rssMedia.type, "image/");
+
+  ASSERT_TRUE(readFeedItem("<item><enclosure url='https://example.com/e.mp3' type='audio/mpeg'/>"
+                           "<media:content url='https://example.com/m.jpg'/></item>",
+                           FeedFormat::Rss, item));
+  EXPECT_EQ(item.rssMedia.url, "https://example.com/e.mp3");
+  EXPECT_EQ(item.rssMedia.type, "audio/mpeg");
+}
+
+TEST(FeedReaderTest, ReadsRdfItemsNextToTheChannel) {
+  const ReadFeed result = read(R"(<rdf:RDF xmlns:rdf="http://www.w3.org/1999/02/22-rdf-syntax-ns#"
+    xmlns:sy="http://purl.org/rss/1.0/modules/syndication/">
+  <channel><title>RDF</title><sy:updatePeriod> daily </sy:updatePeriod>
+    <sy:updateFrequency>4</sy:updateFrequency></channel>
+  <item><title>One</title><link>https://example.com/1</link></item>
+  <item><title>Two</title><link>https://example.com/2</link></item>
+</rdf:RDF>)");
+  ASSERT_TRUE(result.ok) << result.error;
+  EXPECT_EQ(result.feed.headTitle, "RDF");
+  EXPECT_EQ(result.feed.updateHintSeconds, 86400 / 4);
+  ASSERT_EQ(result.items.size(), 2U);
+  EXPECT_EQ(result.items[1].title, "Two");
+}
+
+TEST(FeedReaderTest, ReadsAtomEntries) {
+  const ReadFeed result = read(R"(<feed xmlns="http://www.w3.org/2005/Atom">
+  <title>Blog</title><subtitle>Notes</subtitle><link href="https://example.com/"/>
+  <entry>
+    <title type="html">&lt;i&gt;Post&lt;/i&gt;</title>
+    <link rel="self" href="https://example.com/self"/>
+    <link rel="alternate" href="https://example.com/post"/>
+    <summary>Short</summary>
+    <content type="html">&lt;img src="https://example.com/c.jpg"&gt;Long</content>
+    <published>2024-01-01T00:00:00Z</published>
+    <updated>2024-01-02T00:00:00Z</updated>
+  </entry>
+  <entry><title>Plain</title><link href="https://example.com/plain"/></entry>
+</feed>)");
+  ASSERT_TRUE(result.ok) << result.error;
+  EXPECT_EQ(result.feed.headTitle, "Blog");
+  EXPECT_EQ(result.feed.headDescription, "Notes");
+  EXPECT_EQ(result.feed.headLink, "https://example.com/");
+
+  ASSERT_EQ(result.items.size(), 2U);
+  EXPECT_EQ(result.items[0].title, "Post");
+  EXPECT_EQ(result.items[0].url, "https://example.com/post");
+  EXPECT_EQ(result.items[0].description, "Short");
+  EXPECT_EQ(result.items[0].rssMedia.url, "https://example.com/c.jpg");
+  EXPECT_EQ(result.items[0].pubDate, "2024-01-02T00:00:00Z");
+  EXPECT_EQ(result.items[1].url, "https://example.com/plain");
+}
+
+TEST(FeedReaderTest, RejectsDocumentsWithoutAFeed) {
+  EXPECT_FALSE(read("<html><body/></html>").ok);
+  EXPECT_FALSE(read("<rss><item><title>no channel</title></item></rss>").ok);
+
+  // An error anywhere rejects the whole document, as a DOM parse would
+  const ReadFeed broken = read("<rss><channel><title>x</title><item></channel></rss>");
+  EXPECT_FALSE(broken.ok);
+  EXPECT_FALSE(broken.error.empty());
+}
+
+TEST(FeedReaderTest, StopsWhenTheItemHandlerSaysSo) {
+  RSSFeed feed;
+  std::string error;
+  std::vector<std::string> titles;
+  const bool ok = readFeedDocument(
+      "<rss><channel><title>t</title><item><title>1</title></item>"
+      "<item><title>2</title></item><item><title>3</title></item><ttl>5</ttl><broken>",
+      feed,
+      [&titles](RSSItem &&item) {
+        titles.emplace_back(item.title);
+        return titles.size() < 2;
+      },
+      error);
+  ASSERT_TRUE(ok) << error;
+  EXPECT_EQ(titles, (std::vector<std::string>{"1", "2"}));
+  EXPECT_EQ(feed.headTitle, "t");
+  // Header fields after the stop are not read
+  EXPECT_EQ(feed.updateHintSeconds, 0);
+}
+
+TEST(FeedReaderTest, ReadsJsonFeeds) {
+  const ReadFeed result = read(R"({
+  "version": "https://jsonfeed.org/version/1.1",
+  "title": "Blog", "description": "Notes", "home_page_url": "https://example.com/",
+  "authors": [{"name": "Ann", "url": "https://example.com/ann"}],
+  "items": [
+    {"id": "1", "title": "Post", "url": "https://example.com/post",
+     "content_html": "<p><img src=\"https://example.com/c.jpg\">Long &amp; rich</p>",
+     "date_published": "2024-01-01T00:00:00Z", "date_modified": "2024-01-02T00:00:00Z",
+     "tags": ["a", "b"]},
+    {"id": "2", "title": "Cast", "external_url": "https://example.com/ext",
+     "summary": "Short", "content_text": "Long",
+     "attachments": [{"url": "https://example.com/a.mp3", "mime_type": "audio/mpeg"},
+                     {"url": "https://example.com/b.mp3", "mime_type": "audio/mpeg"}]},
+    {"id": "3", "title": "Picture", "url": "https://example.com/3",
+     "image": "https://example.com/i.png",
+     "attachments": [{"url": "https://example.com/a.mp3", "mime_type": "audio/mpeg"}]}
+  ]
+})");
+  ASSERT_TRUE(result.ok) << result.error;
+  EXPECT_EQ(result.feed.headTitle, "Blog");
+  EXPECT_EQ(result.feed.headDescription, "Notes");
+  EXPECT_EQ(result.feed.headLink, "https://example.com/");
+
+  ASSERT_EQ(result.items.size(), 3U);
+  EXPECT_EQ(result.items[0].title, "Post");
+  EXPECT_EQ(result.items[0].url, "https://example.com/post");
+  EXPECT_EQ(result.items[0].description, "Long & rich");
+  EXPECT_EQ(result.items[0].rssMedia.url, "https://example.com/c.jpg");
+  EXPECT_EQ(result.items[0].rssMedia.type, "image/");
+  EXPECT_EQ(result.items[0].pubDate, "2024-01-01T00:00:00Z");
+
+  EXPECT_EQ(result.items[1].url, "https://example.com/ext");
+  EXPECT_EQ(result.items[1].description, "Short");
+  EXPECT_EQ(result.items[1].rssMedia.url, "https://example.com/a.mp3");
+  EXPECT_EQ(result.items[1].rssMedia.type, "audio/mpeg");
+
+  EXPECT_EQ(result.items[2].rssMedia.url, "https://example.com/i.png");
+  EXPECT_EQ(result.items[2].rssMedia.type, "image/");
+}
+
+TEST(FeedReaderTest, RejectsJsonThatIsNotAFeed) {
+  EXPECT_FALSE(read(R"({"title": "no version", "items": []})").ok);
+  EXPECT_FALSE(read(R"({"version": "https://jsonfeed.org/version/1.1", "items": [)").ok);
+  EXPECT_TRUE(read(R"({"version": "https://jsonfeed.org/version/1", "items": []})").ok);
+}
+
+TEST(FeedReaderTest, DetectsTheFormatBeforeParsing) {
+  EXPECT_EQ(detectFeedFormat("", "\xEF\xBB\xBF  {\"version\": 1}"), FeedFormat::JsonFeed);
+  EXPECT_EQ(detectFeedFormat("application/json", "<?xml version=\"1.0\"?>\n<!-- c -->\n"
+                                                 "<!DOCTYPE rss><rss version=\"2.0\">"),
+            FeedFormat::Rss);
+  EXPECT_EQ(detectFeedFormat("", "<rdf:RDF xmlns:rdf=\"x\">"), FeedFormat::Rdf);
+  EXPECT_EQ(detectFeedFormat("", "<feed xmlns=\"http://www.w3.org/2005/Atom\">"),
+            FeedFormat::Atom);
+  EXPECT_EQ(detectFeedFormat("", "<html>"), FeedFormat::Unknown);
+
+  // The Content-Type only decides when the start of the document does not
+  EXPECT_EQ(detectFeedFormat("application/feed+json; charset=utf-8", ""), FeedFormat::JsonFeed);
+  EXPECT_EQ(detectFeedFormat("Application/Atom+XML", "<!-- " + std::string(5000, '-')),
+            FeedFormat::Atom);
+  EXPECT_EQ(detectFeedFormat("application/json", "<!-- " + std::string(5000, '-')),
+            FeedFormat::Unknown);
+}
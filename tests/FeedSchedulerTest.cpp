@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/FeedScheduler.hpp"
+
+using dotnamebot::rss::FeedPollResult;
+using dotnamebot::rss::FeedScheduler;
+using dotnamebot::rss::RSSFeedState;
+using dotnamebot::rss::RssOptions;
+using dotnamebot::rss::RSSUrl;
+
+namespace {
+
+  RssOptions testOptions() {
+    RssOptions options;
+    options.defaultPollSeconds = 3600;
+    options.minPollSeconds = 300;
+    options.maxPollSeconds = 6 * 3600;
+    return options;
+  }
+
+  // Item dates spaced evenly, newest one at now
+  std::vector<time_t> evenlySpaced(time_t now, int count, time_t spacing) {
+    std::vector<time_t> times;
+    for (int i = 0; i < count; ++i) {
+      times.push_back(now - (i * spacing));
+    }
+    return times;
+  }
+
+} // namespace
+
+TEST(FeedSchedulerTest, UnknownFeedIsDue) {
+  FeedScheduler scheduler(testOptions());
+  const auto now = FeedScheduler::Clock::now();
+  EXPECT_TRUE(scheduler.isDue("https://example.com/feed", now));
+  EXPECT_EQ(scheduler.timeUntilNextDue({RSSUrl("https://example.com/feed")}, now).count(), 0);
+}
+
+TEST(FeedSchedulerTest, EstimatePublishRateNeedsTwoDatedItems) {
+  const time_t now = 1'800'000'000;
+  EXPECT_LT(FeedScheduler::estimatePublishRate({}, now), 0.0);
+  EXPECT_LT(FeedScheduler::estimatePublishRate({now, 0}, now), 0.0);
+  // 10 items over the last 10 hours (oldest 9 h ago, measured to now with a 1 h floor)
+  EXPECT_NEAR(FeedScheduler::estimatePublishRate(evenlySpaced(now, 10, 3600), now), 10.0 / 9.0,
+              1e-9);
+}
+
+TEST(FeedSchedulerTest, BusyFeedPolledMoreOftenThanQuietFeed) {
+  FeedScheduler scheduler(testOptions());
+  const auto now = FeedScheduler::Clock::now();
+  const time_t nowT = FeedScheduler::Clock::to_time_t(now);
+
+  RSSUrl busy("https://busy.example/feed");
+  RSSFeedState busyState;
+  FeedPollResult busyPoll{true, {}, 20, evenlySpaced(nowT, 20, 600), 0};
+  long busyInterval = scheduler.recordPoll(busy, busyState, busyPoll, now);
+
+  RSSUrl quiet("https://quiet.example/feed");
+  RSSFeedState quietState;
+  FeedPollResult quietPoll{true, {}, 5, evenlySpaced(nowT, 5, 7 * 86400), 0};
+  long quietInterval = scheduler.recordPoll(quiet, quietState, quietPoll, now);
+
+  EXPECT_NEAR(busyInterval, 570, 1); // 20 items in 190 minutes
+  EXPECT_EQ(quietInterval, 6 * 3600);
+  EXPECT_FALSE(scheduler.isDue(busy.url, now));
+  EXPECT_TRUE(scheduler.isDue(busy.url, now + std::chrono::seconds(busyInterval * 2)));
+}
+
+TEST(FeedSchedulerTest, QuietPollsBackOffWithinBounds) {
+  FeedScheduler scheduler(testOptions());
+  RSSUrl rssUrl("https://example.com/feed");
+  rssUrl.maxPollSeconds = 7200;
+  RSSFeedState state;
+  auto now = FeedScheduler::Clock::now();
+
+  long interval = scheduler.recordPoll(rssUrl, state, {true, {}, 0, {}, 0}, now);
+  EXPECT_EQ(interval, 3600);
+  for (int i = 0; i < 5; ++i) {
+    now += std::chrono::seconds(interval);
+    long next = scheduler.recordPoll(rssUrl, state, {true, {}, 0, {}, 0}, now);
+    EXPECT_GE(next, interval);
+    interval = next;
+  }
+  EXPECT_EQ(interval, 7200);
+}
+
+TEST(FeedSchedulerTest, UpdateHintIsALowerBound) {
+  FeedScheduler scheduler(testOptions());
+  const auto now = FeedScheduler::Clock::now();
+  RSSUrl rssUrl("https://example.com/feed");
+  RSSFeedState state;
+  state.updateHintSeconds = 3 * 3600;
+
+  FeedPollResult poll{true, {}, 20, evenlySpaced(FeedScheduler::Clock::to_time_t(now), 20, 600),
+                      0};
+  EXPECT_EQ(scheduler.recordPoll(rssUrl, state, poll, now), 3 * 3600);
+}
+
+TEST(FeedSchedulerTest, FailedPollKeepsInterval) {
+  FeedScheduler scheduler(testOptions());
+  const auto now = FeedScheduler::Clock::now();
+  RSSUrl rssUrl("https://example.com/feed");
+  RSSFeedState state;
+  state.pollSeconds = 1200;
+  state.publishRate = 3.0;
+
+  EXPECT_EQ(scheduler.recordPoll(rssUrl, state, {false, {}, 0, {}, 0}, now), 1200);
+  EXPECT_DOUBLE_EQ(state.publishRate, 3.0);
+  EXPECT_EQ(state.pollSeconds, 1200);
+}
+
+TEST(FeedSchedulerTest, RetryAfterDelaysNextPoll) {
+  FeedScheduler scheduler(testOptions());
+  const auto now = FeedScheduler::Clock::now();
+  RSSUrl rssUrl("https://example.com/feed");
+  RSSFeedState state;
+  state.pollSeconds = 600;
+
+  scheduler.recordPoll(rssUrl, state, {false, {}, 0, {}, 7200}, now);
+  EXPECT_EQ(state.consecutiveFailures, 0);
+  EXPECT_FALSE(scheduler.isDue(rssUrl.url, now + std::chrono::seconds(3600)));
+  EXPECT_TRUE(scheduler.isDue(rssUrl.url, now + std::chrono::seconds(7200)));
+}
+
+TEST(FeedSchedulerTest, CircuitOpensAfterRepeatedFailuresAndClosesOnSuccess) {
+  FeedScheduler scheduler(testOptions());
+  RSSUrl rssUrl("https://dead.example/feed");
+  RSSFeedState state;
+  state.pollSeconds = 600;
+  auto now = FeedScheduler::Clock::now();
+
+  for (int i = 0; i < 2; ++i) {
+    scheduler.recordPoll(rssUrl, state, {false, "Timeout was reached", 0, {}, 0}, now);
+    EXPECT_FALSE(scheduler.isSuspended(state, now));
+  }
+  scheduler.recordPoll(rssUrl, state, {false, "Timeout was reached", 0, {}, 0}, now);
+  EXPECT_EQ(state.consecutiveFailures, 3);
+  EXPECT_EQ(state.lastError, "Timeout was reached");
+  ASSERT_TRUE(scheduler.isSuspended(state, now));
+  // First backoff doubles the interval, jittered into its upper half
+  const int64_t nowT = FeedScheduler::Clock::to_time_t(now);
+  EXPECT_GE(state.retryAt, nowT + 600);
+  EXPECT_LE(state.retryAt, nowT + 1200);
+  EXPECT_FALSE(scheduler.isDue(rssUrl.url, now + std::chrono::seconds(599)));
+
+  // Every further failure doubles the backoff
+  now += std::chrono::seconds(1200);
+  scheduler.recordPoll(rssUrl, state, {false, "HTTP 404", 0, {}, 0}, now);
+  EXPECT_GE(state.retryAt, FeedScheduler::Clock::to_time_t(now) + 1200);
+
+  now += std::chrono::seconds(2400);
+  scheduler.recordPoll(rssUrl, state, {true, {}, 0, {}, 0}, now);
+  EXPECT_EQ(state.consecutiveFailures, 0);
+  EXPECT_TRUE(state.lastError.empty());
+  EXPECT_FALSE(scheduler.isSuspended(state, now));
+}
+
+TEST(FeedSchedulerTest, RestoreKeepsOpenCircuitAcrossRestarts) {
+  const auto now = FeedScheduler::Clock::now();
+  RSSFeedState state;
+  state.consecutiveFailures = 5;
+  state.retryAt = FeedScheduler::Clock::to_time_t(now) + 3600;
+
+  FeedScheduler scheduler(testOptions());
+  scheduler.restore("https://dead.example/feed", state, now);
+  EXPECT_FALSE(scheduler.isDue("https://dead.example/feed", now));
+  EXPECT_TRUE(scheduler.isDue("https://dead.example/feed", now + std::chrono::seconds(3600)));
+
+  scheduler.reset("https://dead.example/feed", state);
+  EXPECT_TRUE(scheduler.isDue("https://dead.example/feed", now));
+  EXPECT_FALSE(scheduler.isSuspended(state, now));
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/FeedStreamParser.hpp"
+
+#include <string>
+#include <vector>
+
+using dotnamebot::rss::FeedFormat;
+using dotnamebot::rss::FeedStreamParser;
+using dotnamebot::rss::RSSFeed;
+using dotnamebot::rss::RSSItem;
+
+namespace {
+
+  struct ParsedFeed {
+    bool ok{false};
+    FeedFormat format{FeedFormat::Unknown};
+    std::string title;
+    std::vector<std::string> itemTitles;
+    std::string error;
+  };
+
+  // Feeds the document in chunks of the given size, as the curl write callback would
+  ParsedFeed parseInChunks(const std::string &document, size_t chunkSize) {
+    ParsedFeed result;
+    FeedStreamParser parser(
+        [&result](RSSFeed &&header, FeedFormat format) {
+          result.format = format;
+          result.title = header.headTitle;
+        },
+        [&result](RSSItem &&item) {
+          result.itemTitles.emplace_back(item.title);
+          return true;
+        });
+    for (size_t i = 0; i < document.size(); i += chunkSize) {
+      parser.write(std::string_view(document).substr(i, chunkSize));
+    }
+    result.ok = parser.finish();
+    result.error = parser.error();
+    return result;
+  }
+
+  const std::string rssDocument = R"(<?xml version="1.0" encoding="UTF-8"?>
+<!-- generated -->
+<rss version="2.0">
+  <channel>
+    <title>Zprávičky</title>
+    <item><title>První</title><description><![CDATA[<p>not the end: </item></p>]]></description></item>
+    <item><title>Druhá</title><!-- </item> --></item>
+  </channel>
+</rss>)";
+
+} // namespace
+
+TEST(FeedStreamParserTest, EmitsItemsRegardlessOfChunkBoundaries) {
+  for (size_t chunkSize : {1U, 7U, 64U, 4096U}) {
+    const ParsedFeed feed = parseInChunks(rssDocument, chunkSize);
+    ASSERT_TRUE(feed.ok) << "chunk size " << chunkSize << ": " << feed.error;
+    EXPECT_EQ(feed.format, FeedFormat::Rss);
+    EXPECT_EQ(feed.title, "Zprávičky");
+    EXPECT_EQ(feed.itemTitles, (std::vector<std::string>{"První", "Druhá"}))
+        << "chunk size " << chunkSize;
+  }
+}
+
+TEST(FeedStreamParserTest, TranscodesDeclaredEncoding) {
+  // "Šípek" in windows-1250
+  const std::string document = "<?xml version=\"1.0\" encoding=\"windows-1250\"?>"
+                               "<rss><channel><title>x</title>"
+                               "<item><title>\x8A\xEDpek</title></item></channel></rss>";
+  const ParsedFeed feed = parseInChunks(document, 3);
+  ASSERT_TRUE(feed.ok) << feed.error;
+  EXPECT_EQ(feed.itemTitles, (std::vector<std::string>{"Šípek"}));
+}
+
+TEST(FeedStreamParserTest, ParsesAtomEntries) {
+  const std::string document = R"(<?xml version="1.0"?>
+<feed xmlns="http://www.w3.org/2005/Atom"><title>Blog</title>
+<entry><title>One</title></entry><entry><title>Two</title></entry></feed>)";
+  const ParsedFeed feed = parseInChunks(document, 5);
+  ASSERT_TRUE(feed.ok) << feed.error;
+  EXPECT_EQ(feed.format, FeedFormat::Atom);
+  EXPECT_EQ(feed.title, "Blog");
+  EXPECT_EQ(feed.itemTitles, (std::vector<std::string>{"One", "Two"}));
+}
+
+TEST(FeedStreamParserTest, CollectsJsonFeedsUntilTheEnd) {
+  // The title comes after the items, so nothing can be reported before finish()
+  const std::string document = R"(
+{"items": [{"id": "1", "title": "One", "url": "https://example.com/1"},
+           {"id": "2", "title": "Two", "url": "https://example.com/2"}],
+ "version": "https://jsonfeed.org/version/1.1", "title": "Blog"})";
+  const ParsedFeed feed = parseInChunks(document, 7);
+  ASSERT_TRUE(feed.ok) << feed.error;
+  EXPECT_EQ(feed.format, FeedFormat::JsonFeed);
+  EXPECT_EQ(feed.title, "Blog");
+  EXPECT_EQ(feed.itemTitles, (std::vector<std::string>{"One", "Two"}));
+}
+
+TEST(FeedStreamParserTest, RejectsNonFeedDocuments) {
+  const ParsedFeed feed = parseInChunks("<html><body>Not found</body></html>", 8);
+  EXPECT_FALSE(feed.ok);
+  EXPECT_FALSE(feed.error.empty());
+  EXPECT_TRUE(feed.itemTitles.empty());
+}
+
+TEST(FeedStreamParserTest, BuffersOnlyTheCurrentItem) {
+  std::string document = "<rss><channel><title>big</title>";
+  for (int i = 0; i < 1000; ++i) {
+    document += "<item><title>" + std::to_string(i) + "</title><description>" +
+                std::string(1000, 'x') + "</description></item>";
+  }
+  document += "</channel></rss>";
+
+  FeedStreamParser parser(nullptr, nullptr);
+  for (size_t i = 0; i < document.size(); i += 4096) {
+    parser.write(std::string_view(document).substr(i, 4096));
+  }
+  ASSERT_TRUE(parser.finish());
+  EXPECT_EQ(parser.itemCount(), 1000);
+  EXPECT_LT(parser.peakBufferSize(), 3 * 4096);
+}
+
+TEST(FeedStreamParserTest, StopsWhenTheItemHandlerSaysSo) {
+  std::string document = "<rss><channel><title>t</title>";
+  for (int i = 0; i < 10; ++i) {
+    document += "<item><title>" + std::to_string(i) + "</title></item>";
+  }
+  // Whatever follows the stop is not looked at, not even a broken end
+  document += "</channel><oops>";
+
+  std::vector<std::string> titles;
+  FeedStreamParser parser(nullptr, [&titles](RSSItem &&item) {
+    titles.emplace_back(item.title);
+    return titles.size() < 3;
+  });
+  for (size_t i = 0; i < document.size(); i += 16) {
+    EXPECT_TRUE(parser.write(std::string_view(document).substr(i, 16)));
+  }
+  EXPECT_TRUE(parser.finish()) << parser.error();
+  EXPECT_TRUE(parser.stopped());
+  EXPECT_EQ(titles, (std::vector<std::string>{"0", "1", "2"}));
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/HostRateLimiter.hpp"
+
+using dotnamebot::rss::HostLimits;
+using dotnamebot::rss::HostRateLimiter;
+
+TEST(HostRateLimiterTest, BurstThenSustainedRate) {
+  HostRateLimiter limiter(HostLimits{10, 2.0, 3.0});
+  const auto now = HostRateLimiter::Clock::now();
+
+  EXPECT_TRUE(limiter.tryAcquire("a.example", now));
+  EXPECT_TRUE(limiter.tryAcquire("a.example", now));
+  EXPECT_TRUE(limiter.tryAcquire("a.example", now));
+  EXPECT_FALSE(limiter.tryAcquire("a.example", now));
+  EXPECT_EQ(limiter.nextTokenAt("a.example", now), now + std::chrono::milliseconds(500));
+
+  // Other hosts have their own bucket
+  EXPECT_TRUE(limiter.tryAcquire("b.example", now));
+
+  EXPECT_TRUE(limiter.tryAcquire("a.example", now + std::chrono::milliseconds(500)));
+  EXPECT_FALSE(limiter.tryAcquire("a.example", now + std::chrono::milliseconds(500)));
+}
+
+TEST(HostRateLimiterTest, ConcurrencyCapPerHost) {
+  HostRateLimiter limiter(HostLimits{2, 100.0, 100.0});
+  const auto now = HostRateLimiter::Clock::now();
+
+  EXPECT_TRUE(limiter.tryAcquire("a.example", now));
+  EXPECT_TRUE(limiter.tryAcquire("a.example", now));
+  EXPECT_FALSE(limiter.tryAcquire("a.example", now));
+
+  limiter.release("a.example");
+  EXPECT_TRUE(limiter.tryAcquire("a.example", now));
+}
+
+TEST(HostRateLimiterTest, PauseBlocksHostUntilItEnds) {
+  HostRateLimiter limiter;
+  const auto now = HostRateLimiter::Clock::now();
+
+  limiter.pauseUntil("a.example", now + std::chrono::seconds(30));
+  EXPECT_TRUE(limiter.isPaused("a.example", now));
+  EXPECT_FALSE(limiter.tryAcquire("a.example", now));
+  EXPECT_TRUE(limiter.tryAcquire("b.example", now));
+
+  // A shorter pause does not cut an existing one
+  limiter.pauseUntil("a.example", now + std::chrono::seconds(5));
+  EXPECT_EQ(limiter.pausedUntil("a.example"), now + std::chrono::seconds(30));
+
+  EXPECT_FALSE(limiter.isPaused("a.example", now + std::chrono::seconds(30)));
+  EXPECT_TRUE(limiter.tryAcquire("a.example", now + std::chrono::seconds(30)));
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/HtmlEntities.hpp"
+
+using namespace dotnamebot::rss;
+
+TEST(HtmlEntitiesTest, DecodesCommonNamedEntities) {
+  EXPECT_EQ(decodeHtmlEntities("a&nbsp;&ndash;&nbsp;b&hellip;"), "a – b…");
+  EXPECT_EQ(decodeHtmlEntities("&Scaron;koda &scaron;et&rcaron;&iacute;"), "Škoda šetří");
+  EXPECT_EQ(decodeHtmlEntities("&lt;p&gt; &quot;x&quot; &apos;y&apos; &amp;"),
+            "<p> \"x\" 'y' &");
+}
+
+TEST(HtmlEntitiesTest, LooksUpTheWholeHtml5Set) {
+  EXPECT_EQ(lookupHtmlEntity("CounterClockwiseContourIntegral"), "∳");
+  // Some names stand for two code points
+  EXPECT_EQ(lookupHtmlEntity("NotEqualTilde"), "≂̸");
+  EXPECT_TRUE(lookupHtmlEntity("scaronx").empty());
+  EXPECT_TRUE(lookupHtmlEntity("").empty());
+  // Names are case sensitive
+  EXPECT_TRUE(lookupHtmlEntity("AMp").empty());
+}
+
+TEST(HtmlEntitiesTest, ResolvesNestedEscapingInOnePass) {
+  EXPECT_EQ(decodeHtmlEntities("v&amp;#353;em"), "všem");
+  EXPECT_EQ(decodeHtmlEntities("&amp;amp;amp;lt;b&amp;gt;"), "<b>");
+  EXPECT_EQ(decodeHtmlEntities("&amp;hellip;"), "…");
+  // A decoded character can complete a reference that started before it
+  EXPECT_EQ(decodeHtmlEntities("&l&#116;;"), "<");
+  EXPECT_EQ(decodeHtmlEntities("&lt&semi;"), "<");
+}
+
+TEST(HtmlEntitiesTest, LeavesUnknownAndIncompleteReferences) {
+  EXPECT_EQ(decodeHtmlEntities("AT&T; R&D &nbsp &#; &#x; &#12a; &unknown;"),
+            "AT&T; R&D &nbsp &#; &#x; &#12a; &unknown;");
+  EXPECT_EQ(decodeHtmlEntities("&&&lt;;"), "&&<;");
+  EXPECT_EQ(decodeHtmlEntities("no references"), "no references");
+}
+
+TEST(HtmlEntitiesTest, DecodesNumericReferences) {
+  EXPECT_EQ(decodeHtmlEntities("&#65;&#x42;&#X63;&#0000353;"), "ABcš");
+  EXPECT_EQ(decodeHtmlEntities("&#x1F600;"), "\U0001F600");
+  // Out of range is dropped, NUL and surrogates become U+FFFD
+  EXPECT_EQ(decodeHtmlEntities("a&#x110000;b&#99999999999999999999;c"), "abc");
+  EXPECT_EQ(decodeHtmlEntities("&#0;&#xD800;"), "��");
+}
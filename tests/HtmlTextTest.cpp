@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/HtmlText.hpp"
+
+#include <random>
+#include <regex>
+
+using namespace dotnamebot::rss;
+
+TEST(HtmlTextTest, ExtractsTextAndFirstImage) {
+  HtmlText html = extractHtmlText(
+      "  <p><img class=\"a\" src=\"https://x.example/1.jpg\" alt=\"\"/>Hello <b>world</b></p>"
+      "<img src='https://x.example/2.jpg'>\n",
+      true);
+  EXPECT_EQ(html.text, "Hello world");
+  EXPECT_EQ(html.imageSrc, "https://x.example/1.jpg");
+
+  EXPECT_TRUE(extractHtmlText("<p> \n </p>", true).text.empty());
+  EXPECT_TRUE(extractHtmlText("<img src=\"a.png\">", false).imageSrc.empty());
+}
+
+TEST(HtmlTextTest, KeepsUnclosedAngleBrackets) {
+  // Like the regex, a stray < swallows everything up to the next tag end
+  EXPECT_EQ(stripHtmlTags("a < b and <i>c</i>"), "a c");
+  EXPECT_EQ(stripHtmlTags("1 < 2"), "1 < 2");
+}
+
+TEST(HtmlTextTest, CollapsesWhitespace) {
+  std::string text = " \t one \n\n two\r\nthree \v";
+  collapseWhitespace(text);
+  EXPECT_EQ(text, "one two three");
+
+  // Text that is already collapsed is only scanned; the first run to fix may come late
+  const std::string clean = "a fairly long sentence that needs no change at all";
+  for (const auto &[input, expected] : std::vector<std::pair<std::string, std::string>>{
+           {clean, clean},
+           {clean + " ", clean},
+           {" " + clean, clean},
+           {clean + " \tend", clean + " end"},
+           {clean + "  end", clean + " end"},
+           {clean + "\n", clean},
+           // A run at the very start has no byte before it to look at
+           {"\nabc", "abc"},
+           {"\tabc def", "abc def"},
+           {"\f\n abc", "abc"},
+           {"\r", ""}}) {
+    text = input;
+    collapseWhitespace(text);
+    EXPECT_EQ(text, expected) << input;
+  }
+}
+
+TEST(HtmlTextTest, FindsCdataSectionOnOneLine) {
+  std::string_view content;
+  ASSERT_TRUE(findCdataSection("x<![CDATA[<p>hi</p>]]>y", content));
+  EXPECT_EQ(content, "<p>hi</p>");
+  EXPECT_FALSE(findCdataSection("<![CDATA[line\nbreak]]>", content));
+}
+
+// The extractor replaced std::regex based code; item text and therefore the persisted
+// item hashes must not change, so compare against the old expressions on random markup.
+TEST(HtmlTextTest, MatchesTheRegexesItReplaced) {
+  const std::regex tagRegex("<[^>]*>");
+  const std::regex imgRegex(R"(<img[^>]+src=["']([^"']+)["'][^>]*>)");
+  const std::regex cdataRegex(R"(<!\[CDATA\[(.*?)\]\]>)");
+  const std::regex spaceRegex("\\s+");
+  const std::regex trimRegex("^\\s+|\\s+$");
+  const std::vector<std::string> pieces = {
+      "<", ">", "img", " ", "src=", "\"", "'", "a", "\n", "\r", "\t", "<img ",
+      "<img src=\"x.png\">", "<![CDATA[", "]]>", "b>", "</p>", "\v", "<p>"};
+
+  std::mt19937 rng(7);
+  for (int i = 0; i < 5000; ++i) {
+    std::string html;
+    const size_t count = rng() % 12;
+    for (size_t j = 0; j < count; ++j) {
+      html += pieces[rng() % pieces.size()];
+    }
+
+    std::string stripped = std::regex_replace(html, tagRegex, "");
+    ASSERT_EQ(stripHtmlTags(html), stripped) << html;
+
+    std::smatch match;
+    const std::string image = std::regex_search(html, match, imgRegex) ? match[1].str() : "";
+    ASSERT_EQ(findImageSrc(html), image) << html;
+
+    stripped.erase(0, stripped.find_first_not_of(" \t\n\r"));
+    stripped.erase(stripped.find_last_not_of(" \t\n\r") + 1);
+    HtmlText extracted = extractHtmlText(html, true);
+    ASSERT_EQ(extracted.text, stripped) << html;
+    ASSERT_EQ(extracted.imageSrc, image) << html;
+
+    std::string_view content;
+    const bool hasCdata = std::regex_search(html, match, cdataRegex);
+    ASSERT_EQ(findCdataSection(html, content), hasCdata) << html;
+    if (hasCdata) {
+      ASSERT_EQ(content, match[1].str()) << html;
+    }
+
+    std::string collapsed = html;
+    collapseWhitespace(collapsed);
+    ASSERT_EQ(collapsed,
+              std::regex_replace(std::regex_replace(html, spaceRegex, " "), trimRegex, ""))
+        << html;
+  }
+}
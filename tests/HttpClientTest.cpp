@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Http/HttpClient.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using dotnamebot::http::HttpClient;
+using dotnamebot::http::HttpRequestOptions;
+
+namespace {
+
+  std::filesystem::path writeBodyFile(const std::string &body) {
+    auto path = std::filesystem::temp_directory_path() / "DotNameBotHttpClientTest.txt";
+    std::ofstream(path, std::ios::binary) << body;
+    return path;
+  }
+
+  std::string fileUrl(const std::filesystem::path &path) { return "file://" + path.string(); }
+
+} // namespace
+
+TEST(HttpClientTest, ReusesReleasedHandles) {
+  HttpClient client(1);
+  CURL *first = client.acquireHandle();
+  CURL *second = client.acquireHandle();
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(first, second);
+
+  // Only one idle handle is kept; the second is cleaned up
+  client.releaseHandle(first);
+  client.releaseHandle(second);
+  CURL *reused = client.acquireHandle();
+  EXPECT_EQ(reused, first);
+  client.releaseHandle(reused);
+  client.releaseHandle(nullptr);
+}
+
+TEST(HttpClientTest, GetReadsTheBody) {
+  const auto path = writeBodyFile("feed body");
+  HttpClient client;
+  const auto response = client.get(fileUrl(path));
+  EXPECT_TRUE(response.ok()) << response.error;
+  EXPECT_EQ(response.body, "feed body");
+  std::filesystem::remove(path);
+}
+
+TEST(HttpClientTest, GetReportsConnectionErrors) {
+  HttpClient client;
+  HttpRequestOptions options;
+  options.timeoutSeconds = 2;
+  options.connectTimeoutSeconds = 1;
+  // Nothing listens on port 1
+  const auto response = client.get("http://127.0.0.1:1/", options);
+  EXPECT_FALSE(response.ok());
+  EXPECT_FALSE(response.error.empty());
+  EXPECT_TRUE(response.body.empty());
+}
+
+TEST(HttpClientTest, GetFromSeveralThreadsAtOnce) {
+  const auto path = writeBodyFile(std::string(4096, 'x'));
+  HttpClient client(4);
+  std::vector<std::thread> threads;
+  std::vector<int> failures(8, 0);
+  for (size_t t = 0; t < failures.size(); ++t) {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < 50; ++i) {
+        const auto response = client.get(fileUrl(path));
+        if (!response.ok() || response.body.size() != 4096) {
+          failures[t]++;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (const int failed : failures) {
+    EXPECT_EQ(failed, 0);
+  }
+  std::filesystem::remove(path);
+}
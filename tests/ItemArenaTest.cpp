@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/HtmlText.hpp"
+#include "../src/lib/Rss/ItemArena.hpp"
+#include "../src/lib/Rss/RSSItem.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+using namespace dotnamebot::rss;
+
+TEST(ItemArenaTest, KeepsCopiesOfTheStoredText) {
+  ItemArena arena;
+  std::string source = "Hello world";
+  const std::string_view stored = arena.store(source);
+  source.assign(source.size(), 'x');
+
+  EXPECT_EQ(stored, "Hello world");
+  EXPECT_NE(stored.data(), source.data());
+  EXPECT_TRUE(arena.store("").empty());
+  EXPECT_EQ(arena.bytesStored(), 11);
+
+  // Large texts get blocks of their own; earlier views stay put
+  const std::string big(100 * 1024, 'b');
+  EXPECT_EQ(arena.store(big), big);
+  EXPECT_EQ(stored, "Hello world");
+}
+
+TEST(ItemArenaTest, CollapsesStoredTextInPlace) {
+  ItemArena arena;
+  const std::string_view stored = arena.store("  one \t two\n ");
+  const std::string_view collapsed = collapseWhitespace(ItemArena::edit(stored));
+  EXPECT_EQ(collapsed, "one two");
+  EXPECT_EQ(collapsed.data(), stored.data());
+}
+
+TEST(ItemArenaTest, ItemCopiesOutliveTheOriginal) {
+  RSSItem copy;
+  {
+    RSSItem item;
+    item.arena = std::make_shared<ItemArena>();
+    item.title = item.arena->store("Title");
+    item.url = item.arena->store("https://example.com/1");
+    item.description = item.arena->store("Text");
+    item.generateHash();
+    copy = item;
+  }
+  EXPECT_EQ(copy.title, "Title");
+  EXPECT_EQ(copy.url, "https://example.com/1");
+  EXPECT_EQ(copy.hash,
+            ItemFingerprint().add("Title").add("https://example.com/1").add("Text").value());
+}
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/ItemFingerprint.hpp"
+
+#include <cstdint>
+#include <string>
+
+using namespace dotnamebot::rss;
+
+TEST(ItemFingerprintTest, MatchesTheReferenceXxh64) {
+  EXPECT_EQ(xxh64("", 0), 0xef46db3751d8e999ULL);
+  EXPECT_EQ(xxh64("abc", 0), 0x44bc2cf5ad770999ULL);
+  EXPECT_EQ(xxh64("Nobody inspects the spammish repetition, really not!!", 7),
+            0x1c63d5fe49c7ac36ULL);
+  EXPECT_EQ(xxh64("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ",
+                  0x646f746e616d6562ULL),
+            0x845f803f298f5cffULL);
+  EXPECT_EQ(xxh64("Příliš žluťoučký kůň", 0), 0x23dee8b9ac48abbeULL);
+}
+
+TEST(ItemFingerprintTest, StaysTheSameAcrossBuilds) {
+  // Persisted in seenHashes.index: a different value here would repost every item
+  EXPECT_EQ(ItemFingerprint().add("Title").add("https://example.com/1").add("Text").value(),
+            0xe0f0ea6971d8de8bULL);
+}
+
+TEST(ItemFingerprintTest, TellsFieldBoundariesApart) {
+  EXPECT_NE(ItemFingerprint().add("ab").add("c").value(),
+            ItemFingerprint().add("a").add("bc").value());
+  EXPECT_NE(ItemFingerprint().add("a").add("").value(), ItemFingerprint().add("a").value());
+}
+
+TEST(ItemFingerprintTest, RoundTripsThroughHex) {
+  const uint64_t fingerprint = 0x00f0ea6971d8de8bULL;
+  const std::string hex = fingerprintToHex(fingerprint);
+  EXPECT_EQ(hex, "00f0ea6971d8de8b");
+
+  uint64_t parsed = 0;
+  EXPECT_TRUE(fingerprintFromHex(hex, parsed));
+  EXPECT_EQ(parsed, fingerprint);
+
+  EXPECT_FALSE(fingerprintFromHex("", parsed));
+  EXPECT_FALSE(fingerprintFromHex("12345678901234567", parsed));
+  EXPECT_FALSE(fingerprintFromHex("12x4", parsed));
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/KnownItems.hpp"
+
+#include <vector>
+
+using namespace dotnamebot::rss;
+
+TEST(KnownItemsTest, LearnsNewestFirstFromDates) {
+  KnownItems known;
+  known.update({3, 2, 1}, {300, 200, 100}, true);
+  EXPECT_TRUE(known.isNewestFirst());
+  EXPECT_TRUE(known.contains(2));
+
+  KnownItems oldestFirst;
+  oldestFirst.update({1, 2, 3}, {100, 200, 300}, true);
+  EXPECT_FALSE(oldestFirst.isNewestFirst());
+
+  // A first parse without dates cannot tell
+  KnownItems undated;
+  undated.update({3, 2, 1}, {}, true);
+  EXPECT_FALSE(undated.isNewestFirst());
+}
+
+TEST(KnownItemsTest, LearnsNewestFirstFromWhereNewItemsAppear) {
+  KnownItems known;
+  known.update({3, 2, 1}, {}, true);
+
+  known.update({5, 4, 3, 2, 1}, {}, true);
+  EXPECT_TRUE(known.isNewestFirst());
+
+  // A new item below known ones: the feed is not appended to at the top
+  known.update({5, 4, 6, 3, 2}, {}, true);
+  EXPECT_FALSE(known.isNewestFirst());
+}
+
+TEST(KnownItemsTest, KeepsTheOlderPartAfterAStoppedParse) {
+  KnownItems known;
+  known.update({4, 3, 2, 1}, {4, 3, 2, 1}, true);
+
+  // Parsing stopped after 3: the publisher's window moved by one item
+  known.update({5, 4, 3}, {5, 4, 3}, false);
+  EXPECT_TRUE(known.isNewestFirst());
+  EXPECT_EQ(known.size(), 4U);
+  EXPECT_TRUE(known.contains(2));
+  EXPECT_FALSE(known.contains(1));
+}
+
+TEST(KnownItemsTest, CutoffStopsAfterAKnownRun) {
+  KnownItems known;
+  known.update({3, 2, 1}, {3, 2, 1}, true);
+
+  KnownItemsCutoff cutoff(&known, 2);
+  EXPECT_FALSE(cutoff.reached(24));
+  EXPECT_FALSE(cutoff.reached(3));
+  EXPECT_FALSE(cutoff.reached(25)); // the run starts over
+  EXPECT_FALSE(cutoff.reached(2));
+  EXPECT_TRUE(cutoff.reached(1));
+  EXPECT_TRUE(cutoff.isReached());
+
+  KnownItemsCutoff never;
+  EXPECT_FALSE(never.reached(3));
+  EXPECT_FALSE(KnownItemsCutoff(&known, 0).reached(3));
+}
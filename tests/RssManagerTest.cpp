@@ -1,6 +1,12 @@
+#include <arpa/inet.h>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
 
 #include "../src/lib/Utils/Logger/ConsoleLogger.hpp"
 #include "MockAssetManager.hpp"
@@ -33,6 +39,87 @@ namespace {
     std::shared_ptr<MockAssetManager> assetManager_;
   };
 
+  // Serves one feed on 127.0.0.1 with an ETag and answers every conditional GET with 304
+  class NotModifiedServer {
+  public:
+    explicit NotModifiedServer(std::string body) : body_(std::move(body)) {}
+    ~NotModifiedServer() { stop(); }
+
+    NotModifiedServer(const NotModifiedServer &) = delete;
+    NotModifiedServer &operator=(const NotModifiedServer &) = delete;
+
+    bool start() {
+      listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+      sockaddr_in address{};
+      address.sin_family = AF_INET;
+      address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      socklen_t length = sizeof(address);
+      if (listenFd_ < 0 ||
+          ::bind(listenFd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+          ::listen(listenFd_, 8) != 0 ||
+          ::getsockname(listenFd_, reinterpret_cast<sockaddr *>(&address), &length) != 0) {
+        return false;
+      }
+      port_ = ntohs(address.sin_port);
+      thread_ = std::thread(&NotModifiedServer::serve, this);
+      return true;
+    }
+
+    void stop() {
+      if (listenFd_ >= 0) {
+        // Unblocks accept()
+        ::shutdown(listenFd_, SHUT_RDWR);
+        if (thread_.joinable()) {
+          thread_.join();
+        }
+        ::close(listenFd_);
+        listenFd_ = -1;
+      }
+    }
+
+    [[nodiscard]] std::string url() const {
+      return "http://127.0.0.1:" + std::to_string(port_) + "/feed";
+    }
+    [[nodiscard]] int notModifiedResponses() const { return notModified_.load(); }
+
+  private:
+    void serve() {
+      for (int fd; (fd = ::accept(listenFd_, nullptr, nullptr)) >= 0; ::close(fd)) {
+        std::string request;
+        char chunk[1024];
+        while (request.find("\r\n\r\n") == std::string::npos) {
+          const ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+          if (received <= 0) {
+            break;
+          }
+          request.append(chunk, static_cast<size_t>(received));
+        }
+        std::string response;
+        if (request.find("If-None-Match: \"v1\"") != std::string::npos) {
+          notModified_++;
+          response = "HTTP/1.1 304 Not Modified\r\nETag: \"v1\"\r\nConnection: close\r\n\r\n";
+        } else {
+          response = "HTTP/1.1 200 OK\r\nETag: \"v1\"\r\nContent-Type: application/rss+xml\r\n"
+                     "Content-Length: " +
+                     std::to_string(body_.size()) + "\r\nConnection: close\r\n\r\n" + body_;
+        }
+        for (size_t sent = 0; sent < response.size();) {
+          const ssize_t n = ::send(fd, response.data() + sent, response.size() - sent, 0);
+          if (n <= 0) {
+            break;
+          }
+          sent += static_cast<size_t>(n);
+        }
+      }
+    }
+
+    std::string body_;
+    int listenFd_{-1};
+    uint16_t port_{0};
+    std::thread thread_;
+    std::atomic<int> notModified_{0};
+  };
+
 } // namespace
 
 TEST(RssManagerTest, DecodeHtmlEntitiesDecodesDecimalNumericEntities) {
@@ -50,6 +137,25 @@ TEST(RssManagerTest, DecodeHtmlEntitiesDecodesHexNumericEntities) {
             "zp\u0159\u00edstup\u0148uj\u00ed širší publikum");
 }
 
+TEST_F(RssManagerParsingTest, ConvertToUtf8TranscodesAndRewritesTheDeclaration) {
+  auto rssManager = RssManager(logger_, assetManager_);
+  std::string buffer;
+
+  const std::string utf8 = "<?xml version=\"1.0\" encoding=\"UTF-8\"?><rss/>";
+  const std::string_view unchanged = rssManager.convertToUtf8(utf8, buffer);
+  EXPECT_EQ(unchanged.data(), utf8.data());
+  EXPECT_TRUE(buffer.empty());
+
+  // "Šípek" in windows-1250
+  const std::string cp1250 =
+      "<?xml version='1.0' encoding='windows-1250'?><rss><title>\x8A\xEDpek</title></rss>";
+  EXPECT_EQ(rssManager.convertToUtf8(cp1250, buffer),
+            "<?xml version='1.0' encoding='UTF-8'?><rss><title>Šípek</title></rss>");
+
+  const std::string unknown = "<?xml version=\"1.0\" encoding=\"x-unknown\"?><rss/>";
+  EXPECT_EQ(rssManager.convertToUtf8(unknown, buffer), unknown);
+}
+
 TEST_F(RssManagerParsingTest, ParseRssDecodesRootZpravickyDescriptionEntities) {
   auto rssManager = RssManager(logger_, assetManager_);
   int totalDuplicateItems = 0;
@@ -80,4 +186,305 @@ TEST_F(RssManagerParsingTest, ParseRssDecodesRootZpravickyDescriptionEntities) {
             "prioritou, v neprospěch Windows. Takže vlastně nic šokujícího: služba LVFS a klient "
             "Fwupd jsou zavedené projekty zajišťující infrastrukturu pro instalace firmwarů, a to "
             "je přesně to, co Lenovo i Dell potřebují.");
-}
\ No newline at end of file
+}
+
+TEST_F(RssManagerParsingTest, ParseRssReadsRefreshHintsAndItemDates) {
+  auto rssManager = RssManager(logger_, assetManager_);
+  int totalDuplicateItems = 0;
+
+  const std::string xml = R"(<?xml version="1.0" encoding="UTF-8"?>
+<rss version="2.0" xmlns:sy="http://purl.org/rss/1.0/modules/syndication/">
+  <channel>
+    <title>Example</title>
+    <ttl>30</ttl>
+    <sy:updatePeriod>hourly</sy:updatePeriod>
+    <sy:updateFrequency>2</sy:updateFrequency>
+    <item>
+      <title>First</title>
+      <link>https://example.com/1</link>
+      <pubDate>Thu, 07 May 2026 10:00:00 +0000</pubDate>
+    </item>
+    <item>
+      <title>Second</title>
+      <link>https://example.com/2</link>
+      <pubDate>Thu, 07 May 2026 08:00:00 +0000</pubDate>
+    </item>
+  </channel>
+</rss>)";
+
+  const auto feed = rssManager.parseRSS(xml, 0, 0, totalDuplicateItems);
+
+  ASSERT_EQ(feed.items.size(), 2);
+  EXPECT_EQ(feed.updateHintSeconds, 30 * 60);
+  ASSERT_EQ(feed.publishTimes.size(), 2);
+  EXPECT_EQ(feed.publishTimes[0] - feed.publishTimes[1], 2 * 3600);
+}
+
+TEST_F(RssManagerParsingTest, StopsParsingAtKnownItemsOfANewestFirstFeed) {
+  auto rssManager = RssManager(logger_, assetManager_);
+  const dotnamebot::rss::RSSUrl source("https://example.com/feed");
+
+  auto document = [](int newest, int count) {
+    std::string xml = "<rss><channel><title>Example</title>";
+    for (int i = newest; i > newest - count; --i) {
+      xml += "<item><title>Item " + std::to_string(i) + "</title><link>https://example.com/" +
+             std::to_string(i) + "</link><pubDate>Thu, 07 May 2026 " +
+             std::to_string(10 + i) + ":00:00 +0000</pubDate></item>";
+    }
+    return xml + "<ttl>30</ttl></channel></rss>";
+  };
+
+  // A full parse primes the known items and shows the feed is newest first
+  int duplicates = 0;
+  dotnamebot::rss::FeedPollResult poll;
+  auto first = rssManager.parseRSS(document(5, 5), 0, 0, duplicates);
+  EXPECT_EQ(rssManager.mergeFeed(source, first, duplicates, poll), 5);
+  ASSERT_TRUE(rssManager.knownItems_[source.url].isNewestFirst());
+
+  // One new item on top, the oldest one dropped: the parse stops after two known ones
+  dotnamebot::rss::KnownItemsCutoff cutoff(&rssManager.knownItems_[source.url], 2);
+  auto second = rssManager.parseRSS(document(6, 5), 0, 0, duplicates, &cutoff);
+  EXPECT_TRUE(second.truncated);
+  EXPECT_EQ(second.itemHashes.size(), 3);
+  EXPECT_EQ(second.updateHintSeconds, 0);
+
+  // Items below the cut-off stay buffered up to the feed's previous length, and only the
+  // new one counts as new
+  dotnamebot::rss::FeedPollResult secondPoll;
+  rssManager.mergeFeed(source, second, duplicates, secondPoll);
+  EXPECT_EQ(secondPoll.newItems, 1);
+  EXPECT_EQ(rssManager.feed_.items.size(), 5);
+  EXPECT_EQ(rssManager.feedStates_[source.url].updateHintSeconds, 30 * 60);
+}
+
+TEST_F(RssManagerParsingTest, MigratesPreFingerprintSeenHashes) {
+  // seenHashes.json as written before fingerprints: std::hash of title + link + description
+  const nlohmann::json legacy = {
+      std::to_string(std::hash<std::string>{}("Seenhttps://example.com/seen")), "12345"};
+  std::ofstream(testDir_ / "seenHashes.json") << legacy.dump();
+  std::ofstream(testDir_ / "rssUrls.json")
+      << R"([{"url": "https://example.com/feed", "embeddedType": 0}])";
+
+  auto rssManager = RssManager(logger_, assetManager_);
+  ASSERT_EQ(rssManager.legacySeenHashes_.size(), 2);
+
+  const std::string xml = "<rss><channel><title>Example</title>"
+                          "<item><title>Seen</title><link>https://example.com/seen</link></item>"
+                          "<item><title>New</title><link>https://example.com/new</link></item>"
+                          "</channel></rss>";
+  int duplicates = 0;
+  dotnamebot::rss::FeedPollResult poll;
+  auto feed = rssManager.parseRSS(xml, 0, 0, duplicates);
+  EXPECT_EQ(duplicates, 1);
+  ASSERT_EQ(feed.items.size(), 1);
+  EXPECT_EQ(feed.items[0].title, "New");
+  EXPECT_EQ(rssManager.mergeFeed(rssManager.urls_[0], feed, duplicates, poll), 1);
+
+  // The only feed has been parsed: the hash nothing matched is dropped, the file rewritten
+  EXPECT_TRUE(rssManager.legacySeenHashes_.empty());
+  nlohmann::json saved;
+  std::ifstream(testDir_ / "seenHashes.json") >> saved;
+  EXPECT_EQ(saved["version"], 3);
+  EXPECT_FALSE(saved.contains("legacy"));
+  EXPECT_EQ(saved["indexed"], 1);
+  const uint64_t seen = dotnamebot::rss::ItemFingerprint()
+                            .add("Seen")
+                            .add("https://example.com/seen")
+                            .add("")
+                            .value();
+  dotnamebot::rss::SeenHashIndex index;
+  ASSERT_TRUE(index.open(testDir_ / "seenHashes.index"));
+  EXPECT_TRUE(index.contains(seen));
+}
+
+TEST_F(RssManagerParsingTest, MovesListedFingerprintsIntoTheIndex) {
+  // seenHashes.json as written before the index
+  const uint64_t seen = dotnamebot::rss::ItemFingerprint()
+                            .add("Seen")
+                            .add("https://example.com/seen")
+                            .add("")
+                            .value();
+  const nlohmann::json listed = {
+      {"version", 2}, {"fingerprints", {dotnamebot::rss::fingerprintToHex(seen)}}};
+  std::ofstream(testDir_ / "seenHashes.json") << listed.dump();
+
+  auto rssManager = RssManager(logger_, assetManager_);
+  EXPECT_TRUE(rssManager.seenHashes_.empty());
+  EXPECT_EQ(rssManager.seenIndex_.size(), 1);
+  nlohmann::json saved;
+  std::ifstream(testDir_ / "seenHashes.json") >> saved;
+  EXPECT_EQ(saved["version"], 3);
+  EXPECT_FALSE(saved.contains("fingerprints"));
+
+  const std::string xml = "<rss><channel><title>Example</title>"
+                          "<item><title>Seen</title><link>https://example.com/seen</link></item>"
+                          "</channel></rss>";
+  int duplicates = 0;
+  EXPECT_TRUE(rssManager.parseRSS(xml, 0, 0, duplicates).items.empty());
+  EXPECT_EQ(duplicates, 1);
+}
+
+TEST_F(RssManagerParsingTest, PostingAppendsToTheJournalInsteadOfRewritingTheSnapshot) {
+  auto rssManager = RssManager(logger_, assetManager_);
+  dotnamebot::rss::RSSItem item;
+  item.title = "Posted";
+  item.url = "https://example.com/posted";
+  item.generateHash();
+  rssManager.feed_.addItem(item);
+
+  const std::string snapshot = [&] {
+    std::ifstream file(testDir_ / "seenHashes.json");
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }();
+  EXPECT_EQ(rssManager.getRandomItem().hash, item.hash);
+  EXPECT_EQ(rssManager.journal_.size(), 1);
+  std::ifstream file(testDir_ / "seenHashes.json");
+  EXPECT_EQ(std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()),
+            snapshot);
+
+  // A restart before the next snapshot still knows the item
+  auto restarted = RssManager(logger_, assetManager_);
+  EXPECT_TRUE(restarted.seenHashes_.contains(item.hash));
+}
+
+TEST_F(RssManagerParsingTest, DropsSeenItemsNoFeedListsAnyMore) {
+  using dotnamebot::rss::SeenDay;
+  const auto today = static_cast<SeenDay>(
+      std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now())
+          .time_since_epoch()
+          .count());
+  const uint64_t listed = dotnamebot::rss::ItemFingerprint()
+                              .add("Listed")
+                              .add("https://example.com/listed")
+                              .add("")
+                              .value();
+  ASSERT_TRUE(dotnamebot::rss::SeenHashIndex::write(
+      testDir_ / "seenHashes.index", {{1, today - 100}, {2, today - 10}, {listed, today - 100}}));
+  const nlohmann::json written = {{"version", 3}, {"indexed", 3}, {"written", today}};
+  std::ofstream(testDir_ / "seenHashes.json") << written.dump();
+  std::ofstream(testDir_ / "rssUrls.json")
+      << R"([{"url": "https://example.com/feed", "embeddedType": 0}])";
+
+  auto rssManager = RssManager(logger_, assetManager_);
+  ASSERT_EQ(rssManager.seenIndex_.size(), 3);
+
+  // The feed still lists an old item: it is kept for another 90 days
+  const std::string xml =
+      "<rss><channel><title>Example</title>"
+      "<item><title>Listed</title><link>https://example.com/listed</link></item>"
+      "</channel></rss>";
+  int duplicates = 0;
+  dotnamebot::rss::FeedPollResult poll;
+  auto feed = rssManager.parseRSS(xml, 0, 0, duplicates);
+  EXPECT_EQ(rssManager.mergeFeed(rssManager.urls_[0], feed, duplicates, poll), 0);
+  EXPECT_EQ(rssManager.seenRefreshes_.size(), 1);
+
+  ASSERT_TRUE(rssManager.saveAllSeenHashes());
+  EXPECT_FALSE(rssManager.seenIndex_.contains(1));
+  EXPECT_EQ(rssManager.seenIndex_.lastSeen(2), today - 10);
+  EXPECT_EQ(rssManager.seenIndex_.lastSeen(listed), today);
+  EXPECT_TRUE(rssManager.seenRefreshes_.empty());
+}
+
+TEST_F(RssManagerParsingTest, RefreshesStartedTogetherRunOneAfterTheOther) {
+  nlohmann::json urls = nlohmann::json::array();
+  for (int i = 0; i < 4; ++i) {
+    const auto path = testDir_ / ("feed" + std::to_string(i) + ".xml");
+    std::ofstream(path) << "<rss><channel><title>Feed " << i << "</title><item><title>Item " << i
+                        << "</title><link>https://example.com/" << i
+                        << "</link></item></channel></rss>";
+    urls.push_back({{"url", "file://" + path.string()}, {"embeddedType", 0}});
+  }
+  std::ofstream(testDir_ / "rssUrls.json") << urls.dump();
+
+  auto rssManager = RssManager(logger_, assetManager_);
+  ASSERT_EQ(rssManager.urls_.size(), 4);
+
+  // The timer and /refetch share the fetcher; whichever runs second finds nothing new
+  int timerItems = 0;
+  std::thread timer([&]() { timerItems = rssManager.refetchRssFeeds(); });
+  const int commandItems = rssManager.refetchRssFeeds();
+  timer.join();
+  EXPECT_EQ(timerItems + commandItems, 4);
+  EXPECT_EQ(rssManager.feed_.items.size(), 4);
+}
+
+TEST_F(RssManagerParsingTest, UnchangedFeedsKeepTheirItemsInTheSeenHistory) {
+  using dotnamebot::rss::SeenDay;
+  const auto today = static_cast<SeenDay>(
+      std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now())
+          .time_since_epoch()
+          .count());
+  auto document = [](const std::string &title) {
+    return "<rss><channel><title>Example</title><item><title>" + title +
+           "</title><link>https://example.com/" + title + "</link></item></channel></rss>";
+  };
+  auto fingerprint = [](const std::string &title) {
+    return dotnamebot::rss::ItemFingerprint()
+        .add(title)
+        .add("https://example.com/" + title)
+        .add("")
+        .value();
+  };
+
+  // One feed answers conditional GETs with 304, the other sends the same bytes again
+  NotModifiedServer server(document("Revalidated"));
+  ASSERT_TRUE(server.start());
+  const auto unchangedPath = testDir_ / "unchanged.xml";
+  std::ofstream(unchangedPath) << document("Unchanged");
+  const nlohmann::json urls = {{{"url", server.url()}, {"embeddedType", 0}},
+                               {{"url", "file://" + unchangedPath.string()}, {"embeddedType", 0}}};
+  std::ofstream(testDir_ / "rssUrls.json") << urls.dump();
+
+  // Both items were posted long ago
+  ASSERT_TRUE(dotnamebot::rss::SeenHashIndex::write(
+      testDir_ / "seenHashes.index",
+      {{fingerprint("Revalidated"), today - 100}, {fingerprint("Unchanged"), today - 100}}));
+  const nlohmann::json written = {{"version", 3}, {"indexed", 2}, {"written", today}};
+  std::ofstream(testDir_ / "seenHashes.json") << written.dump();
+
+  auto rssManager = RssManager(logger_, assetManager_);
+  ASSERT_EQ(rssManager.urls_.size(), 2);
+  EXPECT_EQ(rssManager.refetchRssFeeds(), 0);
+
+  // Drop what the full parses recorded: only the next refresh may keep the items
+  rssManager.seenRefreshes_.clear();
+  EXPECT_EQ(rssManager.refetchRssFeeds(), 0);
+  EXPECT_EQ(server.notModifiedResponses(), 1);
+  EXPECT_EQ(rssManager.seenRefreshes_.size(), 2);
+
+  ASSERT_TRUE(rssManager.saveAllSeenHashes());
+  EXPECT_EQ(rssManager.seenIndex_.lastSeen(fingerprint("Revalidated")), today);
+  EXPECT_EQ(rssManager.seenIndex_.lastSeen(fingerprint("Unchanged")), today);
+}
+
+TEST_F(RssManagerParsingTest, BrokenBufferedBodyKeepsTheItemsAndCountsAsAFailure) {
+  std::ofstream(testDir_ / "rssOptions.json") << R"({"streamingParse": false})";
+  const auto path = testDir_ / "feed.xml";
+  const std::string url = "file://" + path.string();
+  const nlohmann::json urls = {{{"url", url}, {"embeddedType", 0}}};
+  std::ofstream(testDir_ / "rssUrls.json") << urls.dump();
+  std::ofstream(path) << "<rss><channel><title>Example</title>"
+                         "<item><title>One</title><link>https://example.com/1</link></item>"
+                         "<item><title>Two</title><link>https://example.com/2</link></item>"
+                         "</channel></rss>";
+
+  auto rssManager = RssManager(logger_, assetManager_);
+  ASSERT_FALSE(rssManager.getOptions().streamingParse);
+  EXPECT_EQ(rssManager.refetchRssFeeds(), 2);
+  ASSERT_EQ(rssManager.feed_.items.size(), 2);
+
+  std::ofstream(path) << "<rss><channel><title>Example</title>"
+                         "<item><title>Three</titel><link>https://example.com/3</link></item>"
+                         "</channel></rss>";
+  EXPECT_EQ(rssManager.refetchRssFeeds(), 0);
+  EXPECT_EQ(rssManager.feed_.items.size(), 2);
+  EXPECT_EQ(rssManager.knownItems_[url].size(), 2);
+  EXPECT_EQ(rssManager.feedStates_[url].consecutiveFailures, 1);
+  EXPECT_FALSE(rssManager.feedStates_[url].lastError.empty());
+
+  // Nothing of the broken body was remembered: it is downloaded and rejected again
+  EXPECT_EQ(rssManager.refetchRssFeeds(), 0);
+  EXPECT_EQ(rssManager.feedStates_[url].consecutiveFailures, 2);
+  EXPECT_EQ(rssManager.feed_.items.size(), 2);
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/ItemFingerprint.hpp"
+#include "../src/lib/Rss/SeenHashIndex.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+using dotnamebot::rss::SeenDay;
+using dotnamebot::rss::SeenEntry;
+using dotnamebot::rss::SeenHashIndex;
+
+namespace {
+
+  std::vector<SeenEntry> entriesOf(const std::vector<uint64_t> &fingerprints, SeenDay day = 1) {
+    std::vector<SeenEntry> entries;
+    for (const uint64_t fingerprint : fingerprints) {
+      entries.push_back({fingerprint, day});
+    }
+    return entries;
+  }
+
+  class SeenHashIndexTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      testDir_ = std::filesystem::temp_directory_path() / "dotnamebot-seen-hash-index-test";
+      std::filesystem::remove_all(testDir_);
+      std::filesystem::create_directories(testDir_);
+      path_ = testDir_ / "seenHashes.index";
+    }
+
+    void TearDown() override { std::filesystem::remove_all(testDir_); }
+
+    std::filesystem::path testDir_;
+    std::filesystem::path path_;
+  };
+
+} // namespace
+
+TEST_F(SeenHashIndexTest, FindsWhatWasWritten) {
+  std::vector<uint64_t> fingerprints;
+  for (uint64_t i = 1; i <= 1000; ++i) {
+    fingerprints.push_back(i); // sequential values must not pile up in one probe run
+    fingerprints.push_back(dotnamebot::rss::xxh64(std::to_string(i), 0));
+  }
+  ASSERT_TRUE(SeenHashIndex::write(path_, entriesOf(fingerprints)));
+
+  SeenHashIndex index;
+  ASSERT_TRUE(index.open(path_));
+  EXPECT_EQ(index.size(), fingerprints.size());
+  for (const uint64_t fingerprint : fingerprints) {
+    EXPECT_TRUE(index.contains(fingerprint)) << fingerprint;
+  }
+  EXPECT_FALSE(index.contains(0));
+  EXPECT_FALSE(index.contains(1001));
+  EXPECT_FALSE(index.contains(0xffffffffffffffffULL));
+}
+
+TEST_F(SeenHashIndexTest, StoresZeroAndDuplicatesOnceWithTheLaterDay) {
+  ASSERT_TRUE(SeenHashIndex::write(path_, {{0, 3}, {7, 5}, {7, 4}, {0, 6}, {9, 1}}));
+  SeenHashIndex index;
+  ASSERT_TRUE(index.open(path_));
+  EXPECT_EQ(index.size(), 3);
+  EXPECT_TRUE(index.contains(0));
+  EXPECT_TRUE(index.contains(7));
+  EXPECT_EQ(index.lastSeen(0), 6U);
+  EXPECT_EQ(index.lastSeen(7), 5U);
+  EXPECT_EQ(index.lastSeen(9), 1U);
+  EXPECT_EQ(index.lastSeen(8), std::nullopt);
+
+  std::vector<SeenEntry> collected;
+  index.collect(collected);
+  std::sort(collected.begin(), collected.end(),
+            [](const SeenEntry &a, const SeenEntry &b) { return a.fingerprint < b.fingerprint; });
+  ASSERT_EQ(collected.size(), 3);
+  EXPECT_EQ(collected[0].fingerprint, 0U);
+  EXPECT_EQ(collected[0].lastSeen, 6U);
+  EXPECT_EQ(collected[1].fingerprint, 7U);
+  EXPECT_EQ(collected[2].lastSeen, 1U);
+}
+
+TEST_F(SeenHashIndexTest, ReadsAnIndexWithoutDays) {
+  // Header and 16 slots, as written before last-seen days; every slot holds 5, so it is
+  // found wherever it hashes to
+  std::string file("DNBSIDX\x01", 8);
+  for (const uint64_t field : {uint64_t{16}, uint64_t{1}, uint64_t{0}}) {
+    for (int byte = 0; byte < 8; ++byte) {
+      file.push_back(static_cast<char>((field >> (8 * byte)) & 0xFF));
+    }
+  }
+  for (int slot = 0; slot < 16; ++slot) {
+    file.append("\x05\0\0\0\0\0\0\0", 8);
+  }
+  std::ofstream(path_, std::ios::binary) << file;
+
+  SeenHashIndex index;
+  ASSERT_TRUE(index.open(path_));
+  EXPECT_EQ(index.lastSeen(5), 0U);
+  EXPECT_EQ(index.lastSeen(6), std::nullopt);
+}
+
+TEST_F(SeenHashIndexTest, ReopensAfterBeingReplaced) {
+  ASSERT_TRUE(SeenHashIndex::write(path_, entriesOf({1})));
+  SeenHashIndex index;
+  ASSERT_TRUE(index.open(path_));
+
+  // The open mapping keeps the old table until the index is opened again
+  ASSERT_TRUE(SeenHashIndex::write(path_, entriesOf({1, 2})));
+  EXPECT_FALSE(index.contains(2));
+  ASSERT_TRUE(index.open(path_));
+  EXPECT_TRUE(index.contains(2));
+  EXPECT_FALSE(std::filesystem::exists(testDir_ / "seenHashes.index.tmp"));
+}
+
+TEST_F(SeenHashIndexTest, RejectsMissingAndDamagedFiles) {
+  SeenHashIndex index;
+  EXPECT_FALSE(index.open(path_));
+  EXPECT_FALSE(index.isOpen());
+
+  std::ofstream(path_) << "not an index at all, but long enough for a header";
+  EXPECT_FALSE(index.open(path_));
+
+  // A table cut short
+  ASSERT_TRUE(SeenHashIndex::write(path_, entriesOf({1, 2, 3})));
+  std::filesystem::resize_file(path_, std::filesystem::file_size(path_) - 8);
+  EXPECT_FALSE(index.open(path_));
+  EXPECT_EQ(index.size(), 0);
+  EXPECT_FALSE(index.contains(1));
+}
+
+TEST_F(SeenHashIndexTest, FilterTurnsAwayMostUnseenFingerprints) {
+  std::vector<uint64_t> fingerprints;
+  for (uint64_t i = 0; i < 20000; ++i) {
+    fingerprints.push_back(dotnamebot::rss::xxh64(std::to_string(i), 0));
+  }
+  ASSERT_TRUE(SeenHashIndex::write(path_, entriesOf(fingerprints), 0.01));
+  SeenHashIndex index;
+  ASSERT_TRUE(index.open(path_));
+  ASSERT_TRUE(index.hasFilter());
+
+  // No false negatives, and about the configured rate of false positives
+  for (const uint64_t fingerprint : fingerprints) {
+    ASSERT_TRUE(index.mayContain(fingerprint));
+  }
+  size_t falsePositives = 0;
+  for (uint64_t i = 0; i < 20000; ++i) {
+    const uint64_t unseen = dotnamebot::rss::xxh64(std::to_string(i), 1);
+    falsePositives += index.mayContain(unseen) ? 1 : 0;
+    EXPECT_FALSE(index.contains(unseen));
+  }
+  EXPECT_LT(falsePositives, 400U);
+}
+
+TEST_F(SeenHashIndexTest, WorksWithoutAFilter) {
+  ASSERT_TRUE(SeenHashIndex::write(path_, entriesOf({1, 2, 3}), 0.0));
+  SeenHashIndex index;
+  ASSERT_TRUE(index.open(path_));
+  EXPECT_FALSE(index.hasFilter());
+  EXPECT_TRUE(index.mayContain(4));
+  EXPECT_TRUE(index.contains(3));
+  EXPECT_FALSE(index.contains(4));
+}
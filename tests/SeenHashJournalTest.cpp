@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/SeenHashJournal.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+using dotnamebot::rss::SeenHashJournal;
+
+namespace {
+
+  class SeenHashJournalTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      testDir_ = std::filesystem::temp_directory_path() / "dotnamebot-seen-hash-journal-test";
+      std::filesystem::remove_all(testDir_);
+      std::filesystem::create_directories(testDir_);
+      path_ = testDir_ / "seenHashes.journal";
+    }
+
+    void TearDown() override { std::filesystem::remove_all(testDir_); }
+
+    std::filesystem::path testDir_;
+    std::filesystem::path path_;
+  };
+
+} // namespace
+
+TEST_F(SeenHashJournalTest, ReplaysWhatWasAppended) {
+  {
+    SeenHashJournal journal(path_);
+    EXPECT_TRUE(journal.append(1));
+    EXPECT_TRUE(journal.append(0xffffffffffffffffULL));
+    EXPECT_EQ(journal.size(), 2);
+  }
+
+  SeenHashJournal journal(path_);
+  std::unordered_set<uint64_t> hashes;
+  EXPECT_EQ(journal.replay(hashes), 2);
+  EXPECT_EQ(hashes, (std::unordered_set<uint64_t>{1, 0xffffffffffffffffULL}));
+
+  // Appends go after the replayed records
+  EXPECT_TRUE(journal.append(3));
+  EXPECT_EQ(journal.size(), 3);
+}
+
+TEST_F(SeenHashJournalTest, CutsOffATornTail) {
+  {
+    SeenHashJournal journal(path_);
+    journal.append(1);
+    journal.append(2);
+  }
+  // A crash in the middle of the third record, then a zero-filled block
+  std::ofstream(path_, std::ios::binary | std::ios::app) << std::string_view("\x03\x00\x00", 3);
+  const auto intactSize = std::filesystem::file_size(path_) - 3;
+
+  SeenHashJournal journal(path_);
+  std::unordered_set<uint64_t> hashes;
+  EXPECT_EQ(journal.replay(hashes), 2);
+  EXPECT_EQ(std::filesystem::file_size(path_), intactSize);
+
+  std::ofstream(path_, std::ios::binary | std::ios::app) << std::string(16, '\0');
+  hashes.clear();
+  EXPECT_EQ(journal.replay(hashes), 2);
+  EXPECT_EQ(std::filesystem::file_size(path_), intactSize);
+
+  journal.append(4);
+  hashes.clear();
+  EXPECT_EQ(SeenHashJournal(path_).replay(hashes), 3);
+  EXPECT_TRUE(hashes.contains(4));
+}
+
+TEST_F(SeenHashJournalTest, StartsOverWhenCleared) {
+  SeenHashJournal journal(path_);
+  journal.append(1);
+  EXPECT_TRUE(journal.clear());
+  EXPECT_EQ(journal.size(), 0);
+  journal.append(2);
+
+  std::unordered_set<uint64_t> hashes;
+  EXPECT_EQ(SeenHashJournal(path_).replay(hashes), 1);
+  EXPECT_EQ(hashes, (std::unordered_set<uint64_t>{2}));
+}
+
+TEST_F(SeenHashJournalTest, IgnoresAForeignFile) {
+  std::ofstream(path_) << "not a journal at all";
+  SeenHashJournal journal(path_);
+  std::unordered_set<uint64_t> hashes;
+  EXPECT_EQ(journal.replay(hashes), 0);
+  EXPECT_TRUE(hashes.empty());
+
+  journal.append(5);
+  EXPECT_EQ(SeenHashJournal(path_).replay(hashes), 1);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Utils/String/TextKernels.hpp"
+
+#include <random>
+#include <string>
+
+using namespace dotnamebot::utils;
+
+namespace {
+
+  class TextKernelsTest : public ::testing::TestWithParam<ScanLevel> {
+  protected:
+    void SetUp() override {
+      if (setScanLevel(GetParam()) != GetParam()) {
+        GTEST_SKIP() << scanLevelName(GetParam()) << " is not available on this CPU";
+      }
+    }
+    void TearDown() override { setScanLevel(bestScanLevel()); }
+  };
+
+} // namespace
+
+TEST_P(TextKernelsTest, FindsBytesLikeTheStandardLibrary) {
+  const std::string setChars = "&<;\n";
+  const ByteSet set(setChars);
+  const std::string alphabet = "ab &<;\n\t\x80\xff";
+
+  std::mt19937 rng(11);
+  for (int i = 0; i < 20000; ++i) {
+    std::string text(rng() % 100, 'x');
+    // Mostly clean text with a few hits, so whole vectors are skipped too
+    for (char &c : text) {
+      if (rng() % 16 == 0) {
+        c = alphabet[rng() % alphabet.size()];
+      }
+    }
+    const size_t pos = text.empty() ? 0 : rng() % (text.size() + 2);
+    const std::string_view view(text);
+    ASSERT_EQ(findFirstOf(view, set, pos), view.find_first_of(setChars, pos)) << text;
+    ASSERT_EQ(findFirstNotOf(view, set, pos), view.find_first_not_of(setChars, pos)) << text;
+  }
+}
+
+TEST_P(TextKernelsTest, ScansPastEveryVectorWidth) {
+  for (size_t size = 0; size < 80; ++size) {
+    std::string text(size, ' ');
+    EXPECT_EQ(findFirstOf(text, WHITESPACE_BYTES), size == 0 ? std::string::npos : 0);
+    EXPECT_EQ(findFirstNotOf(text, WHITESPACE_BYTES), std::string::npos);
+    if (size > 0) {
+      text.back() = 'x';
+      EXPECT_EQ(findFirstNotOf(text, WHITESPACE_BYTES), size - 1);
+      EXPECT_EQ(findFirstOf(text, ByteSet("x")), size - 1);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllLevels, TextKernelsTest,
+                         ::testing::Values(ScanLevel::Scalar, ScanLevel::Sse2, ScanLevel::Avx2),
+                         [](const auto &info) { return std::string(scanLevelName(info.param)); });
+
+TEST(ByteSetTest, IgnoresDuplicates) {
+  constexpr ByteSet set("aab");
+  static_assert(set.size() == 2);
+  EXPECT_TRUE(set.contains('a'));
+  EXPECT_FALSE(set.contains('c'));
+  EXPECT_THROW(ByteSet("abcdefghi"), std::length_error);
+}
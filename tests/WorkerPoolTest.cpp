@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Utils/Concurrency/BoundedQueue.hpp"
+#include "../src/lib/Utils/Concurrency/WorkerPool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using dotnamebot::utils::BoundedQueue;
+using dotnamebot::utils::Strand;
+using dotnamebot::utils::WorkerPool;
+
+TEST(WorkerPoolTest, RunsEveryTaskIncludingNestedOnes) {
+  WorkerPool pool(4);
+  EXPECT_EQ(pool.size(), 4);
+
+  std::atomic<int> runs{0};
+  for (int i = 0; i < 100; ++i) {
+    pool.submit([&pool, &runs]() {
+      runs++;
+      // Lands on the submitting worker's own deque; idle workers steal it
+      pool.submit([&runs]() { runs++; });
+    });
+  }
+  pool.wait();
+  EXPECT_EQ(runs, 200);
+}
+
+TEST(WorkerPoolTest, SpreadsWorkOverTheThreads) {
+  WorkerPool pool(3);
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  std::atomic<int> waiting{0};
+  for (int i = 0; i < 3; ++i) {
+    pool.submit([&]() {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+      }
+      // Each task holds its worker until all three run at once
+      waiting++;
+      while (waiting < 3) {
+        std::this_thread::yield();
+      }
+    });
+  }
+  pool.wait();
+  EXPECT_EQ(threads.size(), 3);
+}
+
+TEST(WorkerPoolTest, DestructorRunsQueuedTasks) {
+  std::atomic<int> runs{0};
+  {
+    WorkerPool pool(2);
+    for (int i = 0; i < 50; ++i) {
+      pool.submit([&runs]() { runs++; });
+    }
+  }
+  EXPECT_EQ(runs, 50);
+}
+
+TEST(StrandTest, RunsTasksInOrderOneAtATime) {
+  WorkerPool pool(4);
+  std::vector<std::unique_ptr<Strand>> strands;
+  std::vector<std::vector<int>> seen(8);
+  std::vector<std::atomic<int>> active(8);
+  std::atomic<bool> overlapped{false};
+  for (size_t s = 0; s < seen.size(); ++s) {
+    strands.push_back(std::make_unique<Strand>(pool));
+  }
+  for (int i = 0; i < 200; ++i) {
+    for (size_t s = 0; s < seen.size(); ++s) {
+      strands[s]->post([&, s, i]() {
+        if (active[s]++ != 0) {
+          overlapped = true;
+        }
+        seen[s].push_back(i);
+        active[s]--;
+      });
+    }
+  }
+  pool.wait();
+
+  EXPECT_FALSE(overlapped);
+  for (const auto &order : seen) {
+    ASSERT_EQ(order.size(), 200);
+    for (int i = 0; i < 200; ++i) {
+      EXPECT_EQ(order[i], i);
+    }
+  }
+}
+
+TEST(StrandTest, MayBeDestroyedWhileItsLastTaskRuns) {
+  WorkerPool pool(2);
+  std::atomic<bool> done{false};
+  {
+    Strand strand(pool);
+    strand.post([&done]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      done = true;
+    });
+  }
+  pool.wait();
+  EXPECT_TRUE(done);
+}
+
+TEST(BoundedQueueTest, ProducerWaitsWhileTheQueueIsFull) {
+  BoundedQueue<int> queue(2);
+  std::atomic<int> pushed{0};
+  std::thread producer([&]() {
+    for (int i = 0; i < 5; ++i) {
+      queue.push(i);
+      pushed++;
+    }
+  });
+
+  while (pushed < 2) {
+    std::this_thread::yield();
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(pushed, 2);
+
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(queue.pop(), i);
+  }
+  producer.join();
+  EXPECT_EQ(pushed, 5);
+}
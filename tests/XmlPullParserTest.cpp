@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include "../src/lib/Rss/XmlPullParser.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace dotnamebot::rss;
+
+namespace {
+
+  using Event = XmlPullParser::Event;
+
+  // One line per event, e.g. "<a>", "</a>", "text:x", so whole walks compare at once
+  std::vector<std::string> events(std::string_view xml) {
+    XmlPullParser parser(xml);
+    std::vector<std::string> out;
+    while (true) {
+      switch (parser.next()) {
+      case Event::StartElement: out.push_back("<" + std::string(parser.name()) + ">"); break;
+      case Event::EndElement: out.push_back("</" + std::string(parser.name()) + ">"); break;
+      case Event::Text: out.push_back("text:" + parser.text()); break;
+      case Event::Cdata: out.push_back("cdata:" + parser.text()); break;
+      case Event::Comment: out.push_back("comment:" + parser.text()); break;
+      case Event::Error: out.emplace_back("error"); return out;
+      default: return out;
+      }
+    }
+  }
+
+} // namespace
+
+TEST(XmlPullParserTest, ReportsElementsTextAndSections) {
+  EXPECT_EQ(events("<?xml version=\"1.0\"?>\n<!DOCTYPE rss>\n<a>\n  <b>x</b> <c/>"
+                   "<![CDATA[<p>]]><!-- note --></a>"),
+            (std::vector<std::string>{"<a>", "<b>", "text:x", "</b>", "<c>", "</c>",
+                                      "cdata:<p>", "comment: note ", "</a>"}));
+}
+
+TEST(XmlPullParserTest, DecodesTextLikeTinyxml2) {
+  // Leading blanks of a text node stay, whitespace-only runs between tags are dropped
+  EXPECT_EQ(events("<a>  one &amp; &lt;two&gt; &#353;&#x161; &nbsp; &#X41;</a>"),
+            (std::vector<std::string>{"<a>", "text:  one & <two> šš &nbsp; &#X41;", "</a>"}));
+  EXPECT_EQ(events("<a>1\r\n2\r3\n\r4</a>"),
+            (std::vector<std::string>{"<a>", "text:1\n2\n3\n4", "</a>"}));
+  // CDATA keeps entities, but line breaks are still normalized
+  EXPECT_EQ(events("<a><![CDATA[&amp;\r\n]]></a>"),
+            (std::vector<std::string>{"<a>", "cdata:&amp;\n", "</a>"}));
+}
+
+TEST(XmlPullParserTest, ReadsAttributes) {
+  XmlPullParser parser("<media:content url='https://x.example/?a=1&amp;b=2' medium=\"image\"/>");
+  ASSERT_EQ(parser.next(), Event::StartElement);
+  EXPECT_TRUE(parser.isEmptyElement());
+  std::string value;
+  ASSERT_TRUE(parser.attribute("url", value));
+  EXPECT_EQ(value, "https://x.example/?a=1&b=2");
+  ASSERT_TRUE(parser.attribute("medium", value));
+  EXPECT_EQ(value, "image");
+  EXPECT_FALSE(parser.attribute("type", value));
+  EXPECT_TRUE(parser.finish());
+}
+
+TEST(XmlPullParserTest, WalksChildrenOnce) {
+  XmlPullParser parser("<item><title>T</title><x><title>nested</title></x>"
+                       "<description><![CDATA[<b>d</b>]]></description><link/></item>");
+  ASSERT_EQ(parser.next(), Event::StartElement);
+  const size_t depth = parser.depth();
+
+  std::vector<std::string> children;
+  std::vector<XmlPullParser::FirstChild> values;
+  while (parser.nextChild(depth)) {
+    children.emplace_back(parser.name());
+    if (parser.name() != "x") {
+      values.push_back(parser.readElement());
+    }
+  }
+  EXPECT_EQ(children, (std::vector<std::string>{"title", "x", "description", "link"}));
+  ASSERT_EQ(values.size(), 3U);
+  EXPECT_EQ(values[0].text(), "T");
+  EXPECT_EQ(values[1].kind, XmlPullParser::FirstChild::Kind::Cdata);
+  EXPECT_EQ(values[1].text(), "<b>d</b>");
+  EXPECT_EQ(values[2].kind, XmlPullParser::FirstChild::Kind::None);
+  EXPECT_TRUE(parser.finish());
+}
+
+TEST(XmlPullParserTest, FirstChildElementHasNoText) {
+  XmlPullParser parser("<title><b>bold</b> rest</title>");
+  ASSERT_EQ(parser.next(), Event::StartElement);
+  const XmlPullParser::FirstChild child = parser.readElement();
+  EXPECT_EQ(child.kind, XmlPullParser::FirstChild::Kind::Element);
+  EXPECT_EQ(child.value, "b");
+  EXPECT_FALSE(child.isText());
+  EXPECT_TRUE(parser.finish());
+}
+
+TEST(XmlPullParserTest, RejectsMalformedDocuments) {
+  for (const char *xml : {"", "<a>", "<a></b>", "<a><b></a>", "<a x='1' x='2'/>", "<a x=1/>",
+                          "<a><?pi?></a>", "<a><!-- open</a>"}) {
+    XmlPullParser parser(xml);
+    EXPECT_FALSE(parser.finish()) << xml;
+    EXPECT_FALSE(parser.error().empty()) << xml;
+  }
+  // A declaration is fine before the root, and so is a byte order mark
+  EXPECT_TRUE(XmlPullParser("\xEF\xBB\xBF<?xml version=\"1.0\"?><a/>").finish());
+}